@@ -322,6 +322,7 @@ for filename in sorted(glob.glob("../src/awkward1/**/*.py", recursive=True),
                         "ak.forms.UnionForm.rst",
                         "ak.forms.VirtualForm.rst",
                         "ak._io.fromjson.rst",
+                        "ak._io.fromjsonlines.rst",
                         "ak._io.fromroot_nestedvector.rst",
                         ])
 
@@ -0,0 +1,132 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_ALLOCATOR_H_
+#define AWKWARD_ALLOCATOR_H_
+
+#include <memory>
+#include <string>
+
+#include "awkward/common.h"
+
+namespace awkward {
+  class Allocator;
+  using AllocatorPtr = std::shared_ptr<Allocator>;
+
+  /// @class Allocator
+  ///
+  /// @brief Abstract source of the memory behind the buffers that
+  /// libawkward creates: Index, Identities, NumpyArray, RawArray, and
+  /// GrowableBuffer (through {@link util::allocate util::allocate}).
+  ///
+  /// Buffers that are borrowed from elsewhere (such as NumPy arrays
+  /// through the Python bindings) are not affected.
+  ///
+  /// The default is a PoolAllocator. Embedders can replace it with
+  /// #set_current, for instance with a NUMA-aware or hugepage-backed
+  /// Allocator. Each buffer is returned to the Allocator that provided
+  /// it, so the current Allocator can be changed at any time; to make that
+  /// safe without a reference count per buffer, every Allocator that has
+  /// been made current is kept until the process exits.
+  class EXPORT_SYMBOL Allocator {
+  public:
+    /// @brief Alignment, in bytes, of every buffer an Allocator returns.
+    static const int64_t kAlignment = 64;
+
+    /// @brief Empty destructor; required for some C++ reason.
+    virtual ~Allocator();
+
+    /// @brief User-friendly name of this class.
+    virtual const std::string
+      classname() const = 0;
+
+    /// @brief Returns uninitialized memory of at least `bytes` bytes,
+    /// aligned to #kAlignment; throws `std::bad_alloc` if it can't.
+    ///
+    /// A request for zero bytes still returns a valid, unique pointer.
+    ///
+    /// Must be safe to call from any thread.
+    virtual void*
+      allocate(int64_t bytes) = 0;
+
+    /// @brief Returns memory obtained from #allocate with the same number
+    /// of `bytes`.
+    ///
+    /// Must be safe to call from any thread, including a thread other
+    /// than the one that allocated it.
+    virtual void
+      deallocate(void* ptr, int64_t bytes) = 0;
+
+    /// @brief The Allocator that new buffers are taken from.
+    static const AllocatorPtr
+      current();
+
+    /// @brief The Allocator that new buffers are taken from, as a plain
+    /// pointer that stays valid until the process exits.
+    ///
+    /// This is what {@link util::allocate util::allocate} uses: it costs
+    /// one atomic load, without a reference count.
+    static Allocator*
+      current_raw();
+
+    /// @brief Replaces the Allocator that new buffers are taken from.
+    ///
+    /// If `allocator` is `nullptr`, the default PoolAllocator is restored.
+    static void
+      set_current(const AllocatorPtr& allocator);
+  };
+
+  /// @class HeapAllocator
+  ///
+  /// @brief Takes every buffer directly from the aligned system heap and
+  /// returns it there, without caching.
+  class EXPORT_SYMBOL HeapAllocator: public Allocator {
+  public:
+    const std::string
+      classname() const override;
+
+    void*
+      allocate(int64_t bytes) override;
+
+    void
+      deallocate(void* ptr, int64_t bytes) override;
+  };
+
+  /// @class PoolAllocator
+  ///
+  /// @brief Keeps freed buffers in power-of-two size classes, from
+  /// #kAlignment bytes to #kMaxPooled bytes, so that the short-lived
+  /// buffers of slicing and reducing (carries, offsets, parents) are
+  /// reused instead of going back to `malloc`.
+  ///
+  /// Each thread has a small cache per size class that is used without
+  /// locking; it overflows into, and refills from, a central cache shared
+  /// by all threads. Larger buffers go directly to the aligned heap.
+  ///
+  /// All instances share the same process-wide pool.
+  class EXPORT_SYMBOL PoolAllocator: public Allocator {
+  public:
+    /// @brief Largest buffer, in bytes, that is cached.
+    static const int64_t kMaxPooled = 1048576;
+
+    const std::string
+      classname() const override;
+
+    void*
+      allocate(int64_t bytes) override;
+
+    void
+      deallocate(void* ptr, int64_t bytes) override;
+
+    /// @brief Number of bytes held in the central cache (not counting the
+    /// per-thread caches).
+    int64_t
+      cached_bytes() const;
+
+    /// @brief Returns the calling thread's cache and the central cache to
+    /// the system heap.
+    void
+      release();
+  };
+}
+
+#endif // AWKWARD_ALLOCATOR_H_
@@ -21,6 +21,59 @@ namespace awkward {
   class Form;
   using FormPtr       = std::shared_ptr<Form>;
 
+  /// @brief Tag for each concrete Content node type, including integer
+  /// specializations, returned by {@link Content#kind Content::kind}.
+  ///
+  /// Algorithms that depend on the type of another node (such as
+  /// {@link Content#merge Content::merge}) switch on this tag and
+  /// `static_cast`, rather than trying a chain of `dynamic_cast`s.
+  enum class ContentKind {
+    BitMaskedArray,
+    ByteMaskedArray,
+    EmptyArray,
+    IndexedArray32,
+    IndexedArrayU32,
+    IndexedArray64,
+    IndexedOptionArray32,
+    IndexedOptionArray64,
+    ListArray32,
+    ListArrayU32,
+    ListArray64,
+    ListOffsetArray32,
+    ListOffsetArrayU32,
+    ListOffsetArray64,
+    None,
+    NumpyArray,
+    RawArray,
+    Record,
+    RecordArray,
+    RegularArray,
+    UnionArray8_32,
+    UnionArray8_U32,
+    UnionArray8_64,
+    UnmaskedArray,
+    VirtualArray
+  };
+
+  /// @brief Tag for each concrete Form node type, returned by
+  /// {@link Form#kind Form::kind}.
+  enum class FormKind {
+    BitMaskedForm,
+    ByteMaskedForm,
+    EmptyForm,
+    IndexedForm,
+    IndexedOptionForm,
+    ListForm,
+    ListOffsetForm,
+    NumpyForm,
+    RawForm,
+    RecordForm,
+    RegularForm,
+    UnionForm,
+    UnmaskedForm,
+    VirtualForm
+  };
+
   /// @class Form
   ///
   /// @brief Abstract superclass of all array node forms, which expresses the
@@ -40,6 +93,11 @@ namespace awkward {
     /// @brief Empty destructor; required for some C++ reason.
     virtual ~Form() { }
 
+    /// @brief The concrete type of this node, for dispatching without
+    /// RTTI.
+    virtual FormKind
+      kind() const = 0;
+
     /// @brief High-level Type describing this Form.
     ///
     /// @param typestrs A mapping from `"__record__"` parameters to string
@@ -149,6 +207,22 @@ namespace awkward {
     virtual const std::vector<std::string>
       keys() const = 0;
 
+    /// @brief The Form of the array that Content#getitem_field would return
+    /// from an array of this Form, without needing the array itself.
+    ///
+    /// Raises an error if the array does not contain a RecordForm with
+    /// the specified `key`.
+    virtual const FormPtr
+      getitem_field(const std::string& key) const = 0;
+
+    /// @brief The Form of the array that Content#getitem_fields would return
+    /// from an array of this Form, without needing the array itself.
+    ///
+    /// Raises an error if the array does not contain a RecordForm with
+    /// all of the specified `keys`.
+    virtual const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const = 0;
+
     /// @brief Returns a string representation of this Form (#tojson with
     /// `pretty = true` and `verbose = false`).
     virtual const std::string
@@ -246,6 +320,11 @@ namespace awkward {
     virtual const std::string
       classname() const = 0;
 
+    /// @brief The concrete type of this node, including integer-type
+    /// specialization, for dispatching without RTTI.
+    virtual ContentKind
+      kind() const = 0;
+
     /// @brief Optional Identities for each element of the array
     /// (may be `nullptr`).
     virtual const IdentitiesPtr
@@ -316,6 +395,25 @@ namespace awkward {
     virtual void
       tojson_part(ToJson& builder, bool include_beginendlist) const = 0;
 
+    /// @brief Internal function to write elements `start` (inclusive)
+    /// through `stop` (exclusive) into a JSON builder, one JSON value per
+    /// element.
+    ///
+    /// Nodes override this to walk their own offsets, indexes, masks, and
+    /// data buffers directly, rather than creating a Content for each
+    /// element with #getitem_at_nowrap. The default does the latter.
+    virtual void
+      tojson_elements(ToJson& builder, int64_t start, int64_t stop) const;
+
+    /// @brief Internal function to write elements `start` (inclusive)
+    /// through `stop` (exclusive) into a JSON builder as one list, which is
+    /// how list nodes write each of their elements.
+    ///
+    /// The default wraps #tojson_elements in `beginlist`/`endlist`;
+    /// NumpyArray overrides it to write strings of `"char"` or `"byte"`.
+    virtual void
+      tojson_sublist(ToJson& builder, int64_t start, int64_t stop) const;
+
     /// @brief Internal function used to calculate #nbytes.
     ///
     /// @param largest The largest range of bytes used in each
@@ -357,6 +455,21 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const = 0;
 
+    /// @brief Copies this array into buffers that hold only what it can
+    /// reach, so that a small selection no longer keeps the full original
+    /// buffers alive.
+    ///
+    /// Lists become ListOffsetArray64 with offsets starting at zero and
+    /// their content trimmed or carried into list order. Option-type
+    /// indexes keep only the valid items, in order; other indexes are
+    /// projected away. Each union content keeps only its own items.
+    /// RecordArray fields are trimmed to the record length and NumpyArray
+    /// data are copied into new contiguous buffers.
+    ///
+    /// Identities are passed along as they are.
+    virtual const ContentPtr
+      pack() const = 0;
+
     /// @brief Performs up-front validity checks on an array so that they don't
     /// have to be checked in #getitem_at_nowrap for each item.
     virtual void
@@ -608,6 +721,33 @@ namespace awkward {
     virtual const ContentPtr
       merge(const ContentPtr& other) const = 0;
 
+    /// @brief An array with this and all of the `others` concatenated, in
+    /// order.
+    ///
+    /// The values are the same as from calling #merge on each in turn (or
+    /// #merge_as_union where two are not #mergeable), but without
+    /// recopying a growing result at every step. NumpyArray, list, record,
+    /// indexed, option-type, and union inputs are sized once and each
+    /// input is filled into its place; inputs that are not all #mergeable
+    /// become a {@link UnionArrayOf UnionArray} of the groups that are.
+    /// Anything else is merged pairwise in a balanced tree, so that each
+    /// item is copied O(log N) times, not O(N).
+    ///
+    /// @param others The arrays to put after this one.
+    /// @param mergebool If `true`, boolean and numeric data are merged, as
+    /// in #mergeable.
+    virtual const ContentPtr
+      merge_many(const ContentPtrVec& others, bool mergebool) const;
+
+    /// @brief An array with the `other` and this concatenated (`other`
+    /// first, this last).
+    ///
+    /// Only option-type, indexed, and union arrays, which can wrap any
+    /// other node, implement this; other nodes' #merge dispatches to it
+    /// by #kind. The default raises an error.
+    virtual const ContentPtr
+      reverse_merge(const ContentPtr& other) const;
+
     /// @brief Converts this array into a SliceItem that can be used in
     /// getitem.
     virtual const SliceItemPtr
@@ -939,6 +1079,13 @@ namespace awkward {
     const ContentPtr
       merge_as_union(const ContentPtr& other) const;
 
+    /// @brief If `other` is an option-type or indexed array, returns its
+    /// `content`; otherwise, returns `other` itself.
+    ///
+    /// Used by #mergeable, after dispatching on the `other` array's #kind.
+    static const ContentPtr
+      option_content(const ContentPtr& other);
+
     /// @brief Internal function to handle the `axis = 0` case of #rpad
     /// and #rpad_and_clip.
     ///
@@ -1117,6 +1264,25 @@ namespace awkward {
       axis_wrap_if_negative(int64_t axis);
 
   protected:
+    /// @brief Internal function for #merge_many: returns `true` if every
+    /// one of the `inputs` is #mergeable with the first that isn't an
+    /// EmptyArray, and none of them is a {@link UnionArrayOf UnionArray}.
+    static bool
+      all_mergeable(const ContentPtrVec& inputs, bool mergebool);
+
+    /// @brief Internal function for #merge_many: concatenates mergeable
+    /// `inputs`, at least one of which is an indexed or option-type array,
+    /// by filling one shifted index and merging all of their contents.
+    static const ContentPtr
+      merge_many_as_indexed(const ContentPtrVec& inputs, bool mergebool);
+
+    /// @brief Internal function for #merge_many: concatenates `inputs` as
+    /// a {@link UnionArrayOf UnionArray} whose contents are the groups of
+    /// mergeable inputs (and contents of union inputs), each group
+    /// concatenated by #merge_many.
+    static const ContentPtr
+      merge_many_as_union(const ContentPtrVec& inputs, bool mergebool);
+
     /// @brief Internal function to wrap putative #getitem output with enough
     /// RegularArray nodes to satisfy a given `shape`.
     ///
@@ -1126,6 +1292,21 @@ namespace awkward {
       getitem_next_array_wrap(const ContentPtr& outcontent,
                               const std::vector<int64_t>& shape) const;
 
+    /// @brief Internal function to finish #reduce_next of an option-type
+    /// node: when this node is above the reduced axis, puts the missing
+    /// values described by `outindex` back into the lists of `out`.
+    ///
+    /// @param out Result of #reduce_next on the node's non-missing values.
+    /// @param outindex Index of the non-missing values, with `-1` for each
+    /// missing one, as used by IndexedOptionArray.
+    /// @param starts Starts of the reduced lists, as passed to #reduce_next.
+    /// @param negaxis The negative axis, as passed to #reduce_next.
+    const ContentPtr
+      reduce_next_option_wrap(const ContentPtr& out,
+                              const Index64& outindex,
+                              const Index64& starts,
+                              int64_t negaxis) const;
+
     /// @brief Internal function to convert #parameters into a string fragment
     /// for #tostring.
     ///
@@ -170,6 +170,16 @@ namespace awkward {
     IndexOf<T>
       getitem_range_nowrap(int64_t start, int64_t stop) const;
 
+    /// @brief Composes this Index with a `carry`: item `i` of the output
+    /// is item `carry[i]` of this Index, bounds-checked.
+    ///
+    /// Successive selections compose index-on-index this way, so that the
+    /// array they select from is gathered only once, at the end. The
+    /// calculation time scales with the length of `carry`, not with this
+    /// Index or the data it points into.
+    IndexOf<T>
+      getitem_carry_64(const IndexOf<int64_t>& carry) const;
+
     /// @brief Internal function used to calculate Content#nbytes.
     ///
     /// @param largest The largest range of bytes used in each
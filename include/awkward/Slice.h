@@ -15,6 +15,22 @@ namespace awkward {
   class SliceItem;
   using SliceItemPtr = std::shared_ptr<SliceItem>;
 
+  /// @brief Tag for each concrete SliceItem type, returned by
+  /// {@link SliceItem#kind SliceItem::kind}, so that
+  /// {@link Content#getitem_next Content::getitem_next} can dispatch with a
+  /// `switch` instead of a chain of `dynamic_cast`s.
+  enum class SliceKind {
+    at,
+    range,
+    ellipsis,
+    newaxis,
+    array64,
+    field,
+    fields,
+    missing64,
+    jagged64
+  };
+
   /// @class SliceItem
   ///
   /// @brief Abstract class for slice items, which are elements of a tuple
@@ -30,6 +46,10 @@ namespace awkward {
     virtual const SliceItemPtr
       shallow_copy() const = 0;
 
+    /// @brief The concrete type of this slice item.
+    virtual SliceKind
+      kind() const = 0;
+
     /// @brief Returns a string representation of this slice item (single-line
     /// custom format).
     virtual const std::string
@@ -63,6 +83,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -132,6 +155,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -162,6 +188,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -187,6 +216,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -273,6 +305,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -335,6 +370,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -376,6 +414,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -433,6 +474,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -506,6 +550,9 @@ namespace awkward {
     const SliceItemPtr
       shallow_copy() const override;
 
+    SliceKind
+      kind() const override;
+
     const std::string
       tostring() const override;
 
@@ -582,6 +629,8 @@ namespace awkward {
       head() const;
 
     /// @brief Returns a Slice representing all but the first SliceItem.
+    ///
+    /// The tail shares this Slice's items, so it is cheap to make.
     const Slice
       tail() const;
 
@@ -650,8 +699,22 @@ namespace awkward {
       isadvanced() const;
 
   private:
-    /// @brief See #items.
-    std::vector<SliceItemPtr> items_;
+    /// @brief Creates a view of `items` starting at `start`, which is how
+    /// #tail avoids copying the remaining items.
+    Slice(const std::shared_ptr<std::vector<SliceItemPtr>>& items,
+          size_t start,
+          bool sealed);
+
+    /// @brief Copies the #items into a vector of their own (if they are
+    /// shared with another Slice or start partway into the vector), so
+    /// that they may be modified in place.
+    void
+      own_items();
+
+    /// @brief See #items; may be shared with other Slices.
+    std::shared_ptr<std::vector<SliceItemPtr>> items_;
+    /// @brief Position of the #head in #items_.
+    size_t start_;
     /// @brief See #sealed.
     bool sealed_;
   };
@@ -43,6 +43,9 @@ namespace awkward {
     bool
       lsb_order() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -82,6 +85,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -206,6 +215,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -232,6 +244,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -249,6 +266,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -316,7 +336,7 @@ namespace awkward {
       mergeable(const ContentPtr& other, bool mergebool) const override;
 
     const ContentPtr
-      reverse_merge(const ContentPtr& other) const;
+      reverse_merge(const ContentPtr& other) const override;
 
     const ContentPtr
       merge(const ContentPtr& other) const override;
@@ -393,6 +413,20 @@ namespace awkward {
                           const SliceJagged64& slicecontent,
                           const Slice& tail) const override;
 
+  protected:
+    template <typename S>
+    const ContentPtr
+      getitem_next_jagged_generic(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const S& slicecontent,
+                                  const Slice& tail) const;
+
+    /// @brief Positions of the valid elements (`first`) and, for every
+    /// element, its position among them or `-1` if missing (`second`),
+    /// computed directly from the bits.
+    const std::pair<Index64, Index64>
+      nextcarry_outindex(int64_t& numnull) const;
+
   private:
     /// @brief See #mask.
     const IndexU8 mask_;
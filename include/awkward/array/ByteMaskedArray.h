@@ -37,6 +37,9 @@ namespace awkward {
     bool
       valid_when() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -76,6 +79,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -175,6 +184,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -201,6 +213,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -218,6 +235,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -285,7 +305,7 @@ namespace awkward {
       mergeable(const ContentPtr& other, bool mergebool) const override;
 
     const ContentPtr
-      reverse_merge(const ContentPtr& other) const;
+      reverse_merge(const ContentPtr& other) const override;
 
     const ContentPtr
       merge(const ContentPtr& other) const override;
@@ -23,6 +23,9 @@ namespace awkward {
     EmptyForm(bool has_identities,
               const util::Parameters& parameters);
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -62,6 +65,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -96,6 +105,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -136,6 +148,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
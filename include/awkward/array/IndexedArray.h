@@ -31,6 +31,9 @@ namespace awkward {
     const FormPtr
       content() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -70,6 +73,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -96,6 +105,9 @@ namespace awkward {
 
     const FormPtr content() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -135,6 +147,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -237,6 +255,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -263,6 +284,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -280,6 +306,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -349,7 +378,7 @@ namespace awkward {
       mergeable(const ContentPtr& other, bool mergebool) const override;
 
     const ContentPtr
-      reverse_merge(const ContentPtr& other) const;
+      reverse_merge(const ContentPtr& other) const override;
 
     const ContentPtr
       merge(const ContentPtr& other) const override;
@@ -33,6 +33,9 @@ namespace awkward {
     const FormPtr
       content() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -72,6 +75,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -203,6 +212,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -229,6 +241,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -246,6 +263,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -311,6 +331,10 @@ namespace awkward {
     const ContentPtr
       merge(const ContentPtr& other) const override;
 
+    const ContentPtr
+      merge_many(const ContentPtrVec& others,
+                 bool mergebool) const override;
+
     const SliceItemPtr
       asslice() const override;
 
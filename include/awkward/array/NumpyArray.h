@@ -35,9 +35,17 @@ namespace awkward {
 
     const std::string format() const;
 
+    /// @brief The #format resolved into a numerical type (or
+    /// `util::dtype::NOT_PRIMITIVE`).
+    util::dtype
+      dtype() const;
+
     const std::string
       primitive() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -86,6 +94,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -96,6 +110,7 @@ namespace awkward {
     const std::vector<int64_t> inner_shape_;
     int64_t itemsize_;
     const std::string format_;
+    const util::dtype dtype_;
   };
 
   /// @class NumpyArray
@@ -244,6 +259,14 @@ namespace awkward {
     const std::string
       format() const;
 
+    /// @brief The #format resolved once, at construction, into a numerical
+    /// type; `util::dtype::NOT_PRIMITIVE` if it is not a number or boolean.
+    ///
+    /// Kernels are selected by indexing dispatch tables with this value
+    /// rather than by comparing format strings.
+    util::dtype
+      dtype() const;
+
     /// @brief The number of dimensions, which is `shape.size()`.
     ///
     /// Note that the integer type is `ssize_t` for consistency with pybind11.
@@ -370,6 +393,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -396,6 +422,16 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
+    void
+      tojson_sublist(ToJson& builder,
+                     int64_t start,
+                     int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -410,6 +446,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -482,6 +521,14 @@ namespace awkward {
     const ContentPtr
       merge(const ContentPtr& other) const override;
 
+    /// @copydoc Content::merge_many
+    ///
+    /// If every input is a NumpyArray of the same inner shape, each one is
+    /// filled directly into a single output buffer.
+    const ContentPtr
+      merge_many(const ContentPtrVec& others,
+                 bool mergebool) const override;
+
     const SliceItemPtr
       asslice() const override;
 
@@ -547,6 +594,28 @@ namespace awkward {
     const NumpyArray
       contiguous() const;
 
+    /// @brief Reduces the groups of this one-dimensional, contiguous array
+    /// that are delimited by `offsets`, without building a `parents` index.
+    ///
+    /// This is the leaf of
+    /// {@link ListOffsetArrayOf#reduce_next ListOffsetArray::reduce_next}
+    /// when its content is contiguous: each group is combined in one pass
+    /// over adjacent memory. See #reduce_next for the general case.
+    ///
+    /// @param reducer The algorithm to apply.
+    /// @param offsets Positions in this array that delimit the groups; the
+    /// output has `offsets.length() - 1` items. Index32 and IndexU32 offsets
+    /// are used as they are, without widening to 64 bits.
+    /// @param mask If `true`, empty groups are masked as missing values.
+    /// @param keepdims If `true`, the output is wrapped in a RegularArray of
+    /// size 1.
+    template <typename T>
+    const ContentPtr
+      reduce_segments(const Reducer& reducer,
+                      const IndexOf<T>& offsets,
+                      bool mask,
+                      bool keepdims) const;
+
     /// @brief Inhibited general function (see 7 argument `getitem_next`
     /// specific to NumpyArray).
     const ContentPtr
@@ -796,6 +865,8 @@ namespace awkward {
   const ssize_t itemsize_;
   /// @brief See #format.
   const std::string format_;
+  /// @brief See #dtype.
+  const util::dtype dtype_;
 
   /// @brief Mapping from (platform dependent) `std::type_index` to pybind11
   /// format string (see #format).
@@ -44,6 +44,11 @@ namespace awkward {
     const std::string
       T() const;
 
+    FormKind
+      kind() const override {
+      return FormKind::RawForm;
+    }
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override {
       throw std::runtime_error("RawForm::type");
@@ -114,6 +119,18 @@ namespace awkward {
       return std::vector<std::string>();
     }
 
+    const FormPtr
+      getitem_field(const std::string& key) const override {
+      throw std::invalid_argument(
+        std::string("cannot slice RawArray by field name"));
+    }
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override {
+      throw std::invalid_argument(
+        std::string("cannot slice RawArray by field names"));
+    }
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -222,8 +239,7 @@ namespace awkward {
                   const util::Parameters& parameters,
                   const int64_t length)
         : Content(identities, parameters)
-        , ptr_(std::shared_ptr<T>(new T[(size_t)length],
-                                  util::array_deleter<T>()))
+        , ptr_(util::allocate<T>(length))
         , offset_(0)
         , length_(length)
         , itemsize_(sizeof(T)) { }
@@ -297,6 +313,11 @@ namespace awkward {
         std::string(">");
     }
 
+    ContentKind
+      kind() const override {
+      return ContentKind::RawArray;
+    }
+
     void
       setidentities() override {
       if (length() <= kMaxInt32) {
@@ -544,8 +565,7 @@ namespace awkward {
       std::shared_ptr<T> ptr = ptr_;
       int64_t offset = offset_;
       if (copyarrays) {
-        ptr = std::shared_ptr<T>(new T[(size_t)length_],
-                                 util::array_deleter<T>());
+        ptr = util::allocate<T>(length_);
         memcpy(ptr.get(), &ptr_.get()[(size_t)offset_],
                sizeof(T)*((size_t)length_));
         offset = 0;
@@ -562,6 +582,11 @@ namespace awkward {
                                              itemsize_);
     }
 
+    const ContentPtr
+      pack() const override {
+      return deep_copy(true, false, false);
+    }
+
     void
       check_for_iteration() const override {
       if (identities_.get() != nullptr  &&
@@ -655,8 +680,7 @@ namespace awkward {
 
     const ContentPtr
       carry(const Index64& carry) const override {
-      std::shared_ptr<T> ptr(new T[(size_t)carry.length()],
-                             util::array_deleter<T>());
+      std::shared_ptr<T> ptr = util::allocate<T>(carry.length());
       struct Error err = awkward_numpyarray_getitem_next_null_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -754,44 +778,25 @@ namespace awkward {
 
     bool
       mergeable(const ContentPtr& other, bool mergebool) const override {
-      if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+      if (other.get()->kind() == ContentKind::VirtualArray) {
+        VirtualArray* raw = static_cast<VirtualArray*>(other.get());
         return mergeable(raw->array(), mergebool);
       }
 
-      if (dynamic_cast<EmptyArray*>(other.get())) {
-        return true;
-      }
-      else if (IndexedArray32* rawother =
-               dynamic_cast<IndexedArray32*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (IndexedArrayU32* rawother =
-               dynamic_cast<IndexedArrayU32*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (IndexedArray64* rawother =
-               dynamic_cast<IndexedArray64*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (IndexedOptionArray32* rawother =
-               dynamic_cast<IndexedOptionArray32*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (IndexedOptionArray64* rawother =
-               dynamic_cast<IndexedOptionArray64*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (ByteMaskedArray* rawother =
-               dynamic_cast<ByteMaskedArray*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (BitMaskedArray* rawother =
-               dynamic_cast<BitMaskedArray*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
-      }
-      else if (UnmaskedArray* rawother =
-               dynamic_cast<UnmaskedArray*>(other.get())) {
-        return mergeable(rawother->content(), mergebool);
+      switch (other.get()->kind()) {
+        case ContentKind::EmptyArray:
+          return true;
+        case ContentKind::IndexedArray32:
+        case ContentKind::IndexedArrayU32:
+        case ContentKind::IndexedArray64:
+        case ContentKind::IndexedOptionArray32:
+        case ContentKind::IndexedOptionArray64:
+        case ContentKind::ByteMaskedArray:
+        case ContentKind::BitMaskedArray:
+        case ContentKind::UnmaskedArray:
+          return mergeable(option_content(other), mergebool);
+        default:
+          break;
       }
 
       if (RawArrayOf<T>* rawother =
@@ -805,47 +810,26 @@ namespace awkward {
 
     const ContentPtr
       merge(const ContentPtr& other) const override {
-      if (dynamic_cast<EmptyArray*>(other.get())) {
-        return shallow_copy();
-      }
-      else if (IndexedArray32* rawother =
-               dynamic_cast<IndexedArray32*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (IndexedArrayU32* rawother =
-               dynamic_cast<IndexedArrayU32*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (IndexedArray64* rawother =
-               dynamic_cast<IndexedArray64*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (IndexedOptionArray32* rawother =
-               dynamic_cast<IndexedOptionArray32*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (IndexedOptionArray64* rawother =
-               dynamic_cast<IndexedOptionArray64*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (ByteMaskedArray* rawother =
-               dynamic_cast<ByteMaskedArray*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (BitMaskedArray* rawother =
-               dynamic_cast<BitMaskedArray*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
-      }
-      else if (UnmaskedArray* rawother =
-               dynamic_cast<UnmaskedArray*>(other.get())) {
-        return rawother->reverse_merge(shallow_copy());
+      switch (other.get()->kind()) {
+        case ContentKind::EmptyArray:
+          return shallow_copy();
+        case ContentKind::IndexedArray32:
+        case ContentKind::IndexedArrayU32:
+        case ContentKind::IndexedArray64:
+        case ContentKind::IndexedOptionArray32:
+        case ContentKind::IndexedOptionArray64:
+        case ContentKind::ByteMaskedArray:
+        case ContentKind::BitMaskedArray:
+        case ContentKind::UnmaskedArray:
+          return other.get()->reverse_merge(shallow_copy());
+        default:
+          break;
       }
 
       if (RawArrayOf<T>* rawother =
           dynamic_cast<RawArrayOf<T>*>(other.get())) {
         std::shared_ptr<T> ptr =
-          std::shared_ptr<T>(new T[(size_t)(length_ + rawother->length())],
-                             util::array_deleter<T>());
+          util::allocate<T>(length_ + rawother->length());
         memcpy(ptr.get(),
                &ptr_.get()[(size_t)offset_],
                sizeof(T)*((size_t)length_));
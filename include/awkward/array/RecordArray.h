@@ -4,6 +4,7 @@
 #define AWKWARD_RECORDARRAY_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -42,6 +43,9 @@ namespace awkward {
     const std::vector<std::pair<std::string, FormPtr>>
       items() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -81,6 +85,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -105,6 +115,12 @@ namespace awkward {
   /// with each field.
   ///
   /// Fields are always ordered, whether tuples or records.
+  ///
+  /// A RecordArray made by #carry does not gather its fields right away:
+  /// it keeps the uncarried fields and the shared carry Index64, and each
+  /// field is carried (once, then cached) when #field, #contents, or any
+  /// operation that needs it asks for it. Selecting rows of a record with
+  /// many fields therefore costs only as much as the fields that are read.
   class EXPORT_SYMBOL RecordArray:
     public Content,
     public std::enable_shared_from_this<RecordArray> {
@@ -136,11 +152,34 @@ namespace awkward {
                 const ContentPtrVec& contents,
                 const util::RecordLookupPtr& recordlookup);
 
+    /// @brief Creates a RecordArray whose fields are `contents` carried by
+    /// `lazycarry`, without gathering any of them yet.
+    ///
+    /// The #length is the length of `lazycarry`, and every value in
+    /// `lazycarry` must be less than the length of every field.
+    RecordArray(const IdentitiesPtr& identities,
+                const util::Parameters& parameters,
+                const ContentPtrVec& contents,
+                const util::RecordLookupPtr& recordlookup,
+                const Index64& lazycarry);
+
     /// @brief `std::vector` of Content instances representing the
     /// (ordered) fields.
+    ///
+    /// If the fields have a pending #lazycarry, this carries all of them.
     const ContentPtrVec
       contents() const;
 
+    /// @brief Returns `true` if the fields have a pending #lazycarry that
+    /// is applied as each field is accessed; `false` otherwise.
+    bool
+      has_lazycarry() const;
+
+    /// @brief The carry Index64 that has not yet been applied to every
+    /// field, if #has_lazycarry.
+    const Index64
+      lazycarry() const;
+
     /// @brief A `std::shared_ptr<std::vector<std::string>>`
     /// optional list of key names.
     /// If absent (`nullptr`), the data are tuples; otherwise, they are
@@ -172,6 +211,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -198,6 +240,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -215,6 +262,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -284,6 +334,10 @@ namespace awkward {
     const ContentPtr
       merge(const ContentPtr& other) const override;
 
+    const ContentPtr
+      merge_many(const ContentPtrVec& others,
+                 bool mergebool) const override;
+
     const SliceItemPtr
       asslice() const override;
 
@@ -406,12 +460,39 @@ namespace awkward {
                                   const Slice& tail) const;
 
   private:
-    /// @brief See #contents.
+    /// @brief Returns field `fieldindex` with the #lazycarry (if any)
+    /// applied, carrying and caching it on first access.
+    const ContentPtr
+      carried_field(size_t fieldindex) const;
+
+    /// @brief Creates a RecordArray with the `start` to `stop` range of
+    /// this array's #lazycarry, reusing the fields that have already been
+    /// carried.
+    ///
+    /// @param fieldindexes For each field of the output, the index of the
+    /// field in this array that it takes.
+    const std::shared_ptr<RecordArray>
+      lazy_copy(const IdentitiesPtr& identities,
+                const std::vector<int64_t>& fieldindexes,
+                const util::RecordLookupPtr& recordlookup,
+                int64_t start,
+                int64_t stop) const;
+
+    /// @brief See #contents. If #has_lazycarry, these are the fields
+    /// before the #lazycarry.
     const ContentPtrVec contents_;
     /// @brief See #recordlookup.
     const util::RecordLookupPtr recordlookup_;
     /// @brief See #length.
     int64_t length_;
+    /// @brief See #has_lazycarry.
+    const bool has_lazycarry_;
+    /// @brief See #lazycarry.
+    const Index64 lazycarry_;
+    /// @brief Fields with #lazycarry_ applied; `nullptr` until accessed.
+    mutable ContentPtrVec carried_;
+    /// @brief Guards #carried_.
+    mutable std::mutex carried_mutex_;
   };
 }
 
@@ -3,6 +3,7 @@
 #ifndef AWKWARD_VIRTUALARRAY_H_
 #define AWKWARD_VIRTUALARRAY_H_
 
+#include <functional>
 #include <string>
 #include <memory>
 #include <vector>
@@ -34,6 +35,9 @@ namespace awkward {
     bool
       has_length() const;
 
+    FormKind
+      kind() const override;
+
     const TypePtr
       type(const util::TypeStrs& typestrs) const override;
 
@@ -73,6 +77,12 @@ namespace awkward {
     const std::vector<std::string>
       keys() const override;
 
+    const FormPtr
+      getitem_field(const std::string& key) const override;
+
+    const FormPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
     bool
       equal(const FormPtr& other,
             bool check_identities,
@@ -136,9 +146,36 @@ namespace awkward {
     /// @brief Ensures that the array is generated and returns it.
     ///
     /// This method *does not* return `nullptr`.
+    ///
+    /// Generation is single-flight: if another thread is already generating
+    /// the array for the same #cache and #cache_key, this thread waits for
+    /// its result (or exception) instead of generating it again. The #cache
+    /// is only filled when the array is generated, not on a hit.
     const ContentPtr
       array() const;
 
+    /// @brief Starts generating each of the `arrays` on a process-wide
+    /// pool of background threads and returns immediately.
+    ///
+    /// Generated arrays are put in their #cache, so arrays without a cache
+    /// are skipped. Calling #array while a prefetch is in progress waits for
+    /// it rather than generating the array again. Exceptions raised by a
+    /// prefetch are discarded; they will be raised again by #array.
+    static void
+      prefetch(const std::vector<std::shared_ptr<VirtualArray>>& arrays);
+
+    /// @brief Function that runs `wait`, a blocking wait for another
+    /// thread's generation, in #array.
+    using WaitWrapper =
+      std::function<void(const std::function<void()>& wait)>;
+
+    /// @brief Sets the WaitWrapper for all VirtualArrays in the process.
+    ///
+    /// A host language can use it to release its own locks while waiting,
+    /// if generators on other threads need them (e.g. Python's GIL).
+    static void
+      set_wait_wrapper(const WaitWrapper& wrapper);
+
     /// @brief The key this VirtualArray will use when filling a #cache.
     const std::string
       cache_key() const;
@@ -147,6 +184,9 @@ namespace awkward {
     const std::string
       classname() const override;
 
+    ContentKind
+      kind() const override;
+
     void
       setidentities() override;
 
@@ -173,6 +213,11 @@ namespace awkward {
     void
       tojson_part(ToJson& builder, bool include_beginendlist) const override;
 
+    void
+      tojson_elements(ToJson& builder,
+                      int64_t start,
+                      int64_t stop) const override;
+
     /// @copydoc Content::nbytes_part
     ///
     /// The bytes of materialized arrays are not counted, so the
@@ -191,6 +236,9 @@ namespace awkward {
                 bool copyindexes,
                 bool copyidentities) const override;
 
+    const ContentPtr
+      pack() const override;
+
     void
       check_for_iteration() const override;
 
@@ -22,7 +22,9 @@ namespace awkward {
     /// @param resize The factor with which a GrowableBuffer is resized
     /// when its {@link GrowableBuffer#length length} reaches its
     /// {@link GrowableBuffer#reserved reserved}.
-    ArrayBuilderOptions(int64_t initial, double resize);
+    /// @param paged If `true`, a GrowableBuffer grows by adding pages
+    /// instead of reallocating and copying; see #paged.
+    ArrayBuilderOptions(int64_t initial, double resize, bool paged = false);
 
     /// @brief The initial number of
     /// {@link GrowableBuffer#reserved reserved} entries for a GrowableBuffer.
@@ -35,11 +37,27 @@ namespace awkward {
     double
       resize() const;
 
+    /// @brief If `true`, a GrowableBuffer that runs out of space keeps its
+    /// filled buffer as a page and appends into a new page that is
+    /// {@link #resize resize} times larger, rather than copying everything
+    /// into a larger buffer.
+    ///
+    /// The pages are concatenated once, when the
+    /// {@link GrowableBuffer#ptr GrowableBuffer::ptr} is requested (for
+    /// instance by {@link ArrayBuilder#snapshot ArrayBuilder::snapshot}),
+    /// which is zero-copy if there is only one page. This avoids the
+    /// repeated copying and the peak memory of reallocation when building
+    /// very large arrays.
+    bool
+      paged() const;
+
   private:
     /// See #initial.
     int64_t initial_;
     /// See #resize.
     double resize_;
+    /// See #paged.
+    bool paged_;
   };
 }
 
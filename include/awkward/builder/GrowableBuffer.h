@@ -5,6 +5,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #include "awkward/common.h"
 #include "awkward/builder/ArrayBuilderOptions.h"
@@ -39,6 +40,11 @@ namespace awkward {
   /// delete or take advantage of. However, many operations require buffers
   /// to be rewritten; under normal circumstances, it would soon be replaced
   /// by a more appropriately sized buffer.
+  ///
+  /// If {@link ArrayBuilderOptions#paged ArrayBuilderOptions::paged}, a full
+  /// buffer is not copied into a larger one; it is kept as a page and
+  /// appending continues in a new page. #ptr returns the pages concatenated
+  /// into a new buffer; #join concatenates them in place.
   template <typename T>
   class EXPORT_SYMBOL GrowableBuffer {
   public:
@@ -102,9 +108,21 @@ namespace awkward {
     GrowableBuffer(const ArrayBuilderOptions& options);
 
     /// @brief Reference-counted pointer to the array buffer.
+    ///
+    /// If the GrowableBuffer is
+    /// {@link ArrayBuilderOptions#paged ArrayBuilderOptions::paged} and has
+    /// more than one page, this is a new buffer of exactly #length elements
+    /// concatenated from them; the GrowableBuffer itself is not modified, so
+    /// concurrent calls are safe. With only one page, no data are copied.
     const std::shared_ptr<T>
       ptr() const;
 
+    /// @brief Concatenates the pages (if there are more than one) into a
+    /// single page of exactly #length elements, so that #reserved becomes
+    /// #length and subsequent calls to #ptr copy nothing.
+    void
+      join();
+
     /// @brief Currently used number of elements.
     ///
     /// Although the #length increments every time #append is called,
@@ -130,7 +148,9 @@ namespace awkward {
     /// The parameter only guarantees that at least `minreserved` is reserved;
     /// if an amount less than #reserved is requested, nothing changes.
     ///
-    /// If #reserved actually changes, #ptr is reallocated.
+    /// If #reserved actually changes, #ptr is reallocated, or if
+    /// {@link ArrayBuilderOptions#paged ArrayBuilderOptions::paged}, a new
+    /// page is added.
     void
       set_reserved(int64_t minreserved);
 
@@ -148,7 +168,7 @@ namespace awkward {
     /// reallocation.
     ///
     /// This increases the #length by 1; if the new #length is larger than
-    /// #reserved, a new #ptr will be allocated.
+    /// #reserved, a new #ptr will be allocated (or a new page added).
     void
       append(T datum);
 
@@ -157,10 +177,30 @@ namespace awkward {
     T
       getitem_at_nowrap(int64_t at) const;
 
+    /// @brief Number of pages that #ptr would concatenate (always `1`
+    /// unless {@link ArrayBuilderOptions#paged ArrayBuilderOptions::paged}).
+    int64_t
+      numpages() const;
+
   private:
+    /// @brief Returns a new buffer of the #length elements in all pages.
+    const std::shared_ptr<T>
+      concatenated() const;
+
+    /// @brief Keeps the current page as a full page and starts a new one
+    /// with room for at least `minreserved` elements in total.
+    void
+      add_page(int64_t minreserved);
+
     const ArrayBuilderOptions options_;
-    // @brief See #ptr.
+    // @brief The current (last) page; see #ptr.
     std::shared_ptr<T> ptr_;
+    // @brief Filled pages before the current one, in order.
+    std::vector<std::shared_ptr<T>> pages_;
+    // @brief Number of elements in each of the #pages_.
+    std::vector<int64_t> pagelengths_;
+    // @brief Position in the array of the first element of #ptr_.
+    int64_t offset_;
     // @brief See #length.
     int64_t length_;
     // @brief See #reserved.
@@ -0,0 +1,444 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_TYPEDARRAYBUILDER_H_
+#define AWKWARD_TYPEDARRAYBUILDER_H_
+
+#include <string>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Content.h"
+#include "awkward/type/Type.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+namespace awkward {
+  /// @class TypedArrayBuilder
+  ///
+  /// @brief Fills an array whose Form is known in advance, with the same
+  /// interface as ArrayBuilder but without type discovery.
+  ///
+  /// The Form is translated into a fixed tree of nodes when the
+  /// TypedArrayBuilder is constructed. Each command appends directly to
+  /// the GrowableBuffer of the node it addresses, in the node's own type
+  /// (e.g. `int32` or `float32` numbers, `i32` offsets); nodes are never
+  /// replaced. A command that does not fit the Form (e.g. `real` where an
+  /// integer is expected, an integer out of range of its type, or `null`
+  /// where the Form has no option type) raises an error instead of
+  /// changing the type. The only conversion is that #integer is accepted
+  /// for floating-point data.
+  ///
+  /// Supported Forms are NumpyForm (any primitive, without inner
+  /// dimensions), ListOffsetForm and ListForm (including strings and
+  /// bytestrings), RegularForm, RecordForm (records and tuples),
+  /// IndexedOptionForm, ByteMaskedForm, BitMaskedForm, UnmaskedForm,
+  /// EmptyForm, and VirtualForm with a known Form (built as its Form).
+  /// The #snapshot has exactly the #form; the content of a missing value
+  /// in a ByteMaskedForm or BitMaskedForm is filled with zeros and empty
+  /// lists.
+  class EXPORT_SYMBOL TypedArrayBuilder {
+  public:
+    /// @brief Creates a TypedArrayBuilder from a full set of parameters.
+    ///
+    /// @param form The Form of the array to build.
+    /// @param options Configuration options for the GrowableBuffer of
+    /// each node.
+    TypedArrayBuilder(const FormPtr& form,
+                      const ArrayBuilderOptions& options);
+
+    /// @brief Returns a string representation of this array (single-line XML
+    /// indicating the length and type).
+    const std::string
+      tostring() const;
+
+    /// @brief The Form of the array being built.
+    const FormPtr
+      form() const;
+
+    /// @brief Current length of the accumulated array.
+    int64_t
+      length() const;
+
+    /// @brief Removes all accumulated data and any unfinished list, tuple,
+    /// or record.
+    void
+      clear();
+
+    /// @brief High level Type of the accumulated array (derived from the
+    /// #form).
+    ///
+    /// @param typestrs A mapping from `"__record__"` parameters to string
+    /// representations of those types, to override the derived strings.
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const;
+
+    /// @brief Turns the accumulated data into a Content array.
+    ///
+    /// As with ArrayBuilder, the buffers are shared between the
+    /// TypedArrayBuilder and the Content.
+    ///
+    /// Raises an error if a list, tuple, or record has been started but not
+    /// finished.
+    const ContentPtr
+      snapshot() const;
+
+    /// @brief Adds a `null` value to the accumulated data.
+    void
+      null();
+
+    /// @brief Adds a boolean value `x` to the accumulated data.
+    void
+      boolean(bool x);
+
+    /// @brief Adds an integer value `x` to the accumulated data.
+    void
+      integer(int64_t x);
+
+    /// @brief Adds a real value `x` to the accumulated data.
+    void
+      real(double x);
+
+    /// @brief Adds an unencoded, null-terminated bytestring value `x` to the
+    /// accumulated data.
+    void
+      bytestring(const char* x);
+
+    /// @brief Adds an unencoded bytestring value `x` with a given `length`
+    /// to the accumulated data.
+    ///
+    /// The string does not need to be null-terminated.
+    void
+      bytestring(const char* x, int64_t length);
+
+    /// @brief Adds an unencoded bytestring `x` in STL format to the
+    /// accumulated data.
+    void
+      bytestring(const std::string& x);
+
+    /// @brief Adds a UTF-8 encoded, null-terminated bytestring value `x` to
+    /// the accumulated data.
+    void
+      string(const char* x);
+
+    /// @brief Adds a UTF-8 encoded bytestring value `x` with a given `length`
+    /// to the accumulated data.
+    ///
+    /// The string does not need to be null-terminated.
+    void
+      string(const char* x, int64_t length);
+
+    /// @brief Adds a UTF-8 encoded bytestring `x` in STL format to the
+    /// accumulated data.
+    void
+      string(const std::string& x);
+
+    /// @brief Begins building a nested list.
+    void
+      beginlist();
+
+    /// @brief Ends a nested list.
+    void
+      endlist();
+
+    /// @brief Begins building a tuple with a fixed number of fields, which
+    /// must match the number in the #form.
+    void
+      begintuple(int64_t numfields);
+
+    /// @brief Sets the pointer to a given tuple field index; the next
+    /// command will fill that slot.
+    void
+      index(int64_t index);
+
+    /// @brief Ends a tuple.
+    void
+      endtuple();
+
+    /// @brief Begins building a record without a name.
+    void
+      beginrecord();
+
+    /// @brief Begins building a record with a name, which must match the
+    /// `"__record__"` parameter of the #form if it has one.
+    void
+      beginrecord(const char* name);
+
+    /// @brief Sets the pointer to a given record field `key`; the next
+    /// command will fill that slot.
+    ///
+    /// Keys are found in a hash table made for each record when the
+    /// TypedArrayBuilder is constructed, so the order in which fields are
+    /// filled does not matter.
+    void
+      field(const char* key);
+
+    /// @brief Sets the pointer to a given record field `key` with a given
+    /// `length`, which does not need to be null-terminated.
+    void
+      field(const char* key, int64_t length);
+
+    /// @brief Sets the pointer to a given record field `key`, given as an
+    /// STL string.
+    void
+      field(const std::string& key);
+
+    /// @brief Ends a record, checking that every field has been filled.
+    void
+      endrecord();
+
+  private:
+    /// @brief The kinds of node that a #form is translated into; numbers
+    /// (and the offsets or index of a node) are kinds of their own.
+    enum class Kind: int {
+      empty,
+      boolean,
+      int8,
+      int16,
+      int32,
+      int64,
+      uint8,
+      uint16,
+      uint32,
+      uint64,
+      float32,
+      float64,
+      string,
+      list,
+      regular,
+      record,
+      tuple,
+      indexedoption,
+      bytemasked,
+      bitmasked,
+      unmasked
+    };
+
+    /// @brief One node of the fixed tree.
+    struct Node {
+      Kind kind;
+      FormPtr form;
+      /// @brief Number of completed items.
+      int64_t length;
+      /// @brief The data buffer of a number or boolean, the offsets of a
+      /// list or string, the index of an IndexedOptionForm, or the mask
+      /// bytes of a ByteMaskedForm or BitMaskedForm (a position in the
+      /// buffers of #index's or #kind's type).
+      int64_t buffer;
+      /// @brief The type of the offsets or index in #buffer.
+      Kind index;
+      /// @brief For ByteMaskedForm, the mask byte of a valid item.
+      bool valid_when;
+      /// @brief For strings, the position of the characters in #uint8s_.
+      int64_t chars;
+      /// @brief For lists and options, the position of the content node.
+      int64_t content;
+      /// @brief For records and tuples, the positions of the field nodes.
+      std::vector<int64_t> contents;
+      /// @brief For records, the field names.
+      std::vector<std::string> keys;
+      /// @brief For records, an open-addressing hash table from field name
+      /// to field index (`-1` for empty slots); its size is a power of 2.
+      std::vector<int64_t> lookup;
+      /// @brief For regular lists, the size of each list.
+      int64_t size;
+    };
+
+    /// @brief A list, tuple, or record that is being filled.
+    struct Frame {
+      int64_t node;
+      /// @brief Length of the content when a regular list was started.
+      int64_t start;
+      /// @brief The record or tuple field that the next command will fill.
+      int64_t field;
+    };
+
+    /// @brief Translates a Form into nodes, returning the position of its
+    /// top node.
+    int64_t
+      compile(const FormPtr& form);
+
+    /// @brief Adds an empty buffer of a given `kind` of number, returning
+    /// its position.
+    int64_t
+      newbuffer(Kind kind);
+
+    /// @brief Appends `x` to the buffer at `buffer` of a given `kind` of
+    /// integer, raising an error if it is out of that type's range.
+    void
+      append_integer(Kind kind, int64_t buffer, int64_t x);
+
+    /// @brief The node that the next `command` fills: the root, the
+    /// content of the current list, or the current field of the current
+    /// tuple or record.
+    int64_t
+      next(const char* command) const;
+
+    /// @brief The first node at or below `node` that is not an option type.
+    int64_t
+      resolve(int64_t node) const;
+
+    /// @brief Records a valid item in each option type from `node` down to
+    /// (not including) #resolve of `node`.
+    void
+      fill_options(int64_t node);
+
+    /// @brief Appends a placeholder item (zero, empty list, etc.) to a node
+    /// under a missing value of a ByteMaskedForm or BitMaskedForm.
+    void
+      fill_placeholder(int64_t node);
+
+    /// @brief Number of completed items in a node (looking through
+    /// UnmaskedForm nodes, which do not count their own).
+    int64_t
+      nodelength(int64_t node) const;
+
+    /// @brief Raises the error for a `command` that does not fit the Form
+    /// of a `node`.
+    [[noreturn]] void
+      mismatch(const char* command, int64_t node) const;
+
+    /// @brief Common implementation of #string and #bytestring.
+    void
+      string(const char* x, int64_t length, bool utf8);
+
+    /// @brief Common implementation of #endtuple and #endrecord.
+    void
+      endfields(Kind kind, const char* command, const char* begin);
+
+    /// @brief Turns one node into a Content array.
+    const ContentPtr
+      snapshot(int64_t node) const;
+
+    const FormPtr form_;
+    const ArrayBuilderOptions options_;
+    std::vector<Node> nodes_;
+    std::vector<Frame> stack_;
+    std::vector<GrowableBuffer<int8_t>> int8s_;
+    std::vector<GrowableBuffer<int16_t>> int16s_;
+    std::vector<GrowableBuffer<int32_t>> int32s_;
+    std::vector<GrowableBuffer<int64_t>> int64s_;
+    std::vector<GrowableBuffer<uint8_t>> uint8s_;
+    std::vector<GrowableBuffer<uint16_t>> uint16s_;
+    std::vector<GrowableBuffer<uint32_t>> uint32s_;
+    std::vector<GrowableBuffer<uint64_t>> uint64s_;
+    std::vector<GrowableBuffer<float>> float32s_;
+    std::vector<GrowableBuffer<double>> float64s_;
+  };
+}
+
+extern "C" {
+  /// @brief C interface to the
+  /// {@link awkward::TypedArrayBuilder#TypedArrayBuilder TypedArrayBuilder}
+  /// constructor.
+  ///
+  /// The `form` is given as JSON (see
+  /// {@link awkward::Form#fromjson Form::fromjson}); the new
+  /// TypedArrayBuilder is returned in `result` and must be released with
+  /// #awkward_TypedArrayBuilder_delete.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_new(const char* form,
+                                  int64_t initial,
+                                  double resize,
+                                  void** result);
+
+  /// @brief Releases a TypedArrayBuilder made by
+  /// #awkward_TypedArrayBuilder_new.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_delete(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#length TypedArrayBuilder::length}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_length(void* typedarraybuilder,
+                                     int64_t* result);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#clear TypedArrayBuilder::clear}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_clear(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#null TypedArrayBuilder::null}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_null(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#boolean TypedArrayBuilder::boolean}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_boolean(void* typedarraybuilder,
+                                      bool x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#integer TypedArrayBuilder::integer}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_integer(void* typedarraybuilder,
+                                      int64_t x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#real TypedArrayBuilder::real}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_real(void* typedarraybuilder,
+                                   double x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#bytestring TypedArrayBuilder::bytestring}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_bytestring_length(void* typedarraybuilder,
+                                                const char* x,
+                                                int64_t length);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#string TypedArrayBuilder::string}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_string_length(void* typedarraybuilder,
+                                            const char* x,
+                                            int64_t length);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#beginlist TypedArrayBuilder::beginlist}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_beginlist(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endlist TypedArrayBuilder::endlist}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endlist(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#begintuple TypedArrayBuilder::begintuple}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_begintuple(void* typedarraybuilder,
+                                         int64_t numfields);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#index TypedArrayBuilder::index}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_index(void* typedarraybuilder,
+                                    int64_t index);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endtuple TypedArrayBuilder::endtuple}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endtuple(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#beginrecord TypedArrayBuilder::beginrecord}.
+  ///
+  /// The `name` may be `nullptr`.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_beginrecord(void* typedarraybuilder,
+                                          const char* name);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#field TypedArrayBuilder::field}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_field(void* typedarraybuilder,
+                                    const char* key);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endrecord TypedArrayBuilder::endrecord}.
+  EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endrecord(void* typedarraybuilder);
+}
+
+#endif // AWKWARD_TYPEDARRAYBUILDER_H_
@@ -22,7 +22,11 @@
   typedef   signed   __int64 int64_t;
   #define ERROR Error
 #else
-  #define EXPORT_SYMBOL __attribute__((visibility("default")))
+  // Predefined as hidden for the per-level SIMD cpu-kernels, so that only
+  // their dispatched names are exported (see CMakeLists.txt).
+  #ifndef EXPORT_SYMBOL
+    #define EXPORT_SYMBOL __attribute__((visibility("default")))
+  #endif
   #include <cstddef>
   #include <cstdint>
   #define ERROR struct Error
@@ -81,6 +81,12 @@ extern "C" {
       int64_t fromindexoffset,
       int64_t lenfromindex,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_index_carry_check_64(
+      const int64_t* carry,
+      int64_t carryoffset,
+      int64_t lenfromindex,
+      int64_t length);
 
   EXPORT_SYMBOL struct Error
     awkward_index8_carry_nocheck_64(
@@ -1044,6 +1050,49 @@ extern "C" {
       int64_t length,
       bool validwhen);
 
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_numnull(
+      int64_t* numnull,
+      const uint8_t* bitmask,
+      int64_t bitmaskoffset,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_getitem_nextcarry_64(
+      int64_t* tocarry,
+      const uint8_t* bitmask,
+      int64_t bitmaskoffset,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_getitem_nextcarry_outindex_64(
+      int64_t* tocarry,
+      int64_t* outindex,
+      const uint8_t* bitmask,
+      int64_t bitmaskoffset,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_getitem_carry_64(
+      uint8_t* tobitmask,
+      const uint8_t* frombitmask,
+      int64_t bitmaskoffset,
+      int64_t length,
+      const int64_t* fromcarry,
+      int64_t lencarry,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_getitem_range(
+      uint8_t* tobitmask,
+      const uint8_t* frombitmask,
+      int64_t bitmaskoffset,
+      int64_t start,
+      int64_t length,
+      bool lsb_order);
+
 }
 
 #endif // AWKWARDCPU_GETITEM_H_
@@ -0,0 +1,56 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARDCPU_PARALLEL_H_
+#define AWKWARDCPU_PARALLEL_H_
+
+#include "awkward/common.h"
+
+// Opt-in parallel execution of cpu-kernels that are independent across
+// their output index. By default, only one thread is used; with more,
+// kernel calls whose length is at least the threshold are split into
+// chunks and run on an internal thread pool. Results (including which
+// error is reported, if any) are the same as in a single thread.
+//
+// At load time, the thread count and threshold are taken from the
+// AWKWARD_NUM_THREADS ("auto" or 0 for all cores) and
+// AWKWARD_PARALLEL_THRESHOLD environment variables, if set.
+
+extern "C" {
+  const int64_t kParallelThreshold = 1048576;   // 2**20 items
+
+  EXPORT_SYMBOL int64_t
+    awkward_cpu_kernels_num_threads();
+  EXPORT_SYMBOL struct Error
+    awkward_cpu_kernels_set_num_threads(
+      int64_t num_threads);
+  EXPORT_SYMBOL int64_t
+    awkward_cpu_kernels_parallel_threshold();
+  EXPORT_SYMBOL struct Error
+    awkward_cpu_kernels_set_parallel_threshold(
+      int64_t threshold);
+  EXPORT_SYMBOL struct Error
+    awkward_cpu_kernels_parallel_for(
+      int64_t length,
+      struct Error (*body)(void* closure, int64_t start, int64_t stop),
+      void* closure);
+}
+
+// Helper for kernel implementations: runs body(start, stop) over chunks
+// of [0, length), which must not depend on one another. Internal linkage,
+// because the kernels are compiled once per SIMD level.
+template <typename BODY>
+static struct Error
+  parallel_for_chunk(void* closure, int64_t start, int64_t stop) {
+    return (*reinterpret_cast<const BODY*>(closure))(start, stop);
+  }
+
+template <typename BODY>
+static struct Error
+  parallel_for(int64_t length, const BODY& body) {
+    return awkward_cpu_kernels_parallel_for(
+      length,
+      &parallel_for_chunk<BODY>,
+      const_cast<void*>(reinterpret_cast<const void*>(&body)));
+  }
+
+#endif // AWKWARDCPU_PARALLEL_H_
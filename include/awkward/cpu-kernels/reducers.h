@@ -1086,10 +1086,2776 @@ extern "C" {
       int64_t lenparents,
       int64_t outlength);
 
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_count_offsets32_64(
+      int64_t* toptr,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_count_offsetsU32_64(
+      int64_t* toptr,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_count_offsets_64(
+      int64_t* toptr,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_bool_offsets32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_bool_offsetsU32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_bool_offsets_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int8_offsets32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int8_offsetsU32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int8_offsets_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint8_offsets32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint8_offsetsU32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint8_offsets_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int16_offsets32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int16_offsetsU32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int16_offsets_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint16_offsets32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint16_offsetsU32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint16_offsets_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int32_offsets32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int32_offsetsU32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int32_offsets_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint32_offsets32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint32_offsetsU32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint32_offsets_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint64_offsets32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint64_offsetsU32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint64_offsets_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float32_offsets32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float32_offsetsU32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float32_offsets_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float64_offsets32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float64_offsetsU32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float64_offsets_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_bool_offsets32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_bool_offsetsU32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_bool_offsets_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int8_offsets32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int8_offsetsU32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int8_offsets_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint8_offsets32_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint8_offsetsU32_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint8_offsets_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int16_offsets32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int16_offsetsU32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int16_offsets_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint16_offsets32_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint16_offsetsU32_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint16_offsets_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int32_offsets32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int32_offsetsU32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int32_offsets_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint32_offsets32_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint32_offsetsU32_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint32_offsets_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint64_offsets32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint64_offsetsU32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint64_offsets_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float32_float32_offsets32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float32_float32_offsetsU32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float32_float32_offsets_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float64_float64_offsets32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float64_float64_offsetsU32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float64_float64_offsets_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_bool_offsets32_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_bool_offsetsU32_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_bool_offsets_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int8_offsets32_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int8_offsetsU32_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int8_offsets_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint8_offsets32_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint8_offsetsU32_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint8_offsets_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int16_offsets32_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int16_offsetsU32_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int16_offsets_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint16_offsets32_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint16_offsetsU32_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint16_offsets_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int32_offsets32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int32_offsetsU32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int32_offsets_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint32_offsets32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint32_offsetsU32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint32_offsets_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_bool_offsets32_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_bool_offsetsU32_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_bool_offsets_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int8_offsets32_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int8_offsetsU32_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int8_offsets_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint8_offsets32_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint8_offsetsU32_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint8_offsets_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int16_offsets32_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int16_offsetsU32_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int16_offsets_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint16_offsets32_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint16_offsetsU32_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint16_offsets_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int32_offsets32_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int32_offsetsU32_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int32_offsets_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint32_offsets32_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint32_offsetsU32_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint32_offsets_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int64_offsets32_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int64_offsetsU32_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int64_offsets_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint64_offsets32_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint64_offsetsU32_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint64_offsets_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float32_offsets32_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float32_offsetsU32_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float32_offsets_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float64_offsets32_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float64_offsetsU32_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float64_offsets_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_bool_offsets32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_bool_offsetsU32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_bool_offsets_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int8_offsets32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int8_offsetsU32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int8_offsets_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint8_offsets32_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint8_offsetsU32_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint8_offsets_64(
+      uint64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int16_offsets32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int16_offsetsU32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int16_offsets_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint16_offsets32_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint16_offsetsU32_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint16_offsets_64(
+      uint64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int32_offsets32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int32_offsetsU32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int32_offsets_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint32_offsets32_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint32_offsetsU32_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint32_offsets_64(
+      uint64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint64_offsets32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint64_offsetsU32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint64_offsets_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float32_float32_offsets32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float32_float32_offsetsU32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float32_float32_offsets_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float64_float64_offsets32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float64_float64_offsetsU32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float64_float64_offsets_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_bool_offsets32_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_bool_offsetsU32_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_bool_offsets_64(
+      int32_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int8_offsets32_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int8_offsetsU32_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int8_offsets_64(
+      int32_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint8_offsets32_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint8_offsetsU32_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint8_offsets_64(
+      uint32_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int16_offsets32_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int16_offsetsU32_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int16_offsets_64(
+      int32_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint16_offsets32_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint16_offsetsU32_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint16_offsets_64(
+      uint32_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int32_offsets32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int32_offsetsU32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int32_offsets_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint32_offsets32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint32_offsetsU32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint32_offsets_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_bool_offsets32_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_bool_offsetsU32_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_bool_offsets_64(
+      bool* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int8_offsets32_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int8_offsetsU32_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int8_offsets_64(
+      bool* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint8_offsets32_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint8_offsetsU32_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint8_offsets_64(
+      bool* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int16_offsets32_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int16_offsetsU32_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int16_offsets_64(
+      bool* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint16_offsets32_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint16_offsetsU32_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint16_offsets_64(
+      bool* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int32_offsets32_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int32_offsetsU32_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int32_offsets_64(
+      bool* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint32_offsets32_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint32_offsetsU32_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint32_offsets_64(
+      bool* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int64_offsets32_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int64_offsetsU32_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int64_offsets_64(
+      bool* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint64_offsets32_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint64_offsetsU32_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint64_offsets_64(
+      bool* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float32_offsets32_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float32_offsetsU32_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float32_offsets_64(
+      bool* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float64_offsets32_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float64_offsetsU32_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float64_offsets_64(
+      bool* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int8_int8_offsets32_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int8_int8_offsetsU32_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int8_int8_offsets_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint8_uint8_offsets32_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint8_uint8_offsetsU32_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint8_uint8_offsets_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int16_int16_offsets32_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int16_int16_offsetsU32_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int16_int16_offsets_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint16_uint16_offsets32_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint16_uint16_offsetsU32_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint16_uint16_offsets_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int32_int32_offsets32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int32_int32_offsetsU32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int32_int32_offsets_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint32_uint32_offsets32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint32_uint32_offsetsU32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint32_uint32_offsets_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int64_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int64_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int64_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint64_uint64_offsets32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint64_uint64_offsetsU32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint64_uint64_offsets_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float32_float32_offsets32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float32_float32_offsetsU32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float32_float32_offsets_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float64_float64_offsets32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float64_float64_offsetsU32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float64_float64_offsets_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int8_int8_offsets32_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int8_int8_offsetsU32_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int8_int8_offsets_64(
+      int8_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint8_uint8_offsets32_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint8_uint8_offsetsU32_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint8_uint8_offsets_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint8_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int16_int16_offsets32_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int16_int16_offsetsU32_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int16_int16_offsets_64(
+      int16_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint16_uint16_offsets32_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint16_uint16_offsetsU32_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint16_uint16_offsets_64(
+      uint16_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint16_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int32_int32_offsets32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int32_int32_offsetsU32_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int32_int32_offsets_64(
+      int32_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint32_uint32_offsets32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint32_uint32_offsetsU32_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint32_uint32_offsets_64(
+      uint32_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint32_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int64_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int64_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int64_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      int64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint64_uint64_offsets32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint64_uint64_offsetsU32_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint64_uint64_offsets_64(
+      uint64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      uint64_t identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float32_float32_offsets32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float32_float32_offsetsU32_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float32_float32_offsets_64(
+      float* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      float identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float64_float64_offsets32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float64_float64_offsetsU32_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float64_float64_offsets_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength,
+      double identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_bool_offsets32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_bool_offsetsU32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_bool_offsets_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int8_offsets32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int8_offsetsU32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int8_offsets_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint8_offsets32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint8_offsetsU32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint8_offsets_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int16_offsets32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int16_offsetsU32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int16_offsets_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint16_offsets32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint16_offsetsU32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint16_offsets_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int32_offsets32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int32_offsetsU32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int32_offsets_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint32_offsets32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint32_offsetsU32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint32_offsets_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint64_offsets32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint64_offsetsU32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint64_offsets_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float32_offsets32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float32_offsetsU32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float32_offsets_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float64_offsets32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float64_offsetsU32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float64_offsets_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_bool_offsets32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_bool_offsetsU32_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_bool_offsets_64(
+      int64_t* toptr,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int8_offsets32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int8_offsetsU32_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int8_offsets_64(
+      int64_t* toptr,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint8_offsets32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint8_offsetsU32_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint8_offsets_64(
+      int64_t* toptr,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int16_offsets32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int16_offsetsU32_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int16_offsets_64(
+      int64_t* toptr,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint16_offsets32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint16_offsetsU32_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint16_offsets_64(
+      int64_t* toptr,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int32_offsets32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int32_offsetsU32_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int32_offsets_64(
+      int64_t* toptr,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint32_offsets32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint32_offsetsU32_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint32_offsets_64(
+      int64_t* toptr,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int64_offsets32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int64_offsetsU32_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int64_offsets_64(
+      int64_t* toptr,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint64_offsets32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint64_offsetsU32_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint64_offsets_64(
+      int64_t* toptr,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float32_offsets32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float32_offsetsU32_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float32_offsets_64(
+      int64_t* toptr,
+      const float* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float64_offsets32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float64_offsetsU32_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float64_offsets_64(
+      int64_t* toptr,
+      const double* fromptr,
+      int64_t fromptroffset,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
   EXPORT_SYMBOL struct Error
     awkward_content_reduce_zeroparents_64(
       int64_t* toparents,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_global_startstop_64(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_global_startstop_64(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_global_startstop_64(
       int64_t* globalstart,
@@ -1098,6 +3864,20 @@ extern "C" {
       int64_t offsetsoffset,
       int64_t length);
 
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_nonlocal_maxcount_offsetscopy_64(
+      int64_t* maxcount,
+      int64_t* offsetscopy,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_nonlocal_maxcount_offsetscopy_64(
+      int64_t* maxcount,
+      int64_t* offsetscopy,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
       int64_t* maxcount,
@@ -1105,6 +3885,36 @@ extern "C" {
       const int64_t* offsets,
       int64_t offsetsoffset,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_nonlocal_preparenext_64(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t nextlen,
+      int64_t* maxnextparents,
+      int64_t* distincts,
+      int64_t distinctslen,
+      int64_t* offsetscopy,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t maxcount);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_nonlocal_preparenext_64(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t nextlen,
+      int64_t* maxnextparents,
+      int64_t* distincts,
+      int64_t distinctslen,
+      int64_t* offsetscopy,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t maxcount);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
       int64_t* nextcarry,
@@ -1140,12 +3950,42 @@ extern "C" {
       const int64_t* gaps,
       int64_t outlength);
 
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_local_nextparents_64(
+      int64_t* nextparents,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+      int64_t* nextparents,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_local_nextparents_64(
       int64_t* nextparents,
       const int64_t* offsets,
       int64_t offsetsoffset,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_local_starts_64(
+      int64_t* starts,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_local_starts_64(
+      int64_t* starts,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray_reduce_local_starts_64(
+      int64_t* starts,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_local_outoffsets_64(
       int64_t* outoffsets,
@@ -1201,6 +4041,25 @@ extern "C" {
       int64_t lenparents,
       int64_t outlength);
 
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_reduce_mask_bytemaskedarray_offsets32_64(
+      int8_t* toptr,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_reduce_mask_bytemaskedarray_offsetsU32_64(
+      int8_t* toptr,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64(
+      int8_t* toptr,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength);
+
   EXPORT_SYMBOL struct Error
     awkward_bytemaskedarray_reduce_next_64(
       int64_t* nextcarry,
@@ -1213,6 +4072,19 @@ extern "C" {
       int64_t length,
       bool validwhen);
 
+  EXPORT_SYMBOL struct Error
+    awkward_bitmaskedarray_reduce_next_64(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* outindex,
+      const uint8_t* bitmask,
+      int64_t bitmaskoffset,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+
 }
 
 #endif // AWKWARDCPU_REDUCERS_H_
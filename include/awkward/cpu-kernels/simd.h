@@ -0,0 +1,29 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARDCPU_SIMD_H_
+#define AWKWARDCPU_SIMD_H_
+
+#include "awkward/common.h"
+
+// Instruction-set levels of the cpu-kernels. When the library is built
+// with BUILD_SIMD_KERNELS, every kernel exists in all three levels and its
+// name is bound to one of them when the library is loaded; otherwise, only
+// the baseline exists and the level cannot be raised.
+//
+// The bound level is the highest one that the CPU supports, unless the
+// AWKWARD_SIMD_LEVEL environment variable names a lower one ("baseline",
+// "avx2", "avx512", or the corresponding number). The level is bound when
+// the library is initialized and cannot change afterward.
+
+extern "C" {
+  const int64_t kSimdBaseline = 0;   // compiler defaults (SSE2 on x86_64)
+  const int64_t kSimdAVX2     = 1;   // AVX2 and FMA
+  const int64_t kSimdAVX512   = 2;   // AVX-512 F, CD, BW, DQ, and VL
+
+  EXPORT_SYMBOL int64_t
+    awkward_cpu_kernels_simd_supported();
+  EXPORT_SYMBOL int64_t
+    awkward_cpu_kernels_simd_level();
+}
+
+#endif // AWKWARDCPU_SIMD_H_
@@ -12,6 +12,24 @@
 
 namespace awkward {
   class Content;
+  class Form;
+  using FormPtr = std::shared_ptr<Form>;
+  class PartitionedArray;
+  using PartitionedArrayPtr = std::shared_ptr<PartitionedArray>;
+
+  /// @brief The JSON library that parses input for #FromJsonString and
+  /// #FromJsonFile.
+  ///
+  /// `rapidjson` streams SAX events into the ArrayBuilder. `simdjson`
+  /// parses the whole document into a tape first and then walks that tape;
+  /// it is much faster, but it is only available if awkward1 was compiled
+  /// with `BUILD_SIMDJSON`, which is the default (see
+  /// #JsonParserAvailable).
+  enum class JsonParser {rapidjson, simdjson};
+
+  /// @brief Returns `true` if `parser` was compiled into this library.
+  EXPORT_SYMBOL bool
+    JsonParserAvailable(JsonParser parser);
 
   /// @brief Convert a JSON-encoded string into a Content array using an
   /// ArrayBuilder.
@@ -19,8 +37,31 @@ namespace awkward {
   /// @param source Null-terminated string containing any valid JSON data.
   /// @param options Configuration options for building an array with an
   /// ArrayBuilder.
+  /// @param parser The JSON library to parse `source` with.
   EXPORT_SYMBOL const ContentPtr
-    FromJsonString(const char* source, const ArrayBuilderOptions& options);
+    FromJsonString(const char* source,
+                   const ArrayBuilderOptions& options,
+                   JsonParser parser = JsonParser::rapidjson);
+
+  /// @brief Convert a JSON-encoded string into a Content array with a
+  /// given Form, using a TypedArrayBuilder.
+  ///
+  /// There is no type discovery: numbers are written directly into buffers
+  /// of the Form's types (e.g. `int32` or `float32`), record fields are
+  /// found by hashing, and the output has exactly the given `form`. Data
+  /// that do not fit the Form raise an error.
+  ///
+  /// @param source Null-terminated string containing any valid JSON data.
+  /// @param form The Form of the output (see TypedArrayBuilder for the
+  /// Forms that are supported).
+  /// @param options Configuration options for the TypedArrayBuilder's
+  /// buffers.
+  /// @param parser The JSON library to parse `source` with.
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonString(const char* source,
+                   const FormPtr& form,
+                   const ArrayBuilderOptions& options,
+                   JsonParser parser = JsonParser::rapidjson);
 
   /// @brief Convert a JSON-encoded file into a Content array using an
   /// ArrayBuilder.
@@ -29,10 +70,73 @@ namespace awkward {
   /// @param options Configuration options for building an array with an
   /// ArrayBuilder.
   /// @param buffersize Number of bytes for an intermediate buffer.
+  /// @param parser The JSON library to parse `source` with. With
+  /// `simdjson`, the whole file is read into memory before parsing.
   EXPORT_SYMBOL const ContentPtr
     FromJsonFile(FILE* source,
                  const ArrayBuilderOptions& options,
-                 int64_t buffersize);
+                 int64_t buffersize,
+                 JsonParser parser = JsonParser::rapidjson);
+
+  /// @brief Convert a JSON-encoded file into a Content array with a given
+  /// Form, using a TypedArrayBuilder (see the corresponding
+  /// #FromJsonString).
+  ///
+  /// @param source C file handle to a file containing any valid JSON data.
+  /// @param form The Form of the output.
+  /// @param options Configuration options for the TypedArrayBuilder's
+  /// buffers.
+  /// @param buffersize Number of bytes for an intermediate buffer.
+  /// @param parser The JSON library to parse `source` with.
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonFile(FILE* source,
+                 const FormPtr& form,
+                 const ArrayBuilderOptions& options,
+                 int64_t buffersize,
+                 JsonParser parser = JsonParser::rapidjson);
+
+  /// @brief Convert newline-delimited JSON (JSON Lines) into an
+  /// IrregularlyPartitionedArray, parsing chunks of lines in parallel.
+  ///
+  /// Each line is one item of the output. The input is cut into chunks of
+  /// about `chunksize` bytes at line boundaries, and each chunk is parsed
+  /// into its own partition by its own ArrayBuilder. If the partitions do
+  /// not all have the same Form, they are merged into a common one.
+  ///
+  /// @param source Null-terminated string containing JSON Lines data.
+  /// @param options Configuration options for building an array with an
+  /// ArrayBuilder.
+  /// @param chunksize Approximate number of bytes in each partition.
+  /// @param numthreads Number of threads to parse with; `0` means one per
+  /// core.
+  /// @param parser The JSON library to parse each chunk with.
+  EXPORT_SYMBOL const PartitionedArrayPtr
+    FromJsonLines(const char* source,
+                  const ArrayBuilderOptions& options,
+                  int64_t chunksize,
+                  int64_t numthreads,
+                  JsonParser parser = JsonParser::rapidjson);
+
+  /// @brief Convert a newline-delimited JSON (JSON Lines) file into an
+  /// IrregularlyPartitionedArray, parsing chunks of lines in parallel.
+  ///
+  /// The file is read sequentially, and each chunk is parsed while the
+  /// next ones are being read; at most two chunks per thread are held in
+  /// memory at a time. See #FromJsonLines.
+  ///
+  /// @param source C file handle to a file containing JSON Lines data.
+  /// @param options Configuration options for building an array with an
+  /// ArrayBuilder.
+  /// @param chunksize Approximate number of bytes in each partition.
+  /// @param numthreads Number of threads to parse with; `0` means one per
+  /// core.
+  /// @param parser The JSON library to parse each chunk with.
+  EXPORT_SYMBOL const PartitionedArrayPtr
+    FromJsonLinesFile(FILE* source,
+                      const ArrayBuilderOptions& options,
+                      int64_t chunksize,
+                      int64_t numthreads,
+                      JsonParser parser = JsonParser::rapidjson);
 
   /// @class ToJson
   ///
@@ -0,0 +1,72 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_IO_JSON_SIMDJSON_H_
+#define AWKWARD_IO_JSON_SIMDJSON_H_
+
+#include <cstddef>
+#include <cstdio>
+
+#include "awkward/common.h"
+
+namespace awkward {
+  class ArrayBuilder;
+  class TypedArrayBuilder;
+
+  // The simdjson reader behind JsonParser::simdjson. simdjson needs C++17,
+  // so these are defined in a translation unit of their own
+  // (src/libawkward/io/json_simdjson.cpp), which is only compiled with
+  // BUILD_SIMDJSON; this header, like the rest of libawkward, is C++11.
+
+  /// @brief Starts field `key` of the current record in `builder`; shared
+  /// by the rapidjson and simdjson readers (defined in json.cpp).
+  ///
+  /// `key` is NUL-terminated in both readers; its `length` only spares
+  /// TypedArrayBuilder from measuring it again.
+  void
+    JsonField(ArrayBuilder& builder, const char* key, int64_t length);
+
+  /// @copydoc JsonField(ArrayBuilder&, const char*, int64_t)
+  void
+    JsonField(TypedArrayBuilder& builder, const char* key, int64_t length);
+
+  /// @brief Fills `builder` from the JSON document in the first `length`
+  /// characters of `source`.
+  ///
+  /// A top-level array becomes the items of the array and a top-level
+  /// object becomes a single record, as with rapidjson.
+  void
+    FromSimdjsonString(ArrayBuilder& builder,
+                       const char* source,
+                       size_t length);
+
+  /// @copydoc FromSimdjsonString(ArrayBuilder&, const char*, size_t)
+  void
+    FromSimdjsonString(TypedArrayBuilder& builder,
+                       const char* source,
+                       size_t length);
+
+  /// @brief Fills `builder` from the JSON document in the rest of the file
+  /// `source`, which is read into memory in one piece (growing by at least
+  /// `buffersize` if its size can't be known in advance).
+  void
+    FromSimdjsonFile(ArrayBuilder& builder,
+                     FILE* source,
+                     int64_t buffersize);
+
+  /// @copydoc FromSimdjsonFile(ArrayBuilder&, FILE*, int64_t)
+  void
+    FromSimdjsonFile(TypedArrayBuilder& builder,
+                     FILE* source,
+                     int64_t buffersize);
+
+  /// @brief Fills `builder` with one item per JSON document in the first
+  /// `length` characters of `data`, a chunk of JSON Lines that starts at
+  /// character `offset` of the whole input (for error messages).
+  void
+    FromSimdjsonLines(ArrayBuilder& builder,
+                      const char* data,
+                      size_t length,
+                      int64_t offset);
+}
+
+#endif // AWKWARD_IO_JSON_SIMDJSON_H_
@@ -10,6 +10,9 @@ namespace py = pybind11;
 void
 make_fromjson(py::module& m, const std::string& name);
 
+void
+make_fromjsonlines(py::module& m, const std::string& name);
+
 void
 make_fromroot_nestedvector(py::module& m, const std::string& name);
 
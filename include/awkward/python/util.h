@@ -47,7 +47,10 @@ public:
   /// @brief Called by `std::shared_ptr` when its reference count reaches
   /// zero.
   void operator()(T const *p) {
+    // The last C++ reference may be dropped on a thread without the GIL.
+    PyGILState_STATE state = PyGILState_Ensure();
     Py_DECREF(pyobj_);
+    PyGILState_Release(state);
   }
 private:
   /// @brief The Python object that we hold a reference to.
@@ -7,6 +7,7 @@
 
 #include "awkward/virtual/ArrayGenerator.h"
 #include "awkward/virtual/ArrayCache.h"
+#include "awkward/virtual/SpillingArrayCache.h"
 
 namespace py = pybind11;
 namespace ak = awkward;
@@ -19,7 +20,13 @@ public:
                    int64_t length,
                    const py::object& callable,
                    const py::tuple& args,
-                   const py::dict& kwargs);
+                   const py::dict& kwargs,
+                   const py::object& fields_callable = py::none(),
+                   const py::object& range_callable = py::none());
+
+  /// @brief Releases the Python objects with the GIL held, since the last
+  /// reference may be dropped by a prefetch thread.
+  ~PyArrayGenerator();
 
   const py::object
     callable() const;
@@ -30,9 +37,25 @@ public:
   const py::dict
     kwargs() const;
 
+  /// @brief Called as `fields_callable(keys, *args, **kwargs)` to generate
+  /// only some fields; may be None, and may return None.
+  const py::object
+    fields_callable() const;
+
+  /// @brief Called as `range_callable(start, stop, *args, **kwargs)` to
+  /// generate only some elements; may be None, and may return None.
+  const py::object
+    range_callable() const;
+
   const ak::ContentPtr
     generate() const override;
 
+  const ak::ContentPtr
+    generate_fields(const std::vector<std::string>& keys) const override;
+
+  const ak::ContentPtr
+    generate_range(int64_t start, int64_t stop) const override;
+
   const std::string
     tostring_part(const std::string& indent,
                   const std::string& pre,
@@ -57,9 +80,11 @@ public:
     with_kwargs(const py::dict& kwargs) const;
 
 private:
-  const py::object callable_;
-  const py::tuple args_;
-  const py::dict kwargs_;
+  py::object callable_;
+  py::tuple args_;
+  py::dict kwargs_;
+  py::object fields_callable_;
+  py::object range_callable_;
 };
 
 py::class_<PyArrayGenerator, std::shared_ptr<PyArrayGenerator>>
@@ -76,6 +101,10 @@ class PyArrayCache: public ak::ArrayCache {
 public:
   PyArrayCache(const py::object& mutablemapping);
 
+  /// @brief Releases the mapping with the GIL held, since the last
+  /// reference may be dropped by a prefetch thread.
+  ~PyArrayCache();
+
   const py::object
     mutablemapping() const;
 
@@ -91,10 +120,27 @@ public:
                 const std::string& post) const override;
 
 private:
-  const py::object mutablemapping_;
+  py::object mutablemapping_;
 };
 
 py::class_<PyArrayCache, std::shared_ptr<PyArrayCache>>
 make_PyArrayCache(const py::handle& m, const std::string& name);
 
+////////// LRUArrayCache
+
+py::class_<ak::LRUArrayCache, std::shared_ptr<ak::LRUArrayCache>>
+make_LRUArrayCache(const py::handle& m, const std::string& name);
+
+////////// SpillingArrayCache
+
+py::class_<ak::SpillingArrayCache, std::shared_ptr<ak::SpillingArrayCache>>
+make_SpillingArrayCache(const py::handle& m, const std::string& name);
+
+////////// VirtualArray waits
+
+/// @brief Makes VirtualArray::array release the GIL while it waits for
+/// another thread's generation, which may need the GIL to run Python.
+void
+release_gil_while_waiting();
+
 #endif // AWKWARDPY_VIRTUAL_H_
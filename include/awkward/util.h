@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "awkward/common.h"
+#include "awkward/Allocator.h"
 
 namespace awkward {
   class Identities;
@@ -39,6 +40,52 @@ namespace awkward {
       }
     };
 
+    /// @class allocator_deleter
+    ///
+    /// @brief Used as a `std::shared_ptr` deleter (second argument) to
+    /// return a buffer to the Allocator that provided it.
+    ///
+    /// See also
+    ///   - allocate, which creates buffers with this deleter.
+    ///   - array_deleter, which frees buffers made with `new[]`.
+    template<typename T>
+    class EXPORT_SYMBOL allocator_deleter {
+    public:
+      /// @brief Creates an allocator_deleter for a buffer of `bytes` bytes
+      /// from `allocator`.
+      ///
+      /// The Allocator is not reference counted: see Allocator::current_raw.
+      allocator_deleter(Allocator* allocator, int64_t bytes)
+          : allocator_(allocator)
+          , bytes_(bytes) { }
+
+      /// @brief Called by `std::shared_ptr` when its reference count reaches
+      /// zero.
+      void operator()(T const *p) {
+        allocator_->deallocate((void*)p, bytes_);
+      }
+
+    private:
+      Allocator* allocator_;
+      int64_t bytes_;
+    };
+
+    /// @brief Returns an uninitialized buffer of `length` items of type `T`,
+    /// aligned to Allocator::kAlignment, from Allocator::current.
+    ///
+    /// `T` must be a trivial type (a number or a `char`), since no
+    /// constructors or destructors are called. A `length` of zero still
+    /// returns a unique, non-null pointer.
+    template<typename T>
+    std::shared_ptr<T>
+      allocate(int64_t length) {
+      Allocator* allocator = Allocator::current_raw();
+      int64_t bytes = length*(int64_t)sizeof(T);
+      return std::shared_ptr<T>(
+        reinterpret_cast<T*>(allocator->allocate(bytes)),
+        allocator_deleter<T>(allocator, bytes));
+    }
+
     /// @class no_deleter
     ///
     /// @brief Used as a `std::shared_ptr` deleter (second argument) to
@@ -86,6 +133,69 @@ namespace awkward {
                    const std::string& classname,
                    const Identities* id);
 
+    /// @brief Numerical type of a NumpyArray, resolved once from its
+    /// struct-format string so that kernels can be dispatched by table
+    /// lookup instead of string comparisons.
+    ///
+    /// The order of the primitive values matches PrimitiveType::DType and
+    /// must not change: they are used as indexes into dispatch tables.
+    /// `NOT_PRIMITIVE` (formats like `"3s"` or records) and `size` (the
+    /// number of primitive values) are not indexes.
+    enum class dtype {
+        boolean,
+        int8,
+        int16,
+        int32,
+        int64,
+        uint8,
+        uint16,
+        uint32,
+        uint64,
+        float32,
+        float64,
+        size,
+        NOT_PRIMITIVE
+    };
+
+    /// @brief Resolves a pybind11/NumPy struct-format string into a #dtype.
+    ///
+    /// An optional byte-order prefix (`"@"`, `"="`, or the native one of
+    /// `"<"`/`">"`) is ignored. Integer codes (`"b"`, `"h"`, `"i"`, `"l"`,
+    /// `"q"`, `"n"` and their unsigned counterparts) are resolved by
+    /// `itemsize` if it is positive and by the platform's C type sizes if
+    /// not, so that `"l"` is `int64` on Linux and `int32` on Windows.
+    /// `"c"` is treated as `uint8`. Anything else is `NOT_PRIMITIVE`.
+    dtype
+      format_to_dtype(const std::string& format, int64_t itemsize);
+
+    /// @brief The native pybind11 format string for a #dtype; the inverse
+    /// of #format_to_dtype.
+    ///
+    /// Note that 32-bit systems and Windows use "`q/Q`" for signed/unsigned
+    /// 64-bit and "`l/L`" for 32-bit, while all other systems use "`l/L`"
+    /// for 64-bit and "`i/I`" for 32-bit.
+    const std::string
+      dtype_to_format(dtype dt);
+
+    /// @brief Number of bytes in one item of a #dtype, or `0` for
+    /// `NOT_PRIMITIVE`.
+    int64_t
+      dtype_to_itemsize(dtype dt);
+
+    /// @brief Name of a #dtype as used by NumpyForm::primitive (`"bool"`,
+    /// `"int8"`, ..., `"float64"`), or `"unknown"` for `NOT_PRIMITIVE`.
+    const std::string
+      dtype_to_name(dtype dt);
+
+    /// @brief Returns `true` if `dt` is one of the signed or unsigned
+    /// integer types (not `boolean`).
+    bool
+      is_integer(dtype dt);
+
+    /// @brief Returns `true` if `dt` is `float32` or `float64`.
+    bool
+      is_real(dtype dt);
+
     /// @brief Converts an `offsets` index (from
     /// {@link ListOffsetArrayOf ListOffsetArray}, for instance) into a
     /// `starts` index by viewing it with the last element dropped.
@@ -1028,6 +1138,77 @@ namespace awkward {
         int64_t stopsoffset,
         int64_t length);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_global_startstop_64(
+        int64_t* globalstart,
+        int64_t* globalstop,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+        int64_t* maxcount,
+        int64_t* offsetscopy,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+        int64_t* nextcarry,
+        int64_t* nextparents,
+        int64_t nextlen,
+        int64_t* maxnextparents,
+        int64_t* distincts,
+        int64_t distinctslen,
+        int64_t* offsetscopy,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length,
+        const int64_t* parents,
+        int64_t parentsoffset,
+        int64_t maxcount);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_local_nextparents_64(
+        int64_t* nextparents,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_local_starts_64(
+        int64_t* starts,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64(
+        int8_t* toptr,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t outlength);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template<typename T>
@@ -3,6 +3,11 @@
 #ifndef AWKWARD_ARRAYCACHE_H_
 #define AWKWARD_ARRAYCACHE_H_
 
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 #include "awkward/Content.h"
 
 namespace awkward {
@@ -45,6 +50,106 @@ namespace awkward {
   // large), define it in this file and implement it in
   // src/libawkward/virtual/ArrayCache.cpp.
 
+  /// @class LRUArrayCache
+  ///
+  /// @brief Thread-safe, least-recently-used cache whose budget is the
+  /// total {@link Content#nbytes Content::nbytes} of its arrays, rather
+  /// than the number of entries.
+  ///
+  /// Lookups stay in C++, so a VirtualArray with this cache never goes
+  /// through Python to get or set its array.
+  class EXPORT_SYMBOL LRUArrayCache: public ArrayCache {
+  public:
+    /// @brief Called with the key and array of each entry that is dropped
+    /// to stay within the budget.
+    ///
+    /// Callbacks run after the cache's lock is released, so they may use
+    /// the cache.
+    using EvictionCallback =
+      std::function<void(const std::string& key, const ContentPtr& value)>;
+
+    /// @brief Creates an empty LRUArrayCache.
+    ///
+    /// @param maxbytes The most bytes that the cached arrays may hold
+    /// together. An array larger than this is never retained; it is
+    /// passed straight to the eviction callback.
+    /// @param on_evict Called for each evicted entry; may be empty.
+    LRUArrayCache(int64_t maxbytes,
+                  const EvictionCallback& on_evict = EvictionCallback());
+
+    /// @brief The most bytes that the cached arrays may hold together.
+    int64_t
+      maxbytes() const;
+
+    /// @brief The bytes that the cached arrays currently hold.
+    int64_t
+      nbytes() const;
+
+    /// @brief The number of cached arrays.
+    int64_t
+      length() const;
+
+    /// @brief Returns `true` if an array is cached at `key`, without
+    /// marking it as recently used.
+    bool
+      has(const std::string& key) const;
+
+    /// @brief The cached keys, from most to least recently used.
+    const std::vector<std::string>
+      keys() const;
+
+    /// @brief Replaces the eviction callback.
+    void
+      set_on_evict(const EvictionCallback& on_evict);
+
+    /// @brief Gets an array and marks it as the most recently used, or
+    /// returns `nullptr` if not available.
+    ContentPtr
+      get(const std::string& key) const override;
+
+    /// @brief Writes or overwrites an array at `key`, then evicts the least
+    /// recently used arrays until the cache is within its budget.
+    void
+      set(const std::string& key, const ContentPtr& value) override;
+
+    /// @brief Removes the array at `key`, if any, without calling the
+    /// eviction callback.
+    ///
+    /// Returns `true` if there was an array to remove.
+    bool
+      erase(const std::string& key);
+
+    /// @brief Removes all arrays without calling the eviction callback.
+    void
+      clear();
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+  private:
+    struct Entry {
+      std::string key;
+      ContentPtr value;
+      int64_t nbytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    /// @brief Protects all of the members below.
+    mutable std::mutex mutex_;
+    /// @brief See #maxbytes.
+    const int64_t maxbytes_;
+    /// @brief See #nbytes.
+    int64_t nbytes_;
+    /// @brief Entries from most to least recently used.
+    mutable EntryList entries_;
+    /// @brief Position of each key in #entries_.
+    std::unordered_map<std::string, EntryList::iterator> lookup_;
+    /// @brief See #set_on_evict.
+    EvictionCallback on_evict_;
+  };
+
 }
 
 #endif // AWKWARD_ARRAYCACHE_H_
@@ -53,6 +53,29 @@ namespace awkward {
     const ContentPtr
       generate_and_check() const;
 
+    /// @brief Creates only the fields `keys` of the array that #generate
+    /// would create, or returns `nullptr` if this generator can't do that
+    /// more cheaply than generating everything.
+    ///
+    /// The result may have more fields than `keys`; the caller selects
+    /// among them. The default implementation returns `nullptr`.
+    ///
+    /// VirtualArray uses this to push field selections down to the source.
+    virtual const ContentPtr
+      generate_fields(const std::vector<std::string>& keys) const;
+
+    /// @brief Creates only the elements from `start` (inclusive) to `stop`
+    /// (exclusive) of the array that #generate would create, or returns
+    /// `nullptr` if this generator can't do that more cheaply than
+    /// generating everything.
+    ///
+    /// `start` and `stop` are non-negative and within #length. The default
+    /// implementation returns `nullptr`.
+    ///
+    /// VirtualArray uses this to push range selections down to the source.
+    virtual const ContentPtr
+      generate_range(int64_t start, int64_t stop) const;
+
     /// @brief Returns a string representation of this ArrayGenerator.
     virtual const std::string
       tostring_part(const std::string& indent,
@@ -100,9 +123,26 @@ namespace awkward {
     const Slice
       slice() const;
 
+    /// @brief Applies the #slice to the #content.
+    ///
+    /// If the #content is an unmaterialized VirtualArray and the #slice is
+    /// a single field, set of fields, or unit-step range, the selection is
+    /// first offered to the VirtualArray's generator (see
+    /// {@link ArrayGenerator#generate_fields generate_fields} and
+    /// {@link ArrayGenerator#generate_range generate_range}).
     const ContentPtr
       generate() const override;
 
+    /// @brief Composes `keys` with the #slice and pushes them down to the
+    /// #content's generator, if possible.
+    const ContentPtr
+      generate_fields(const std::vector<std::string>& keys) const override;
+
+    /// @brief Composes `start` and `stop` with the #slice and pushes them
+    /// down to the #content's generator, if possible.
+    const ContentPtr
+      generate_range(int64_t start, int64_t stop) const override;
+
     const std::string
       tostring_part(const std::string& indent,
                     const std::string& pre,
@@ -118,6 +158,11 @@ namespace awkward {
       with_length(int64_t length) const override;
 
   protected:
+    /// @brief If the #slice is a single unit-step range over a #content of
+    /// known length, sets `start` and `stop` to its regularized bounds.
+    bool
+      unit_range(int64_t& start, int64_t& stop) const;
+
     const ContentPtr content_;
     const Slice slice_;
   };
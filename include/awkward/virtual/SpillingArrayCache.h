@@ -0,0 +1,161 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_SPILLINGARRAYCACHE_H_
+#define AWKWARD_SPILLINGARRAYCACHE_H_
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/virtual/ArrayCache.h"
+
+namespace awkward {
+  /// @class SpillingArrayCache
+  ///
+  /// @brief Thread-safe, two-tier cache: recently used arrays are held in
+  /// memory by an LRUArrayCache, and arrays evicted from it are written to
+  /// files in a scratch directory, from which they are memory-mapped back
+  /// when they are needed again.
+  ///
+  /// An evicted array is {@link Content#pack packed} and written as its
+  /// raw buffers, one after another; its Form and the positions of its
+  /// buffers stay in memory. Reading it back maps the file and wraps the
+  /// mapped buffers without copying, which is much cheaper than
+  /// regenerating an array from a compressed source.
+  ///
+  /// Arrays that can't be written this way (those with Identities or
+  /// RawArray nodes, or any that fail to be written) are dropped when they
+  /// are evicted, as they would be from an LRUArrayCache. The files belong to this cache and are deleted
+  /// when their entries are dropped or when the cache is destroyed.
+  class EXPORT_SYMBOL SpillingArrayCache: public ArrayCache {
+  public:
+    /// @brief Creates an empty SpillingArrayCache.
+    ///
+    /// @param maxbytes The most bytes that the arrays in memory may hold
+    /// together. See LRUArrayCache.
+    /// @param directory Existing directory in which to write the evicted
+    /// arrays.
+    /// @param maxdiskbytes The most bytes that the files may hold together;
+    /// the least recently used files are deleted to stay within it.
+    SpillingArrayCache(int64_t maxbytes,
+                       const std::string& directory,
+                       int64_t maxdiskbytes);
+
+    /// @brief Deletes all of the files that this cache wrote.
+    ///
+    /// Arrays that were read back from them remain valid.
+    ~SpillingArrayCache();
+
+    /// @brief The most bytes that the arrays in memory may hold together.
+    int64_t
+      maxbytes() const;
+
+    /// @brief The bytes that the arrays in memory currently hold.
+    int64_t
+      nbytes() const;
+
+    /// @brief The directory in which evicted arrays are written.
+    const std::string
+      directory() const;
+
+    /// @brief The most bytes that the files may hold together.
+    int64_t
+      maxdiskbytes() const;
+
+    /// @brief The bytes that the files currently hold.
+    int64_t
+      diskbytes() const;
+
+    /// @brief Returns `true` if an array is held in memory at `key`.
+    bool
+      in_memory(const std::string& key) const;
+
+    /// @brief Returns `true` if an array has been written to disk at `key`.
+    ///
+    /// An array that was read back from disk is both in memory and on
+    /// disk, so that evicting it again does not rewrite it.
+    bool
+      on_disk(const std::string& key) const;
+
+    /// @brief Returns `true` if an array is cached at `key` in either tier.
+    bool
+      has(const std::string& key) const;
+
+    /// @brief Gets an array from memory, or else reads it back from disk
+    /// and puts it in memory, or returns `nullptr` if not available.
+    ContentPtr
+      get(const std::string& key) const override;
+
+    /// @brief Writes or overwrites an array at `key` in memory, writing
+    /// the least recently used arrays to disk to make room.
+    void
+      set(const std::string& key, const ContentPtr& value) override;
+
+    /// @brief Removes the array at `key` from both tiers, if any.
+    ///
+    /// Returns `true` if there was an array to remove.
+    bool
+      erase(const std::string& key);
+
+    /// @brief Removes all arrays from both tiers.
+    void
+      clear();
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+  private:
+    /// @brief An array that has been written to a file.
+    struct Spilled {
+      std::string key;
+      std::string path;
+      /// @brief The Form of the packed array.
+      FormPtr form;
+      /// @brief Buffer positions and node lengths, in the order that a
+      /// walk over #form needs them.
+      std::vector<int64_t> layout;
+      int64_t nbytes;
+      /// @brief The array that was last read back from #path, so that it
+      /// is not written again when it is evicted.
+      std::weak_ptr<Content> mapped;
+    };
+    using SpilledList = std::list<Spilled>;
+
+    /// @brief Eviction callback of #memory_.
+    void
+      spill(const std::string& key, const ContentPtr& value);
+
+    /// @brief Removes the entry at `key` from the disk tier, returning the
+    /// path of its file or an empty string. Must hold #mutex_.
+    const std::string
+      forget(const std::string& key);
+
+    /// @brief The memory tier.
+    mutable LRUArrayCache memory_;
+    /// @brief See #directory.
+    const std::string directory_;
+    /// @brief See #maxdiskbytes.
+    const int64_t maxdiskbytes_;
+    /// @brief Prefix of the names of this cache's files.
+    const std::string prefix_;
+    /// @brief Protects all of the members below; if both are needed, this
+    /// is locked before #memory_.
+    mutable std::mutex mutex_;
+    /// @brief See #diskbytes.
+    int64_t diskbytes_;
+    /// @brief The number of files written, for unique file names.
+    int64_t numfiles_;
+    /// @brief Entries on disk from most to least recently used.
+    mutable SpilledList spilled_;
+    /// @brief Position of each key in #spilled_.
+    std::unordered_map<std::string, SpilledList::iterator> lookup_;
+  };
+
+}
+
+#endif // AWKWARD_SPILLINGARRAYCACHE_H_
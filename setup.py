@@ -29,6 +29,10 @@ tests_require = extras["test"]
 
 AWKWARD_BUILD_CUDA = (os.environ.get("AWKWARD_BUILD_CUDA")
                       in ("1", "true", "True", "TRUE", "on", "On", "ON", "yes", "Yes", "YES"))
+AWKWARD_NO_SIMDJSON = (os.environ.get("AWKWARD_BUILD_SIMDJSON")
+                       in ("0", "false", "False", "FALSE", "off", "Off", "OFF", "no", "No", "NO"))
+AWKWARD_NO_SIMD = (os.environ.get("AWKWARD_BUILD_SIMD")
+                   in ("0", "false", "False", "FALSE", "off", "Off", "OFF", "no", "No", "NO"))
 
 class CMakeExtension(Extension):
     def __init__(self, name, sourcedir=""):
@@ -62,6 +66,10 @@ class CMakeBuild(setuptools.command.build_ext.build_ext):
 
         if AWKWARD_BUILD_CUDA:
             cmake_args.append("-DBUILD_CUDA_KERNELS=ON")
+        if AWKWARD_NO_SIMD:
+            cmake_args.append("-DBUILD_SIMD_KERNELS=OFF")
+        if AWKWARD_NO_SIMDJSON:
+            cmake_args.append("-DBUILD_SIMDJSON=OFF")
 
         cfg = "Debug" if self.debug else "Release"
         build_args = ["--config", cfg]
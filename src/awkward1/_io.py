@@ -3,4 +3,5 @@
 from __future__ import absolute_import
 
 from awkward1._ext import fromjson
+from awkward1._ext import fromjsonlines
 from awkward1._ext import fromroot_nestedvector
@@ -1943,8 +1943,10 @@ class ArrayBuilder(object):
     be considered the "least effort" approach.
     """
 
-    def __init__(self, behavior=None, initial=1024, resize=1.5):
-        self._layout = awkward1.layout.ArrayBuilder(initial=initial, resize=resize)
+    def __init__(self, behavior=None, initial=1024, resize=1.5, paged=False):
+        self._layout = awkward1.layout.ArrayBuilder(
+            initial=initial, resize=resize, paged=paged
+        )
         self.behavior = behavior
 
     @classmethod
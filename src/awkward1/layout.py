@@ -52,5 +52,7 @@ from awkward1._ext import VirtualArray
 from awkward1._ext import ArrayGenerator
 from awkward1._ext import SliceGenerator
 from awkward1._ext import ArrayCache
+from awkward1._ext import LRUArrayCache
+from awkward1._ext import SpillingArrayCache
 
 from awkward1._ext import _slice_tostring
@@ -266,7 +266,13 @@ def to_numpy(array, allow_missing=True):
 
 
 def from_iter(
-    iterable, highlevel=True, behavior=None, allow_record=True, initial=1024, resize=1.5
+    iterable,
+    highlevel=True,
+    behavior=None,
+    allow_record=True,
+    initial=1024,
+    resize=1.5,
+    paged=False,
 ):
     """
     Args:
@@ -283,6 +289,9 @@ def from_iter(
         resize (float): Resize multiplier for buffers used by
             #ak.layout.ArrayBuilder (see #ak.layout.ArrayBuilderOptions);
             should be strictly greater than 1.
+        paged (bool): If True, buffers grow by adding pages that are
+            concatenated once at the end, rather than by reallocating and
+            copying (see #ak.layout.ArrayBuilderOptions).
 
     Converts Python data into an Awkward Array.
 
@@ -318,10 +327,11 @@ def from_iter(
                 behavior=behavior,
                 initial=initial,
                 resize=resize,
+                paged=paged,
             )[0]
         else:
             raise ValueError("cannot produce an array from a dict")
-    out = awkward1.layout.ArrayBuilder(initial=initial, resize=resize)
+    out = awkward1.layout.ArrayBuilder(initial=initial, resize=resize, paged=paged)
     for x in iterable:
         out.fromiter(x)
     layout = out.snapshot()
@@ -413,7 +423,15 @@ def to_list(array):
 
 
 def from_json(
-    source, highlevel=True, behavior=None, initial=1024, resize=1.5, buffersize=65536
+    source,
+    highlevel=True,
+    behavior=None,
+    initial=1024,
+    resize=1.5,
+    buffersize=65536,
+    paged=False,
+    parser="rapidjson",
+    form=None,
 ):
     """
     Args:
@@ -429,6 +447,15 @@ def from_json(
             should be strictly greater than 1.
         buffersize (int): Size (in bytes) of the buffer used by the JSON
             parser.
+        paged (bool): If True, buffers grow by adding pages that are
+            concatenated once at the end, rather than by reallocating and
+            copying (see #ak.layout.ArrayBuilderOptions).
+        parser (str): JSON library to parse with: `"rapidjson"` streams
+            tokens into the builder; `"simdjson"` is faster but reads the
+            whole file into memory, and is only available if Awkward Array
+            was compiled with it.
+        form (None, #ak.forms.Form, or JSON): If not None, the JSON is read
+            into exactly this Form (see below).
 
     Converts a JSON string into an Awkward Array.
 
@@ -438,10 +465,89 @@ def from_json(
     and deeply nested JSON can be converted, but the output will never have
     regular-typed array lengths.
 
+    If a `form` is given, no types are discovered: each value is written
+    straight into the buffers that `form` describes, so the output has
+    exactly that Form (including integer widths, regular dimensions, and
+    option-type representations), and any value that does not fit it is
+    an error.
+
     See also #ak.to_json.
     """
+    if isinstance(form, (str, bytes)) or (
+        awkward1._util.py27 and isinstance(form, awkward1._util.unicode)
+    ):
+        form = awkward1.forms.Form.fromjson(form)
+    elif form is not None and not isinstance(form, awkward1.forms.Form):
+        form = awkward1.forms.Form.fromjson(json.dumps(form))
+
     layout = awkward1._ext.fromjson(
-        source, initial=initial, resize=resize, buffersize=buffersize
+        source,
+        initial=initial,
+        resize=resize,
+        buffersize=buffersize,
+        paged=paged,
+        parser=parser,
+        form=form,
+    )
+    if highlevel:
+        return awkward1._util.wrap(layout, behavior)
+    else:
+        return layout
+
+
+def from_json_lines(
+    source,
+    highlevel=True,
+    behavior=None,
+    initial=1024,
+    resize=1.5,
+    chunksize=16777216,
+    numthreads=0,
+    paged=False,
+    parser="rapidjson",
+):
+    """
+    Args:
+        source (str): Name of a file of newline-delimited JSON (JSON Lines),
+            one item per line.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.partition.PartitionedArray.
+        behavior (bool): Custom #ak.behavior for the output array, if
+            high-level.
+        initial (int): Initial size (in bytes) of buffers used by
+            #ak.layout.ArrayBuilder (see #ak.layout.ArrayBuilderOptions).
+        resize (float): Resize multiplier for buffers used by
+            #ak.layout.ArrayBuilder (see #ak.layout.ArrayBuilderOptions);
+            should be strictly greater than 1.
+        chunksize (int): Approximate size (in bytes) of the lines that go
+            into each partition.
+        numthreads (int): Number of threads that parse partitions; 0 means
+            one per core.
+        paged (bool): If True, buffers grow by adding pages that are
+            concatenated once at the end, rather than by reallocating and
+            copying (see #ak.layout.ArrayBuilderOptions).
+        parser (str): JSON library to parse with, `"rapidjson"` or
+            `"simdjson"` (see #ak.from_json).
+
+    Converts a JSON Lines file into a partitioned Awkward Array.
+
+    The file is read sequentially and cut into chunks at line boundaries;
+    the chunks are parsed in parallel, each by its own
+    #ak.layout.ArrayBuilder, and each becomes a partition of the output.
+    If the partitions' types differ, they are merged into a common type.
+
+    See also #ak.from_json.
+    """
+    layout = awkward1.partition.PartitionedArray.from_ext(
+        awkward1._ext.fromjsonlines(
+            source,
+            initial=initial,
+            resize=resize,
+            chunksize=chunksize,
+            numthreads=numthreads,
+            paged=paged,
+            parser=parser,
+        )
     )
     if highlevel:
         return awkward1._util.wrap(layout, behavior)
@@ -725,14 +725,11 @@ def concatenate(arrays, axis=0, mergebool=True, highlevel=True):
 
     if len(contents) == 0:
         raise ValueError("need at least one array to concatenate")
-    out = contents[0]
-    for x in contents[1:]:
-        if not out.mergeable(x, mergebool=mergebool):
-            out = out.merge_as_union(x)
-        else:
-            out = out.merge(x)
-        if isinstance(out, awkward1._util.uniontypes):
-            out = out.simplify(mergebool=mergebool)
+    # one pass, rather than recopying the growing result for each array;
+    # arrays that can't be merged become a union
+    out = contents[0].merge_many(contents[1:], mergebool=mergebool)
+    if isinstance(out, awkward1._util.uniontypes):
+        out = out.simplify(mergebool=mergebool)
 
     if highlevel:
         return awkward1._util.wrap(out, behavior=awkward1._util.behaviorof(*arrays))
@@ -2240,6 +2237,8 @@ def virtual(
     parameters=None,
     highlevel=True,
     behavior=None,
+    generate_fields=None,
+    generate_range=None,
 ):
     """
     Args:
@@ -2261,7 +2260,9 @@ def virtual(
             mapping with `__setitem__`, retrieved with `__getitem__`, and only
             re-generated if `__getitem__` raises a `KeyError`. This mapping may
             evict elements according to any caching algorithm (LRU, LFR, RR,
-            TTL, etc.).
+            TTL, etc.). An #ak.layout.LRUArrayCache or
+            #ak.layout.SpillingArrayCache is used directly, without going
+            through Python for each lookup.
         cache_key (None or str): If None, a unique string is generated for this
             virtual array for use with the `cache` (unique per Python process);
             otherwise, the explicitly provided key is used (which ought to
@@ -2273,6 +2274,15 @@ def virtual(
             a low-level #ak.layout.Content subclass.
         behavior (bool): Custom #ak.behavior for the output array, if
             high-level.
+        generate_fields (None or callable): If not None, a function called as
+            `generate_fields(keys, *args, **kwargs)` when only the record
+            fields `keys` of the array are needed. It may return an array
+            with just those fields (or more), or None to fall back to
+            `generate`.
+        generate_range (None or callable): If not None, a function called as
+            `generate_range(start, stop, *args, **kwargs)` when only the
+            elements from `start` to `stop` are needed (requires `length`).
+            It may return those elements, or None to fall back to `generate`.
 
     Creates a virtual array, an array that is created on demand.
 
@@ -2310,9 +2320,22 @@ def virtual(
         form = awkward1.forms.Form.fromjson(json.dumps(form))
 
     gen = awkward1.layout.ArrayGenerator(
-        generate, args, kwargs, form=form, length=length
+        generate,
+        args,
+        kwargs,
+        form=form,
+        length=length,
+        generate_fields=generate_fields,
+        generate_range=generate_range,
     )
-    if cache is not None:
+    if cache is not None and not isinstance(
+        cache,
+        (
+            awkward1.layout.ArrayCache,
+            awkward1.layout.LRUArrayCache,
+            awkward1.layout.SpillingArrayCache,
+        ),
+    ):
         cache = awkward1.layout.ArrayCache(cache)
 
     out = awkward1.layout.VirtualArray(
@@ -2334,7 +2357,9 @@ def with_cache(array, cache, chain=None, highlevel=True):
             mapping with `__setitem__`, retrieved with `__getitem__`, and only
             re-generated if `__getitem__` raises a `KeyError`. This mapping may
             evict elements according to any caching algorithm (LRU, LFR, RR,
-            TTL, etc.).
+            TTL, etc.). An #ak.layout.LRUArrayCache or
+            #ak.layout.SpillingArrayCache is used directly, without going
+            through Python for each lookup.
         chain (None, "first", "last", or bool): If None, the provided `cache`
             simply replaces any existing virtual array caches. If "first", the
             provided `cache` becomes first in a chain of caches; virtual arrays
@@ -2393,7 +2418,14 @@ def with_cache(array, cache, chain=None, highlevel=True):
     elif chain is not None and chain not in ("first", "last"):
         raise ValueError("chain must be None, 'first', 'last', or bool")
 
-    if not isinstance(cache, awkward1.layout.ArrayCache):
+    if cache is not None and not isinstance(
+        cache,
+        (
+            awkward1.layout.ArrayCache,
+            awkward1.layout.LRUArrayCache,
+            awkward1.layout.SpillingArrayCache,
+        ),
+    ):
         cache = awkward1.layout.ArrayCache(cache)
 
     def getfunction(layout, depth):
@@ -334,14 +334,9 @@ class PartitionedArray(object):
 
     def toContent(self):
         contents = self._ext.partitions
-        out = contents[0]
-        for x in contents[1:]:
-            if not out.mergeable(x, mergebool=False):
-                out = out.merge_as_union(x)
-            else:
-                out = out.merge(x)
-            if isinstance(out, awkward1._util.uniontypes):
-                out = out.simplify(mergebool=False)
+        out = contents[0].merge_many(contents[1:], mergebool=False)
+        if isinstance(out, awkward1._util.uniontypes):
+            out = out.simplify(mergebool=False)
         return out
 
     def repartition(self, *args, **kwargs):
@@ -0,0 +1,220 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "awkward/cpu-kernels/parallel.h"
+
+namespace {
+  typedef struct Error (*Body)(void* closure, int64_t start, int64_t stop);
+
+  int64_t
+  hardware_threads() {
+    int64_t out = (int64_t)std::thread::hardware_concurrency();
+    return out > 0 ? out : 1;
+  }
+
+  // Workers are started on demand and never stopped: they are detached
+  // and wait on a condition variable, so that nothing needs to be joined
+  // while the library is being unloaded. A job is split into chunks that
+  // the caller and the participating workers take in turn; the caller
+  // returns when no chunk is left and no worker is still in the job.
+  class ThreadPool {
+  public:
+    ThreadPool()
+        : generation_(0)
+        , participants_(0)
+        , active_(0)
+        , body_(nullptr)
+        , closure_(nullptr)
+        , length_(0)
+        , numchunks_(0)
+        , errors_(nullptr)
+        , next_(0)
+        , numworkers_(0) { }
+
+    struct Error
+      run(int64_t num_threads, int64_t length, Body body, void* closure) {
+        std::unique_lock<std::mutex> busy(run_mutex_, std::try_to_lock);
+        if (!busy.owns_lock()) {
+          // Another (or an enclosing) call is using the pool.
+          return body(closure, 0, length);
+        }
+
+        int64_t numchunks = num_threads * 4;
+        if (numchunks > length) {
+          numchunks = length;
+        }
+        std::vector<struct Error> errors((size_t)numchunks, success());
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          done_.wait(lock, [this]() -> bool { return active_ == 0; });
+          while (numworkers_ < num_threads - 1) {
+            std::thread(&ThreadPool::work, this, numworkers_).detach();
+            numworkers_++;
+          }
+          body_ = body;
+          closure_ = closure;
+          length_ = length;
+          numchunks_ = numchunks;
+          errors_ = errors.data();
+          next_.store(0);
+          participants_ = num_threads - 1;
+          generation_++;
+        }
+        wake_.notify_all();
+
+        execute(body, closure, length, numchunks, errors.data());
+
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          done_.wait(lock, [this]() -> bool { return active_ == 0; });
+          errors_ = nullptr;
+        }
+
+        for (auto error : errors) {
+          if (error.str != nullptr) {
+            return error;
+          }
+        }
+        return success();
+      }
+
+  private:
+    void
+      execute(Body body,
+              void* closure,
+              int64_t length,
+              int64_t numchunks,
+              struct Error* errors) {
+        int64_t chunk;
+        while ((chunk = next_.fetch_add(1)) < numchunks) {
+          int64_t start = (length * chunk) / numchunks;
+          int64_t stop = (length * (chunk + 1)) / numchunks;
+          errors[chunk] = body(closure, start, stop);
+        }
+      }
+
+    void
+      work(int64_t id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        int64_t seen = generation_;
+        while (true) {
+          wake_.wait(lock, [this, &seen]() -> bool {
+            return generation_ != seen;
+          });
+          seen = generation_;
+          if (id >= participants_  ||  errors_ == nullptr) {
+            continue;
+          }
+          Body body = body_;
+          void* closure = closure_;
+          int64_t length = length_;
+          int64_t numchunks = numchunks_;
+          struct Error* errors = errors_;
+          active_++;
+          lock.unlock();
+
+          execute(body, closure, length, numchunks, errors);
+
+          lock.lock();
+          active_--;
+          if (active_ == 0) {
+            done_.notify_all();
+          }
+        }
+      }
+
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    int64_t generation_;
+    int64_t participants_;
+    int64_t active_;
+    Body body_;
+    void* closure_;
+    int64_t length_;
+    int64_t numchunks_;
+    struct Error* errors_;
+    std::atomic<int64_t> next_;
+    int64_t numworkers_;
+  };
+
+  ThreadPool*
+  pool() {
+    static ThreadPool* out = new ThreadPool();
+    return out;
+  }
+
+  std::atomic<int64_t> num_threads_(1);
+  std::atomic<int64_t> threshold_(kParallelThreshold);
+
+  // Read the environment once, at load time.
+  struct Initialize {
+    Initialize() {
+      const char* env = std::getenv("AWKWARD_NUM_THREADS");
+      if (env != nullptr) {
+        if (std::strcmp(env, "auto") == 0) {
+          num_threads_.store(hardware_threads());
+        }
+        else {
+          int64_t num_threads = (int64_t)std::atoll(env);
+          if (num_threads == 0) {
+            num_threads_.store(hardware_threads());
+          }
+          else if (num_threads > 0) {
+            num_threads_.store(num_threads);
+          }
+        }
+      }
+      env = std::getenv("AWKWARD_PARALLEL_THRESHOLD");
+      if (env != nullptr) {
+        int64_t threshold = (int64_t)std::atoll(env);
+        if (threshold > 0) {
+          threshold_.store(threshold);
+        }
+      }
+    }
+  } initialize_;
+}
+
+int64_t awkward_cpu_kernels_num_threads() {
+  return num_threads_.load();
+}
+ERROR awkward_cpu_kernels_set_num_threads(
+  int64_t num_threads) {
+  if (num_threads < 0) {
+    return failure("number of threads must be non-negative", kSliceNone, num_threads);
+  }
+  num_threads_.store(num_threads == 0 ? hardware_threads() : num_threads);
+  return success();
+}
+
+int64_t awkward_cpu_kernels_parallel_threshold() {
+  return threshold_.load();
+}
+ERROR awkward_cpu_kernels_set_parallel_threshold(
+  int64_t threshold) {
+  if (threshold < 1) {
+    return failure("parallel threshold must be positive", kSliceNone, threshold);
+  }
+  threshold_.store(threshold);
+  return success();
+}
+
+ERROR awkward_cpu_kernels_parallel_for(
+  int64_t length,
+  ERROR (*body)(void* closure, int64_t start, int64_t stop),
+  void* closure) {
+  int64_t num_threads = num_threads_.load(std::memory_order_relaxed);
+  if (num_threads <= 1  ||  length < threshold_.load(std::memory_order_relaxed)) {
+    return body(closure, 0, length);
+  }
+  return pool()->run(num_threads, length, body, closure);
+}
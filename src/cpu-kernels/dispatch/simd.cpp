@@ -0,0 +1,126 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdlib>
+#include <cstring>
+
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/reducers.h"
+#include "awkward/cpu-kernels/simd.h"
+
+namespace {
+  // Only uses compiler builtins, so that it is safe to call from an ifunc
+  // resolver, which can run before libc is initialized.
+  int64_t
+  detect_supported() {
+#ifdef AWKWARD_SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")  &&
+        __builtin_cpu_supports("avx512cd")  &&
+        __builtin_cpu_supports("avx512bw")  &&
+        __builtin_cpu_supports("avx512dq")  &&
+        __builtin_cpu_supports("avx512vl")  &&
+        __builtin_cpu_supports("avx2")  &&
+        __builtin_cpu_supports("fma")) {
+      return kSimdAVX512;
+    }
+    if (__builtin_cpu_supports("avx2")  &&  __builtin_cpu_supports("fma")) {
+      return kSimdAVX2;
+    }
+#endif
+    return kSimdBaseline;
+  }
+
+  int64_t
+  requested_level(int64_t supported) {
+    const char* env = std::getenv("AWKWARD_SIMD_LEVEL");
+    if (env == nullptr) {
+      return supported;
+    }
+    int64_t requested = supported;
+    if (std::strcmp(env, "baseline") == 0  ||  std::strcmp(env, "0") == 0) {
+      requested = kSimdBaseline;
+    }
+    else if (std::strcmp(env, "avx2") == 0  ||  std::strcmp(env, "1") == 0) {
+      requested = kSimdAVX2;
+    }
+    else if (std::strcmp(env, "avx512") == 0  ||  std::strcmp(env, "2") == 0) {
+      requested = kSimdAVX512;
+    }
+    return requested < supported ? requested : supported;
+  }
+
+  // Constant-initialized, so that kernels called before the constructor
+  // below (from other libraries' constructors) see the baseline level.
+  int64_t bound_ = kSimdBaseline;
+
+#ifdef AWKWARD_SIMD_KERNELS
+  // Calls a kernel through the pointer that Initialize has bound.
+  template <typename F>
+  struct Forward;
+
+  template <typename R, typename... A>
+  struct Forward<R(A...)> {
+    template <R (**P)(A...)>
+    static R
+      call(A... args) {
+      return (*P)(args...);
+    }
+  };
+#endif
+}
+
+#ifdef AWKWARD_SIMD_KERNELS
+// For each kernel, the suffixed variants are compiled from the same source
+// with different instruction sets (see CMakeLists.txt), and the unsuffixed
+// name is an ifunc. On a CPU without AVX2, its resolver binds the name
+// directly to the baseline variant. Otherwise, the name is bound to a
+// forwarder through name##_ptr, which Initialize points at the variant for
+// the level that AWKWARD_SIMD_LEVEL allows: resolvers cannot read the
+// environment, since they may run before libc has set it up.
+#define AWKWARD_CPU_KERNEL(name)                                            \
+  extern "C" decltype(name) name##_baseline, name##_avx2, name##_avx512;  \
+  static decltype(&name) const name##_table[3] = {                        \
+    &name##_baseline, &name##_avx2, &name##_avx512 };                     \
+  static decltype(&name) name##_ptr = &name##_baseline;                   \
+  extern "C" {                                                            \
+    static decltype(&name) resolve_##name() {                             \
+      if (detect_supported() == kSimdBaseline) {                          \
+        return &name##_baseline;                                          \
+      }                                                                   \
+      return &Forward<decltype(name)>::call<&name##_ptr>;                 \
+    }                                                                     \
+  }                                                                       \
+  decltype(name) name __attribute__((ifunc("resolve_" #name)));
+
+#include "names.h"
+
+#undef AWKWARD_CPU_KERNEL
+#endif
+
+namespace {
+  // Binds every kernel to the requested level during dynamic
+  // initialization, after libc has set up the environment and before any
+  // other thread can call a kernel or ask for the level.
+  struct Initialize {
+    Initialize() {
+      bound_ = requested_level(detect_supported());
+#ifdef AWKWARD_SIMD_KERNELS
+#define AWKWARD_CPU_KERNEL(name)                                            \
+      name##_ptr = name##_table[bound_];
+
+#include "names.h"
+
+#undef AWKWARD_CPU_KERNEL
+#endif
+    }
+  } initialize_;
+}
+
+int64_t awkward_cpu_kernels_simd_supported() {
+  return detect_supported();
+}
+int64_t awkward_cpu_kernels_simd_level() {
+  return bound_;
+}
@@ -1,6 +1,9 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <cstring>
+
 #include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/parallel.h"
 
 void awkward_regularize_rangeslice(
   int64_t* start,
@@ -66,37 +69,45 @@ ERROR awkward_index8_to_index64(
   int64_t* toptr,
   const int8_t* fromptr,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i]= (int64_t)fromptr[i];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i]= (int64_t)fromptr[i];
+    }
+    return success();
+  });
 }
 ERROR awkward_indexU8_to_index64(
   int64_t* toptr,
   const uint8_t* fromptr,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i]= (int64_t)fromptr[i];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i]= (int64_t)fromptr[i];
+    }
+    return success();
+  });
 }
 ERROR awkward_index32_to_index64(
   int64_t* toptr,
   const int32_t* fromptr,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i]= (int64_t)fromptr[i];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i]= (int64_t)fromptr[i];
+    }
+    return success();
+  });
 }
 ERROR awkward_indexU32_to_index64(
   int64_t* toptr,
   const uint32_t* fromptr,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i]= (int64_t)fromptr[i];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i]= (int64_t)fromptr[i];
+    }
+    return success();
+  });
 }
 
 template <typename C, typename T>
@@ -107,14 +118,16 @@ ERROR awkward_index_carry(
   int64_t fromindexoffset,
   int64_t lenfromindex,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    T j = carry[i];
-    if (j > lenfromindex) {
-      return failure("index out of range", kSliceNone, j);
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      T j = carry[i];
+      if (j >= lenfromindex) {
+        return failure("index out of range", kSliceNone, j);
+      }
+      toindex[i] = fromindex[(size_t)(fromindexoffset + j)];
     }
-    toindex[i] = fromindex[(size_t)(fromindexoffset + j)];
-  }
-  return success();
+    return success();
+  });
 }
 ERROR awkward_index8_carry_64(
   int8_t* toindex,
@@ -191,6 +204,21 @@ ERROR awkward_index64_carry_64(
     lenfromindex,
     length);
 }
+ERROR awkward_index_carry_check_64(
+  const int64_t* carry,
+  int64_t carryoffset,
+  int64_t lenfromindex,
+  int64_t length) {
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t j = carry[carryoffset + i];
+      if (j < 0  ||  j >= lenfromindex) {
+        return failure("index out of range", i, j);
+      }
+    }
+    return success();
+  });
+}
 
 template <typename C, typename T>
 ERROR awkward_index_carry_nocheck(
@@ -199,10 +227,12 @@ ERROR awkward_index_carry_nocheck(
   const T* carry,
   int64_t fromindexoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toindex[i] = fromindex[(size_t)(fromindexoffset + carry[i])];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toindex[i] = fromindex[(size_t)(fromindexoffset + carry[i])];
+    }
+    return success();
+  });
 }
 ERROR awkward_index8_carry_nocheck_64(
   int8_t* toindex,
@@ -334,10 +364,12 @@ template <typename T>
 ERROR awkward_carry_arange(
   T* toptr,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i] = i;
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i] = i;
+    }
+    return success();
+  });
 }
 ERROR awkward_carry_arange_32(
   int32_t* toptr,
@@ -444,12 +476,14 @@ ERROR awkward_numpyarray_contiguous_copy(
   int64_t stride,
   int64_t offset,
   const T* pos) {
-  for (int64_t i = 0;  i < len;  i++) {
-    memcpy(&toptr[i*stride],
-           &fromptr[offset + (int64_t)pos[i]],
-           (size_t)stride);
-  }
-  return success();
+  return parallel_for(len, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      memcpy(&toptr[i*stride],
+             &fromptr[offset + (int64_t)pos[i]],
+             (size_t)stride);
+    }
+    return success();
+  });
 }
 ERROR awkward_numpyarray_contiguous_copy_64(
   uint8_t* toptr,
@@ -474,12 +508,14 @@ ERROR awkward_numpyarray_contiguous_next(
   int64_t len,
   int64_t skip,
   int64_t stride) {
-  for (int64_t i = 0;  i < len;  i++) {
-    for (int64_t j = 0;  j < skip;  j++) {
-      topos[i*skip + j] = frompos[i] + j*stride;
+  return parallel_for(len, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      for (int64_t j = 0;  j < skip;  j++) {
+        topos[i*skip + j] = frompos[i] + j*stride;
+      }
     }
-  }
-  return success();
+    return success();
+  });
 }
 ERROR awkward_numpyarray_contiguous_next_64(
   int64_t* topos,
@@ -503,12 +539,14 @@ ERROR awkward_numpyarray_getitem_next_null(
   int64_t stride,
   int64_t offset,
   const T* pos) {
-  for (int64_t i = 0;  i < len;  i++) {
-    std::memcpy(&toptr[i*stride],
-                &fromptr[offset + pos[i]*stride],
-                (size_t)stride);
-  }
-  return success();
+  return parallel_for(len, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      std::memcpy(&toptr[i*stride],
+                  &fromptr[offset + pos[i]*stride],
+                  (size_t)stride);
+    }
+    return success();
+  });
 }
 ERROR awkward_numpyarray_getitem_next_null_64(
   uint8_t* toptr,
@@ -1339,14 +1377,16 @@ ERROR awkward_listarray_getitem_carry(
   int64_t stopsoffset,
   int64_t lenstarts,
   int64_t lencarry) {
-  for (int64_t i = 0;  i < lencarry;  i++) {
-    if (fromcarry[i] >= lenstarts) {
-      return failure("index out of range", i, fromcarry[i]);
+  return parallel_for(lencarry, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      if (fromcarry[i] >= lenstarts) {
+        return failure("index out of range", i, fromcarry[i]);
+      }
+      tostarts[i] = (C)(fromstarts[startsoffset + fromcarry[i]]);
+      tostops[i] = (C)(fromstops[stopsoffset + fromcarry[i]]);
     }
-    tostarts[i] = (C)(fromstarts[startsoffset + fromcarry[i]]);
-    tostops[i] = (C)(fromstops[stopsoffset + fromcarry[i]]);
-  }
-  return success();
+    return success();
+  });
 }
 ERROR awkward_listarray32_getitem_carry_64(
   int32_t* tostarts,
@@ -3055,3 +3095,146 @@ ERROR awkward_bytemaskedarray_toindexedarray_64(
     length,
     validwhen);
 }
+
+namespace {
+  // Bit i of a BitMaskedArray's mask, in either bit order.
+  inline bool
+  bitmask_isset(const uint8_t* bitmask,
+                int64_t bitmaskoffset,
+                int64_t i,
+                bool lsb_order) {
+    uint8_t byte = bitmask[bitmaskoffset + (i >> 3)];
+    return lsb_order ? ((byte >> (i & 7)) & 1) != 0
+                     : ((byte << (i & 7)) & 128) != 0;
+  }
+
+  inline int64_t
+  popcount64(uint64_t x) {
+#if defined(__GNUC__)  ||  defined(__clang__)
+    return (int64_t)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int64_t)((x * 0x0101010101010101ULL) >> 56);
+#endif
+  }
+}
+
+ERROR awkward_bitmaskedarray_numnull(
+  int64_t* numnull,
+  const uint8_t* bitmask,
+  int64_t bitmaskoffset,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  // Bit order doesn't matter for whole bytes, which are counted eight at a
+  // time; only the bits of a partial last byte are tested one by one.
+  const uint8_t* bytes = &bitmask[bitmaskoffset];
+  int64_t numbytes = length / 8;
+  int64_t numset = 0;
+  int64_t i = 0;
+  for (;  i + 8 <= numbytes;  i += 8) {
+    uint64_t word;
+    std::memcpy(&word, &bytes[i], sizeof(uint64_t));
+    numset += popcount64(word);
+  }
+  for (;  i < numbytes;  i++) {
+    numset += popcount64(bytes[i]);
+  }
+  for (int64_t j = numbytes*8;  j < length;  j++) {
+    if (bitmask_isset(bitmask, bitmaskoffset, j, lsb_order)) {
+      numset++;
+    }
+  }
+  *numnull = (validwhen ? length - numset : numset);
+  return success();
+}
+
+ERROR awkward_bitmaskedarray_getitem_nextcarry_64(
+  int64_t* tocarry,
+  const uint8_t* bitmask,
+  int64_t bitmaskoffset,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  int64_t k = 0;
+  for (int64_t i = 0;  i < length;  i++) {
+    if (bitmask_isset(bitmask, bitmaskoffset, i, lsb_order) == validwhen) {
+      tocarry[k] = i;
+      k++;
+    }
+  }
+  return success();
+}
+
+ERROR awkward_bitmaskedarray_getitem_nextcarry_outindex_64(
+  int64_t* tocarry,
+  int64_t* outindex,
+  const uint8_t* bitmask,
+  int64_t bitmaskoffset,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  int64_t k = 0;
+  for (int64_t i = 0;  i < length;  i++) {
+    if (bitmask_isset(bitmask, bitmaskoffset, i, lsb_order) == validwhen) {
+      tocarry[k] = i;
+      outindex[i] = k;
+      k++;
+    }
+    else {
+      outindex[i] = -1;
+    }
+  }
+  return success();
+}
+
+ERROR awkward_bitmaskedarray_getitem_carry_64(
+  uint8_t* tobitmask,
+  const uint8_t* frombitmask,
+  int64_t bitmaskoffset,
+  int64_t length,
+  const int64_t* fromcarry,
+  int64_t lencarry,
+  bool lsb_order) {
+  for (int64_t i = 0;  i < (lencarry + 7) / 8;  i++) {
+    tobitmask[i] = 0;
+  }
+  for (int64_t i = 0;  i < lencarry;  i++) {
+    if (fromcarry[i] >= length) {
+      return failure("index out of range", i, fromcarry[i]);
+    }
+    if (bitmask_isset(frombitmask, bitmaskoffset, fromcarry[i], lsb_order)) {
+      tobitmask[i >> 3] |= (lsb_order ? (uint8_t)(1 << (i & 7))
+                                      : (uint8_t)(128 >> (i & 7)));
+    }
+  }
+  return success();
+}
+
+ERROR awkward_bitmaskedarray_getitem_range(
+  uint8_t* tobitmask,
+  const uint8_t* frombitmask,
+  int64_t bitmaskoffset,
+  int64_t start,
+  int64_t length,
+  bool lsb_order) {
+  // Each output byte is the rest of one input byte and the beginning of
+  // the next, shifted into place.
+  const uint8_t* bytes = &frombitmask[bitmaskoffset + start / 8];
+  int64_t shift = start % 8;
+  int64_t numbytes = (length + 7) / 8;
+  int64_t lastbyte = (start + length + 7) / 8 - start / 8;
+  for (int64_t i = 0;  i < numbytes;  i++) {
+    uint32_t first = bytes[i];
+    uint32_t second = (i + 1 < lastbyte ? bytes[i + 1] : 0);
+    if (lsb_order) {
+      tobitmask[i] = (uint8_t)((first >> shift) | (second << (8 - shift)));
+    }
+    else {
+      tobitmask[i] = (uint8_t)((first << shift) | (second >> (8 - shift)));
+    }
+  }
+  return success();
+}
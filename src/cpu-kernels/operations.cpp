@@ -1,6 +1,7 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
 #include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/parallel.h"
 
 template <typename T, typename C>
 ERROR awkward_listarray_num(
@@ -1172,10 +1173,12 @@ ERROR awkward_numpyarray_fill(
   const FROM* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)fromptr[fromoffset + i];
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[tooffset + i] = (TO)fromptr[fromoffset + i];
+    }
+    return success();
+  });
 }
 template <typename TO>
 ERROR awkward_numpyarray_fill_frombool(
@@ -1184,10 +1187,12 @@ ERROR awkward_numpyarray_fill_frombool(
   const bool* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)(fromptr[fromoffset + i] != 0);
-  }
-  return success();
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[tooffset + i] = (TO)(fromptr[fromoffset + i] != 0);
+    }
+    return success();
+  });
 }
 ERROR awkward_numpyarray_fill_todouble_fromdouble(
   double* toptr,
@@ -1364,13 +1369,15 @@ ERROR awkward_numpyarray_fill_to64_fromU64(
   const uint64_t* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    if (fromptr[fromoffset + i] > kMaxInt64) {
-      return failure("uint64 value too large for int64 output", i, kSliceNone);
+  return parallel_for(length, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      if (fromptr[fromoffset + i] > kMaxInt64) {
+        return failure("uint64 value too large for int64 output", i, kSliceNone);
+      }
+      toptr[tooffset + i] = fromptr[fromoffset + i];
     }
-    toptr[tooffset + i] = fromptr[fromoffset + i];
-  }
-  return success();
+    return success();
+  });
 }
 ERROR awkward_numpyarray_fill_to64_from32(
   int64_t* toptr,
@@ -1,6 +1,7 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
 #include "awkward/cpu-kernels/reducers.h"
+#include "awkward/cpu-kernels/parallel.h"
 
 ERROR awkward_reduce_count_64(
   int64_t* toptr,
@@ -2222,6 +2223,5512 @@ ERROR awkward_reduce_argmax_float64_64(
     outlength);
 }
 
+template <typename C>
+ERROR awkward_reduce_count_offsets(
+  int64_t* toptr,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i] = offsets[offsetsoffset + i + 1] - offsets[offsetsoffset + i];
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_count_offsets32_64(
+  int64_t* toptr,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_count_offsets<int32_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_count_offsetsU32_64(
+  int64_t* toptr,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_count_offsets<uint32_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_count_offsets_64(
+  int64_t* toptr,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_count_offsets<int64_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename IN, typename C>
+ERROR awkward_reduce_countnonzero_offsets(
+  int64_t* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int64_t out = 0;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out += (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_countnonzero_bool_offsets32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<bool, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_bool_offsetsU32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<bool, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_bool_offsets_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<bool, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int8_offsets32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int8_offsetsU32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int8_offsets_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint8_offsets32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint8_offsetsU32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint8_offsets_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int16_offsets32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int16_offsetsU32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int16_offsets_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint16_offsets32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint16_offsetsU32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint16_offsets_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int32_offsets32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int32_offsetsU32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int32_offsets_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint32_offsets32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint32_offsetsU32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint32_offsets_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint64_offsets32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint64_offsetsU32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint64_offsets_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float32_offsets32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float32_offsetsU32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float32_offsets_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float64_offsets32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float64_offsetsU32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float64_offsets_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_offsets<double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_sum_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = (OUT)0;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out += (OUT)data[j];
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+template <typename C>
+ERROR awkward_reduce_sum_int64_bool_offsets(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int64_t out = 0;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out += (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_sum_int64_bool_offsets32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int64_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_bool_offsetsU32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int64_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_bool_offsets_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int64_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int8_offsets32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int8_offsetsU32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int8_offsets_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint8_offsets32_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint8_offsetsU32_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint8_offsets_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int16_offsets32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int16_offsetsU32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int16_offsets_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint16_offsets32_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint16_offsetsU32_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint16_offsets_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int32_offsets32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int32_offsetsU32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int32_offsets_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint32_offsets32_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint32_offsetsU32_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint32_offsets_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint64_offsets32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint64_offsetsU32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint64_offsets_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float32_float32_offsets32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<float, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float32_float32_offsetsU32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<float, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float32_float32_offsets_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<float, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float64_float64_offsets32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<double, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float64_float64_offsetsU32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<double, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float64_float64_offsets_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<double, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+template <typename C>
+ERROR awkward_reduce_sum_int32_bool_offsets(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int32_t out = 0;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out += (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_sum_int32_bool_offsets32_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int32_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_bool_offsetsU32_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int32_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_bool_offsets_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_int32_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int8_offsets32_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int8_offsetsU32_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int8_offsets_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint8_offsets32_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint8_offsetsU32_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint8_offsets_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int16_offsets32_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int16_offsetsU32_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int16_offsets_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint16_offsets32_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint16_offsetsU32_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint16_offsets_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int32_offsets32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int32_offsetsU32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int32_offsets_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<int32_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint32_offsets32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint32_offsetsU32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint32_offsets_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_offsets<uint32_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename IN, typename C>
+ERROR awkward_reduce_sum_bool_offsets(
+  bool* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      bool out = (bool)0;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out |= (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_sum_bool_bool_offsets32_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<bool, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_bool_offsetsU32_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<bool, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_bool_offsets_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<bool, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int8_offsets32_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int8_offsetsU32_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int8_offsets_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint8_offsets32_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint8_offsetsU32_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint8_offsets_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int16_offsets32_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int16_offsetsU32_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int16_offsets_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint16_offsets32_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint16_offsetsU32_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint16_offsets_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int32_offsets32_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int32_offsetsU32_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int32_offsets_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint32_offsets32_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint32_offsetsU32_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint32_offsets_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int64_offsets32_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int64_offsetsU32_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int64_offsets_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint64_offsets32_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint64_offsetsU32_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint64_offsets_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float32_offsets32_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float32_offsetsU32_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float32_offsets_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float64_offsets32_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float64_offsetsU32_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float64_offsets_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_offsets<double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_prod_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = (OUT)1;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out *= (OUT)data[j];
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+template <typename C>
+ERROR awkward_reduce_prod_int64_bool_offsets(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int64_t out = 1;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out *= (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_prod_int64_bool_offsets32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int64_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_bool_offsetsU32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int64_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_bool_offsets_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int64_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int8_offsets32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int8_offsetsU32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int8_offsets_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint8_offsets32_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint8_offsetsU32_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint8_offsets_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int16_offsets32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int16_offsetsU32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int16_offsets_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint16_offsets32_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint16_offsetsU32_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint16_offsets_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int32_offsets32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int32_offsetsU32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int32_offsets_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint32_offsets32_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint32_offsetsU32_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint32_offsets_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint64_offsets32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint64_offsetsU32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint64_offsets_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float32_float32_offsets32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<float, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float32_float32_offsetsU32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<float, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float32_float32_offsets_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<float, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float64_float64_offsets32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<double, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float64_float64_offsetsU32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<double, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float64_float64_offsets_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<double, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+template <typename C>
+ERROR awkward_reduce_prod_int32_bool_offsets(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int32_t out = 1;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out *= (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_prod_int32_bool_offsets32_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int32_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_bool_offsetsU32_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int32_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_bool_offsets_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_int32_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int8_offsets32_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int8_offsetsU32_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int8_offsets_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint8_offsets32_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint8_offsetsU32_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint8_offsets_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int16_offsets32_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int16_offsetsU32_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int16_offsets_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint16_offsets32_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint16_offsetsU32_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint16_offsets_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int32_offsets32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int32_offsetsU32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int32_offsets_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<int32_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint32_offsets32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint32_offsetsU32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint32_offsets_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_offsets<uint32_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename IN, typename C>
+ERROR awkward_reduce_prod_bool_offsets(
+  bool* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      bool out = (bool)1;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        out &= (data[j] != 0);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_prod_bool_bool_offsets32_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<bool, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_bool_offsetsU32_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<bool, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_bool_offsets_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<bool, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int8_offsets32_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int8_offsetsU32_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int8_offsets_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint8_offsets32_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint8_offsetsU32_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint8_offsets_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int16_offsets32_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int16_offsetsU32_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int16_offsets_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint16_offsets32_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint16_offsetsU32_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint16_offsets_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int32_offsets32_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int32_offsetsU32_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int32_offsets_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint32_offsets32_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint32_offsetsU32_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint32_offsets_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int64_offsets32_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int64_offsetsU32_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int64_offsets_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint64_offsets32_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint64_offsetsU32_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint64_offsets_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float32_offsets32_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float32_offsetsU32_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float32_offsets_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float64_offsets32_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float64_offsetsU32_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float64_offsets_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_offsets<double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_min_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  OUT identity) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = identity;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        IN x = data[j];
+        out = (x < out ? x : out);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_min_int8_int8_offsets32_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_min_offsets<int8_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int8_int8_offsetsU32_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_min_offsets<int8_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int8_int8_offsets_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_min_offsets<int8_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint8_uint8_offsets32_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_min_offsets<uint8_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint8_uint8_offsetsU32_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_min_offsets<uint8_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint8_uint8_offsets_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_min_offsets<uint8_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int16_int16_offsets32_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_min_offsets<int16_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int16_int16_offsetsU32_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_min_offsets<int16_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int16_int16_offsets_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_min_offsets<int16_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint16_uint16_offsets32_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_min_offsets<uint16_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint16_uint16_offsetsU32_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_min_offsets<uint16_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint16_uint16_offsets_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_min_offsets<uint16_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int32_int32_offsets32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_min_offsets<int32_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int32_int32_offsetsU32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_min_offsets<int32_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int32_int32_offsets_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_min_offsets<int32_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint32_uint32_offsets32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_min_offsets<uint32_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint32_uint32_offsetsU32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_min_offsets<uint32_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint32_uint32_offsets_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_min_offsets<uint32_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int64_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_min_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int64_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_min_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int64_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_min_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint64_uint64_offsets32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_min_offsets<uint64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint64_uint64_offsetsU32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_min_offsets<uint64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint64_uint64_offsets_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_min_offsets<uint64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float32_float32_offsets32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_min_offsets<float, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float32_float32_offsetsU32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_min_offsets<float, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float32_float32_offsets_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_min_offsets<float, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float64_float64_offsets32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_min_offsets<double, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float64_float64_offsetsU32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_min_offsets<double, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float64_float64_offsets_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_min_offsets<double, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_max_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  OUT identity) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = identity;
+      for (int64_t j = offsets[offsetsoffset + i];  j < end;  j++) {
+        IN x = data[j];
+        out = (x > out ? x : out);
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_max_int8_int8_offsets32_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_max_offsets<int8_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int8_int8_offsetsU32_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_max_offsets<int8_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int8_int8_offsets_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_max_offsets<int8_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint8_uint8_offsets32_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_max_offsets<uint8_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint8_uint8_offsetsU32_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_max_offsets<uint8_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint8_uint8_offsets_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_max_offsets<uint8_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int16_int16_offsets32_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_max_offsets<int16_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int16_int16_offsetsU32_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_max_offsets<int16_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int16_int16_offsets_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_max_offsets<int16_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint16_uint16_offsets32_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_max_offsets<uint16_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint16_uint16_offsetsU32_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_max_offsets<uint16_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint16_uint16_offsets_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_max_offsets<uint16_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int32_int32_offsets32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_max_offsets<int32_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int32_int32_offsetsU32_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_max_offsets<int32_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int32_int32_offsets_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_max_offsets<int32_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint32_uint32_offsets32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_max_offsets<uint32_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint32_uint32_offsetsU32_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_max_offsets<uint32_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint32_uint32_offsets_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_max_offsets<uint32_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int64_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_max_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int64_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_max_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int64_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_max_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint64_uint64_offsets32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_max_offsets<uint64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint64_uint64_offsetsU32_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_max_offsets<uint64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint64_uint64_offsets_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_max_offsets<uint64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float32_float32_offsets32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_max_offsets<float, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float32_float32_offsetsU32_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_max_offsets<float, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float32_float32_offsets_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_max_offsets<float, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float64_float64_offsets32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_max_offsets<double, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float64_float64_offsetsU32_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_max_offsets<double, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float64_float64_offsets_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_max_offsets<double, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_argmin_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t begin = offsets[offsetsoffset + i];
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = -1;
+      for (int64_t j = begin;  j < end;  j++) {
+        if (out == -1  ||
+            data[j] < data[begin + out]) {
+          out = j - begin;
+        }
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+template <typename C>
+ERROR awkward_reduce_argmin_bool_offsets(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t begin = offsets[offsetsoffset + i];
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int64_t out = -1;
+      for (int64_t j = begin;  j < end;  j++) {
+        if (out == -1  ||
+            (data[j] != 0) < (data[begin + out] != 0)) {
+          out = j - begin;
+        }
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_argmin_bool_offsets32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_bool_offsetsU32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_bool_offsets_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int8_offsets32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int8_offsetsU32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int8_offsets_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint8_offsets32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint8_offsetsU32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint8_offsets_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int16_offsets32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int16_offsetsU32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int16_offsets_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint16_offsets32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint16_offsetsU32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint16_offsets_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int32_offsets32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int32_offsetsU32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int32_offsets_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint32_offsets32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint32_offsetsU32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint32_offsets_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint64_offsets32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint64_offsetsU32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint64_offsets_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float32_offsets32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float32_offsetsU32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float32_offsets_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float64_offsets32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float64_offsetsU32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float64_offsets_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_offsets<int64_t, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN, typename C>
+ERROR awkward_reduce_argmax_offsets(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const IN* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t begin = offsets[offsetsoffset + i];
+      int64_t end = offsets[offsetsoffset + i + 1];
+      OUT out = -1;
+      for (int64_t j = begin;  j < end;  j++) {
+        if (out == -1  ||
+            data[j] > data[begin + out]) {
+          out = j - begin;
+        }
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+template <typename C>
+ERROR awkward_reduce_argmax_bool_offsets(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  const bool* data = fromptr + fromptroffset;
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t begin = offsets[offsetsoffset + i];
+      int64_t end = offsets[offsetsoffset + i + 1];
+      int64_t out = -1;
+      for (int64_t j = begin;  j < end;  j++) {
+        if (out == -1  ||
+            (data[j] != 0) > (data[begin + out] != 0)) {
+          out = j - begin;
+        }
+      }
+      toptr[i] = out;
+    }
+    return success();
+  });
+}
+ERROR awkward_reduce_argmax_bool_offsets32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_bool_offsets<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_bool_offsetsU32_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_bool_offsets<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_bool_offsets_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_bool_offsets<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int8_offsets32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int8_offsetsU32_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int8_offsets_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint8_offsets32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint8_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint8_offsetsU32_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint8_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint8_offsets_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint8_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int16_offsets32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int16_offsetsU32_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int16_offsets_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint16_offsets32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint16_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint16_offsetsU32_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint16_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint16_offsets_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint16_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int32_offsets32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int32_offsetsU32_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int32_offsets_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint32_offsets32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint32_offsetsU32_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint32_offsets_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint32_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int64_offsets32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int64_offsetsU32_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int64_offsets_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint64_offsets32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint64_offsetsU32_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint64_offsets_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, uint64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float32_offsets32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, float, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float32_offsetsU32_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, float, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float32_offsets_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, float, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float64_offsets32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, double, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float64_offsetsU32_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, double, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float64_offsets_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_offsets<int64_t, double, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
 ERROR awkward_content_reduce_zeroparents_64(
   int64_t* toparents,
   int64_t length) {
@@ -2231,21 +7738,62 @@ ERROR awkward_content_reduce_zeroparents_64(
   return success();
 }
 
-ERROR awkward_listoffsetarray_reduce_global_startstop_64(
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_global_startstop(
   int64_t* globalstart,
   int64_t* globalstop,
-  const int64_t* offsets,
+  const C* offsets,
   int64_t offsetsoffset,
   int64_t length) {
   *globalstart = offsets[offsetsoffset + 0];
   *globalstop = offsets[offsetsoffset + length];
   return success();
 }
+ERROR awkward_listoffsetarray32_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_global_startstop<int32_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_global_startstop<uint32_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_global_startstop<int64_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
 
-ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy(
   int64_t* maxcount,
   int64_t* offsetscopy,
-  const int64_t* offsets,
+  const C* offsets,
   int64_t offsetsoffset,
   int64_t length) {
   *maxcount = 0;
@@ -2260,8 +7808,48 @@ ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
   }
   return success();
 }
+ERROR awkward_listoffsetarray32_reduce_nonlocal_maxcount_offsetscopy_64(
+  int64_t* maxcount,
+  int64_t* offsetscopy,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy<int32_t>(
+    maxcount,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_nonlocal_maxcount_offsetscopy_64(
+  int64_t* maxcount,
+  int64_t* offsetscopy,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy<uint32_t>(
+    maxcount,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+  int64_t* maxcount,
+  int64_t* offsetscopy,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy<int64_t>(
+    maxcount,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length);
+}
 
-ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext(
   int64_t* nextcarry,
   int64_t* nextparents,
   int64_t nextlen,
@@ -2269,7 +7857,7 @@ ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
   int64_t* distincts,
   int64_t distinctslen,
   int64_t* offsetscopy,
-  const int64_t* offsets,
+  const C* offsets,
   int64_t offsetsoffset,
   int64_t length,
   const int64_t* parents,
@@ -2309,6 +7897,93 @@ ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
   }
   return success();
 }
+ERROR awkward_listoffsetarray32_reduce_nonlocal_preparenext_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t nextlen,
+  int64_t* maxnextparents,
+  int64_t* distincts,
+  int64_t distinctslen,
+  int64_t* offsetscopy,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t maxcount) {
+  return awkward_listoffsetarray_reduce_nonlocal_preparenext<int32_t>(
+    nextcarry,
+    nextparents,
+    nextlen,
+    maxnextparents,
+    distincts,
+    distinctslen,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    maxcount);
+}
+ERROR awkward_listoffsetarrayU32_reduce_nonlocal_preparenext_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t nextlen,
+  int64_t* maxnextparents,
+  int64_t* distincts,
+  int64_t distinctslen,
+  int64_t* offsetscopy,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t maxcount) {
+  return awkward_listoffsetarray_reduce_nonlocal_preparenext<uint32_t>(
+    nextcarry,
+    nextparents,
+    nextlen,
+    maxnextparents,
+    distincts,
+    distinctslen,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    maxcount);
+}
+ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t nextlen,
+  int64_t* maxnextparents,
+  int64_t* distincts,
+  int64_t distinctslen,
+  int64_t* offsetscopy,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t maxcount) {
+  return awkward_listoffsetarray_reduce_nonlocal_preparenext<int64_t>(
+    nextcarry,
+    nextparents,
+    nextlen,
+    maxnextparents,
+    distincts,
+    distinctslen,
+    offsetscopy,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    maxcount);
+}
 
 ERROR awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
   int64_t* nextstarts,
@@ -2373,9 +8048,10 @@ ERROR awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
   return success();
 }
 
-ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_local_nextparents(
   int64_t* nextparents,
-  const int64_t* offsets,
+  const C* offsets,
   int64_t offsetsoffset,
   int64_t length) {
   int64_t initialoffset = offsets[offsetsoffset];
@@ -2388,6 +8064,85 @@ ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
   }
   return success();
 }
+ERROR awkward_listoffsetarray32_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<int32_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<uint32_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<int64_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
+
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_local_starts(
+  int64_t* starts,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  int64_t initialoffset = offsets[offsetsoffset];
+  for (int64_t i = 0;  i < length;  i++) {
+    starts[i] = (int64_t)offsets[offsetsoffset + i] - initialoffset;
+  }
+  return success();
+}
+ERROR awkward_listoffsetarray32_reduce_local_starts_64(
+  int64_t* starts,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_starts<int32_t>(
+    starts,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_local_starts_64(
+  int64_t* starts,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_starts<uint32_t>(
+    starts,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray_reduce_local_starts_64(
+  int64_t* starts,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_starts<int64_t>(
+    starts,
+    offsets,
+    offsetsoffset,
+    length);
+}
 
 ERROR awkward_listoffsetarray_reduce_local_outoffsets_64(
   int64_t* outoffsets,
@@ -2521,6 +8276,53 @@ ERROR awkward_numpyarray_reduce_mask_bytemaskedarray(
   return success();
 }
 
+template <typename C>
+ERROR awkward_numpyarray_reduce_mask_bytemaskedarray_offsets(
+  int8_t* toptr,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return parallel_for(outlength, [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i] = (offsets[offsetsoffset + i] == offsets[offsetsoffset + i + 1]);
+    }
+    return success();
+  });
+}
+ERROR awkward_numpyarray_reduce_mask_bytemaskedarray_offsets32_64(
+  int8_t* toptr,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_numpyarray_reduce_mask_bytemaskedarray_offsets<int32_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_numpyarray_reduce_mask_bytemaskedarray_offsetsU32_64(
+  int8_t* toptr,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_numpyarray_reduce_mask_bytemaskedarray_offsets<uint32_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64(
+  int8_t* toptr,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_numpyarray_reduce_mask_bytemaskedarray_offsets<int64_t>(
+    toptr,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
 ERROR awkward_bytemaskedarray_reduce_next_64(
   int64_t* nextcarry,
   int64_t* nextparents,
@@ -2545,3 +8347,36 @@ ERROR awkward_bytemaskedarray_reduce_next_64(
   }
   return success();
 }
+
+ERROR awkward_bitmaskedarray_reduce_next_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t* outindex,
+  const uint8_t* bitmask,
+  int64_t bitmaskoffset,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  // Each byte of the mask is loaded once and its bits tested in turn.
+  int64_t k = 0;
+  for (int64_t i = 0;  i < length;  i += 8) {
+    uint8_t byte = bitmask[bitmaskoffset + i / 8];
+    int64_t stop = (i + 8 < length ? i + 8 : length);
+    for (int64_t j = i;  j < stop;  j++) {
+      bool isset = (lsb_order ? ((byte >> (j - i)) & 1) != 0
+                              : ((byte << (j - i)) & 128) != 0);
+      if (isset == validwhen) {
+        nextcarry[k] = j;
+        nextparents[k] = parents[parentsoffset + j];
+        outindex[j] = k;
+        k++;
+      }
+      else {
+        outindex[j] = -1;
+      }
+    }
+  }
+  return success();
+}
@@ -0,0 +1,328 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef _MSC_VER
+  #include <malloc.h>
+#endif
+
+#include "awkward/Allocator.h"
+
+namespace awkward {
+  namespace {
+    void*
+    aligned_malloc(int64_t bytes) {
+      size_t size = (size_t)(bytes < Allocator::kAlignment
+                                 ? Allocator::kAlignment : bytes);
+#ifdef _MSC_VER
+      void* out = _aligned_malloc(size, (size_t)Allocator::kAlignment);
+#else
+      void* out;
+      if (posix_memalign(&out, (size_t)Allocator::kAlignment, size) != 0) {
+        out = nullptr;
+      }
+#endif
+      if (out == nullptr) {
+        throw std::bad_alloc();
+      }
+      return out;
+    }
+
+    void
+    aligned_free(void* ptr) {
+#ifdef _MSC_VER
+      _aligned_free(ptr);
+#else
+      free(ptr);
+#endif
+    }
+
+    // Size class k holds blocks of 2**(kMinShift + k) bytes.
+    const int64_t kMinShift = 6;
+    const int64_t kMaxShift = 20;
+    const int64_t kNumClasses = kMaxShift - kMinShift + 1;
+
+    // Per size class, a thread keeps up to kThreadCacheBytes (but at least
+    // 2 and at most 64 blocks); the central cache keeps 4 times as many.
+    const int64_t kThreadCacheBytes = 1048576;
+
+    int64_t
+    size_class(int64_t bytes) {
+      int64_t shift = kMinShift;
+      while (((int64_t)1 << shift) < bytes) {
+        shift++;
+      }
+      return shift - kMinShift;
+    }
+
+    int64_t
+    thread_limit(int64_t cls) {
+      int64_t out = kThreadCacheBytes >> (kMinShift + cls);
+      return out < 2 ? 2 : (out > 64 ? 64 : out);
+    }
+
+    struct Block {
+      Block* next;
+    };
+
+    struct FreeList {
+      Block* head;
+      int64_t count;
+
+      void
+      push(void* ptr) {
+        Block* block = reinterpret_cast<Block*>(ptr);
+        block->next = head;
+        head = block;
+        count++;
+      }
+
+      void*
+      pop() {
+        Block* block = head;
+        head = block->next;
+        count--;
+        return block;
+      }
+
+      void
+      clear() {
+        while (head != nullptr) {
+          aligned_free(pop());
+        }
+      }
+    };
+
+    class CentralCache {
+    public:
+      CentralCache(): bytes_(0) {
+        for (int64_t cls = 0;  cls < kNumClasses;  cls++) {
+          lists_[cls] = { nullptr, 0 };
+        }
+      }
+
+      // Moves up to `howmany` blocks into `list`.
+      void
+      take(int64_t cls, FreeList& list, int64_t howmany) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& central = lists_[cls];
+        int64_t moved = 0;
+        while (central.head != nullptr  &&  moved < howmany) {
+          list.push(central.pop());
+          moved++;
+        }
+        bytes_ -= moved << (kMinShift + cls);
+      }
+
+      // Moves `howmany` blocks out of `list`; those that don't fit are freed.
+      void
+      give(int64_t cls, FreeList& list, int64_t howmany) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& central = lists_[cls];
+        int64_t limit = 4*thread_limit(cls);
+        for (int64_t i = 0;  i < howmany;  i++) {
+          void* ptr = list.pop();
+          if (central.count < limit) {
+            central.push(ptr);
+            bytes_ += (int64_t)1 << (kMinShift + cls);
+          }
+          else {
+            aligned_free(ptr);
+          }
+        }
+      }
+
+      int64_t
+      bytes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+      }
+
+      void
+      clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int64_t cls = 0;  cls < kNumClasses;  cls++) {
+          lists_[cls].clear();
+        }
+        bytes_ = 0;
+      }
+
+    private:
+      std::mutex mutex_;
+      FreeList lists_[kNumClasses];
+      int64_t bytes_;
+    };
+
+    // Never destroyed, so that buffers released during static destruction
+    // still have somewhere to go.
+    CentralCache*
+    central() {
+      static CentralCache* out = new CentralCache();
+      return out;
+    }
+
+    // Trivially destructible, so it can still be read after the thread's
+    // ThreadCache has been destroyed.
+    thread_local bool thread_cache_destroyed = false;
+
+    struct ThreadCache {
+      FreeList lists[kNumClasses];
+
+      ThreadCache() {
+        for (int64_t cls = 0;  cls < kNumClasses;  cls++) {
+          lists[cls] = { nullptr, 0 };
+        }
+      }
+
+      ~ThreadCache() {
+        for (int64_t cls = 0;  cls < kNumClasses;  cls++) {
+          central()->give(cls, lists[cls], lists[cls].count);
+        }
+        thread_cache_destroyed = true;
+      }
+    };
+
+    thread_local ThreadCache thread_cache;
+
+    // Every Allocator that has been made current, kept alive because the
+    // buffers it provided hold plain pointers to it. util::allocate only
+    // reads the raw pointer to the current one, so it never touches a
+    // reference count. Never destroyed, like the central cache.
+    struct Installed {
+      std::mutex mutex;
+      std::vector<AllocatorPtr> allocators;
+      AllocatorPtr owner;
+      std::atomic<Allocator*> current;
+
+      Installed()
+          : allocators(1, std::make_shared<PoolAllocator>())
+          , owner(allocators[0])
+          , current(owner.get()) { }
+    };
+
+    Installed*
+    installed() {
+      static Installed* out = new Installed();
+      return out;
+    }
+  }
+
+  const int64_t Allocator::kAlignment;
+
+  Allocator::~Allocator() = default;
+
+  const AllocatorPtr
+  Allocator::current() {
+    Installed* state = installed();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->owner;
+  }
+
+  Allocator*
+  Allocator::current_raw() {
+    return installed()->current.load(std::memory_order_acquire);
+  }
+
+  void
+  Allocator::set_current(const AllocatorPtr& allocator) {
+    Installed* state = installed();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->owner = (allocator.get() == nullptr ? state->allocators[0]
+                                               : allocator);
+    bool seen = false;
+    for (auto& x : state->allocators) {
+      seen = seen  ||  (x.get() == state->owner.get());
+    }
+    if (!seen) {
+      state->allocators.push_back(state->owner);
+    }
+    state->current.store(state->owner.get(), std::memory_order_release);
+  }
+
+  const std::string
+  HeapAllocator::classname() const {
+    return "HeapAllocator";
+  }
+
+  void*
+  HeapAllocator::allocate(int64_t bytes) {
+    return aligned_malloc(bytes);
+  }
+
+  void
+  HeapAllocator::deallocate(void* ptr, int64_t bytes) {
+    aligned_free(ptr);
+  }
+
+  const int64_t PoolAllocator::kMaxPooled;
+
+  const std::string
+  PoolAllocator::classname() const {
+    return "PoolAllocator";
+  }
+
+  void*
+  PoolAllocator::allocate(int64_t bytes) {
+    if (bytes > kMaxPooled) {
+      return aligned_malloc(bytes);
+    }
+    int64_t cls = size_class(bytes);
+    if (thread_cache_destroyed) {
+      FreeList list = { nullptr, 0 };
+      central()->take(cls, list, 1);
+      return list.head != nullptr
+                 ? list.pop() : aligned_malloc((int64_t)1 << (kMinShift + cls));
+    }
+    FreeList& list = thread_cache.lists[cls];
+    if (list.head == nullptr) {
+      central()->take(cls, list, (thread_limit(cls) + 1) / 2);
+    }
+    if (list.head != nullptr) {
+      return list.pop();
+    }
+    return aligned_malloc((int64_t)1 << (kMinShift + cls));
+  }
+
+  void
+  PoolAllocator::deallocate(void* ptr, int64_t bytes) {
+    if (ptr == nullptr) {
+      return;
+    }
+    if (bytes > kMaxPooled) {
+      aligned_free(ptr);
+      return;
+    }
+    int64_t cls = size_class(bytes);
+    if (thread_cache_destroyed) {
+      FreeList list = { nullptr, 0 };
+      list.push(ptr);
+      central()->give(cls, list, 1);
+      return;
+    }
+    FreeList& list = thread_cache.lists[cls];
+    list.push(ptr);
+    int64_t limit = thread_limit(cls);
+    if (list.count > limit) {
+      central()->give(cls, list, list.count - limit / 2);
+    }
+  }
+
+  int64_t
+  PoolAllocator::cached_bytes() const {
+    return central()->bytes();
+  }
+
+  void
+  PoolAllocator::release() {
+    if (!thread_cache_destroyed) {
+      for (int64_t cls = 0;  cls < kNumClasses;  cls++) {
+        thread_cache.lists[cls].clear();
+      }
+    }
+    central()->clear();
+  }
+}
@@ -7,6 +7,7 @@
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
 
+#include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
 #include "awkward/cpu-kernels/reducers.h"
 #include "awkward/array/RegularArray.h"
@@ -612,6 +613,24 @@ namespace awkward {
     }
   }
 
+  void
+  Content::tojson_elements(ToJson& builder,
+                           int64_t start,
+                           int64_t stop) const {
+    for (int64_t i = start;  i < stop;  i++) {
+      getitem_at_nowrap(i).get()->tojson_part(builder, true);
+    }
+  }
+
+  void
+  Content::tojson_sublist(ToJson& builder,
+                          int64_t start,
+                          int64_t stop) const {
+    builder.beginlist();
+    tojson_elements(builder, start, stop);
+    builder.endlist();
+  }
+
   int64_t
   Content::nbytes() const {
     // FIXME: this is only accurate if all subintervals of allocated arrays are
@@ -763,6 +782,95 @@ namespace awkward {
     return util::parameter_asstring(parameters_, key);
   }
 
+  const ContentPtr
+  Content::reverse_merge(const ContentPtr& other) const {
+    throw std::runtime_error(
+      std::string("reverse_merge is not defined for ") + classname());
+  }
+
+  const ContentPtr
+  Content::merge_many(const ContentPtrVec& others, bool mergebool) const {
+    ContentPtrVec inputs({ shallow_copy() });
+    inputs.insert(inputs.end(), others.begin(), others.end());
+    for (auto& x : inputs) {
+      if (x.get()->kind() == ContentKind::VirtualArray) {
+        x = static_cast<VirtualArray*>(x.get())->array();
+      }
+    }
+
+    // A leading VirtualArray or EmptyArray hands over to the first input
+    // that has its own merge_many.
+    if (kind() == ContentKind::VirtualArray  ||
+        kind() == ContentKind::EmptyArray) {
+      size_t first = 0;
+      while (first + 1 < inputs.size()  &&
+             inputs[first].get()->kind() == ContentKind::EmptyArray) {
+        first++;
+      }
+      if (inputs[first].get()->kind() != ContentKind::EmptyArray  ||
+          kind() == ContentKind::VirtualArray) {
+        ContentPtrVec rest(inputs.begin() + first + 1, inputs.end());
+        return inputs[first].get()->merge_many(rest, mergebool);
+      }
+    }
+
+    if (!all_mergeable(inputs, mergebool)) {
+      return merge_many_as_union(inputs, mergebool);
+    }
+    for (auto& x : inputs) {
+      switch (x.get()->kind()) {
+        case ContentKind::IndexedArray32:
+        case ContentKind::IndexedArrayU32:
+        case ContentKind::IndexedArray64:
+        case ContentKind::IndexedOptionArray32:
+        case ContentKind::IndexedOptionArray64:
+        case ContentKind::ByteMaskedArray:
+        case ContentKind::BitMaskedArray:
+        case ContentKind::UnmaskedArray:
+          return merge_many_as_indexed(inputs, mergebool);
+        default:
+          break;
+      }
+    }
+
+    ContentPtrVec level(inputs);
+    while (level.size() > 1) {
+      ContentPtrVec next;
+      for (size_t i = 0;  i + 1 < level.size();  i += 2) {
+        next.push_back(level[i].get()->merge(level[i + 1]));
+      }
+      if (level.size() % 2 == 1) {
+        next.push_back(level.back());
+      }
+      level = next;
+    }
+    return level[0];
+  }
+
+  const ContentPtr
+  Content::option_content(const ContentPtr& other) {
+    switch (other.get()->kind()) {
+      case ContentKind::IndexedArray32:
+        return static_cast<IndexedArray32*>(other.get())->content();
+      case ContentKind::IndexedArrayU32:
+        return static_cast<IndexedArrayU32*>(other.get())->content();
+      case ContentKind::IndexedArray64:
+        return static_cast<IndexedArray64*>(other.get())->content();
+      case ContentKind::IndexedOptionArray32:
+        return static_cast<IndexedOptionArray32*>(other.get())->content();
+      case ContentKind::IndexedOptionArray64:
+        return static_cast<IndexedOptionArray64*>(other.get())->content();
+      case ContentKind::ByteMaskedArray:
+        return static_cast<ByteMaskedArray*>(other.get())->content();
+      case ContentKind::BitMaskedArray:
+        return static_cast<BitMaskedArray*>(other.get())->content();
+      case ContentKind::UnmaskedArray:
+        return static_cast<UnmaskedArray*>(other.get())->content();
+      default:
+        return other;
+    }
+  }
+
   const ContentPtr
   Content::merge_as_union(const ContentPtr& other) const {
     int64_t mylength = length();
@@ -803,6 +911,325 @@ namespace awkward {
                                             contents);
   }
 
+  bool
+  Content::all_mergeable(const ContentPtrVec& inputs, bool mergebool) {
+    ContentPtr first(nullptr);
+    for (auto& x : inputs) {
+      switch (x.get()->kind()) {
+        case ContentKind::UnionArray8_32:
+        case ContentKind::UnionArray8_U32:
+        case ContentKind::UnionArray8_64:
+          return false;
+        case ContentKind::EmptyArray:
+          break;
+        default:
+          if (first.get() == nullptr) {
+            first = x;
+          }
+          else if (!first.get()->mergeable(x, mergebool)) {
+            return false;
+          }
+      }
+    }
+    return true;
+  }
+
+  namespace {
+    // Fills `index` from an indexed array's index, shifted past the `base`
+    // items of the contents before it, and returns its content.
+    template <typename INDEXED, typename T>
+    const ContentPtr
+    fill_indexed(Index64& index,
+                 int64_t at,
+                 int64_t base,
+                 const ContentPtr& x,
+                 struct Error (*fill)(int64_t*,
+                                      int64_t,
+                                      const T*,
+                                      int64_t,
+                                      int64_t,
+                                      int64_t)) {
+      INDEXED* raw = static_cast<INDEXED*>(x.get());
+      IndexOf<T> xindex = raw->index();
+      struct Error err = fill(index.ptr().get(),
+                              at,
+                              xindex.ptr().get(),
+                              xindex.offset(),
+                              raw->length(),
+                              base);
+      util::handle_error(err, raw->classname(), raw->identities().get());
+      return raw->content();
+    }
+
+    // Fills the tags and index for the pieces of one union input, whose
+    // content `which` goes to content `towhich` of the output, after the
+    // `base` items already there.
+    template <typename UNION, typename INDEX>
+    struct Error
+    fill_union_piece(Index8& tags,
+                     Index64& index,
+                     int64_t at,
+                     const UNION* raw,
+                     int64_t which,
+                     int64_t towhich,
+                     int64_t base,
+                     struct Error (*simplify_one)(int8_t*,
+                                                  int64_t*,
+                                                  const int8_t*,
+                                                  int64_t,
+                                                  const INDEX*,
+                                                  int64_t,
+                                                  int64_t,
+                                                  int64_t,
+                                                  int64_t,
+                                                  int64_t)) {
+      Index8 fromtags = raw->tags();
+      IndexOf<INDEX> fromindex = raw->index();
+      return simplify_one(tags.ptr().get() + at,
+                          index.ptr().get() + at,
+                          fromtags.ptr().get(),
+                          fromtags.offset(),
+                          fromindex.ptr().get(),
+                          fromindex.offset(),
+                          towhich,
+                          which,
+                          raw->length(),
+                          base);
+    }
+  }
+
+  const ContentPtr
+  Content::merge_many_as_indexed(const ContentPtrVec& inputs,
+                                 bool mergebool) {
+    int64_t total = 0;
+    for (auto& x : inputs) {
+      total += x.get()->length();
+    }
+    Index64 index(total);
+    ContentPtrVec contents;
+    util::Parameters parameters;
+    bool isoption = false;
+    int64_t at = 0;
+    int64_t base = 0;
+    for (auto& input : inputs) {
+      ContentPtr x = input;
+      switch (x.get()->kind()) {
+        case ContentKind::EmptyArray:
+          continue;
+        case ContentKind::ByteMaskedArray:
+          x = static_cast<ByteMaskedArray*>(x.get())->toIndexedOptionArray64();
+          break;
+        case ContentKind::BitMaskedArray:
+          x = static_cast<BitMaskedArray*>(x.get())->toIndexedOptionArray64();
+          break;
+        case ContentKind::UnmaskedArray:
+          x = static_cast<UnmaskedArray*>(x.get())->toIndexedOptionArray64();
+          break;
+        default:
+          break;
+      }
+      if (contents.empty()) {
+        parameters = x.get()->parameters();
+      }
+
+      // Indexes are shifted past the contents before them; other arrays
+      // become their own contents, indexed in order.
+      int64_t length = x.get()->length();
+      ContentPtr content;
+      switch (x.get()->kind()) {
+        case ContentKind::IndexedArray32:
+          content = fill_indexed<IndexedArray32>(
+            index, at, base, x, awkward_indexedarray_fill_to64_from32);
+          break;
+        case ContentKind::IndexedArrayU32:
+          content = fill_indexed<IndexedArrayU32>(
+            index, at, base, x, awkward_indexedarray_fill_to64_fromU32);
+          break;
+        case ContentKind::IndexedArray64:
+          content = fill_indexed<IndexedArray64>(
+            index, at, base, x, awkward_indexedarray_fill_to64_from64);
+          break;
+        case ContentKind::IndexedOptionArray32:
+          content = fill_indexed<IndexedOptionArray32>(
+            index, at, base, x, awkward_indexedarray_fill_to64_from32);
+          isoption = true;
+          break;
+        case ContentKind::IndexedOptionArray64:
+          content = fill_indexed<IndexedOptionArray64>(
+            index, at, base, x, awkward_indexedarray_fill_to64_from64);
+          isoption = true;
+          break;
+        default: {
+          content = x;
+          struct Error err = awkward_indexedarray_fill_to64_count(
+            index.ptr().get(),
+            at,
+            length,
+            base);
+          util::handle_error(err,
+                             x.get()->classname(),
+                             x.get()->identities().get());
+        }
+      }
+      contents.push_back(content);
+      at += length;
+      base += content.get()->length();
+    }
+
+    ContentPtrVec rest(contents.begin() + 1, contents.end());
+    ContentPtr content = contents[0].get()->merge_many(rest, mergebool);
+    if (isoption) {
+      return std::make_shared<IndexedOptionArray64>(Identities::none(),
+                                                    parameters,
+                                                    index,
+                                                    content);
+    }
+    else {
+      return std::make_shared<IndexedArray64>(Identities::none(),
+                                              parameters,
+                                              index,
+                                              content);
+    }
+  }
+
+  const ContentPtr
+  Content::merge_many_as_union(const ContentPtrVec& inputs,
+                               bool mergebool) {
+    int64_t total = 0;
+    for (auto& x : inputs) {
+      total += x.get()->length();
+    }
+    Index8 tags(total);
+    Index64 index(total);
+
+    // Each nonempty piece (a union's content or any other input) joins the
+    // first group that it is mergeable with.
+    std::vector<ContentPtrVec> groups;
+    std::vector<int64_t> grouplengths;
+    auto groupof = [&](const ContentPtr& piece) -> int64_t {
+      for (size_t g = 0;  g < groups.size();  g++) {
+        if (groups[g][0].get()->mergeable(piece, mergebool)) {
+          return (int64_t)g;
+        }
+      }
+      groups.push_back(ContentPtrVec());
+      grouplengths.push_back(0);
+      return (int64_t)groups.size() - 1;
+    };
+    auto add = [&](const ContentPtr& piece, int64_t g) -> void {
+      groups[(size_t)g].push_back(piece);
+      grouplengths[(size_t)g] += piece.get()->length();
+    };
+
+    // The union's own parameters are kept if every input is such a union.
+    bool allunions = true;
+    int64_t at = 0;
+    for (auto& x : inputs) {
+      int64_t length = x.get()->length();
+      switch (x.get()->kind()) {
+        case ContentKind::UnionArray8_32: {
+          UnionArray8_32* raw = static_cast<UnionArray8_32*>(x.get());
+          for (int64_t k = 0;  k < raw->numcontents();  k++) {
+            ContentPtr piece = raw->content(k);
+            if (piece.get()->length() != 0) {
+              int64_t g = groupof(piece);
+              struct Error err = fill_union_piece(
+                tags, index, at, raw, k, g, grouplengths[(size_t)g],
+                awkward_unionarray8_32_simplify_one_to8_64);
+              util::handle_error(err, raw->classname(),
+                                 raw->identities().get());
+              add(piece, g);
+            }
+          }
+          break;
+        }
+        case ContentKind::UnionArray8_U32: {
+          UnionArray8_U32* raw = static_cast<UnionArray8_U32*>(x.get());
+          for (int64_t k = 0;  k < raw->numcontents();  k++) {
+            ContentPtr piece = raw->content(k);
+            if (piece.get()->length() != 0) {
+              int64_t g = groupof(piece);
+              struct Error err = fill_union_piece(
+                tags, index, at, raw, k, g, grouplengths[(size_t)g],
+                awkward_unionarray8_U32_simplify_one_to8_64);
+              util::handle_error(err, raw->classname(),
+                                 raw->identities().get());
+              add(piece, g);
+            }
+          }
+          break;
+        }
+        case ContentKind::UnionArray8_64: {
+          UnionArray8_64* raw = static_cast<UnionArray8_64*>(x.get());
+          for (int64_t k = 0;  k < raw->numcontents();  k++) {
+            ContentPtr piece = raw->content(k);
+            if (piece.get()->length() != 0) {
+              int64_t g = groupof(piece);
+              struct Error err = fill_union_piece(
+                tags, index, at, raw, k, g, grouplengths[(size_t)g],
+                awkward_unionarray8_64_simplify_one_to8_64);
+              util::handle_error(err, raw->classname(),
+                                 raw->identities().get());
+              add(piece, g);
+            }
+          }
+          break;
+        }
+        default: {
+          allunions = false;
+          if (length != 0) {
+            int64_t g = groupof(x);
+            struct Error err1 = awkward_unionarray_filltags_to8_const(
+              tags.ptr().get(),
+              at,
+              length,
+              g);
+            util::handle_error(err1, x.get()->classname(),
+                               x.get()->identities().get());
+            struct Error err2 = awkward_indexedarray_fill_to64_count(
+              index.ptr().get(),
+              at,
+              length,
+              grouplengths[(size_t)g]);
+            util::handle_error(err2, x.get()->classname(),
+                               x.get()->identities().get());
+            add(x, g);
+          }
+        }
+      }
+      at += length;
+    }
+
+    if (groups.empty()) {
+      // Every input is empty.
+      return inputs[0];
+    }
+    if (groups.size() > kMaxInt8) {
+      throw std::runtime_error(
+        "FIXME: handle UnionArray with more than 127 contents");
+    }
+    ContentPtrVec contents;
+    for (auto& group : groups) {
+      ContentPtrVec rest(group.begin() + 1, group.end());
+      contents.push_back(group[0].get()->merge_many(rest, mergebool));
+    }
+    util::Parameters parameters;
+    if (allunions) {
+      parameters = inputs[0].get()->parameters();
+      for (auto& x : inputs) {
+        if (!x.get()->parameters_equal(parameters)) {
+          parameters = util::Parameters();
+          break;
+        }
+      }
+    }
+    return std::make_shared<UnionArray8_64>(Identities::none(),
+                                            parameters,
+                                            tags,
+                                            index,
+                                            contents);
+  }
+
   const ContentPtr
   Content::rpad_axis0(int64_t target, bool clip) const {
     if (!clip  &&  target < length()) {
@@ -863,8 +1290,7 @@ namespace awkward {
     std::vector<std::shared_ptr<int64_t>> tocarry;
     std::vector<int64_t*> tocarryraw;
     for (int64_t j = 0;  j < n;  j++) {
-      std::shared_ptr<int64_t> ptr(new int64_t[(size_t)combinationslen],
-                                   util::array_deleter<int64_t>());
+      std::shared_ptr<int64_t> ptr = util::allocate<int64_t>(combinationslen);
       tocarry.push_back(ptr);
       tocarryraw.push_back(ptr.get());
     }
@@ -892,6 +1318,43 @@ namespace awkward {
 
   const ContentPtr
   Content::getitem(const Slice& where) const {
+    // The most common single-item slices can skip the RegularArray wrapper
+    // and the extra carry that the general path needs.
+    if (where.length() == 1) {
+      SliceItemPtr head = where.head();
+      switch (head.get()->kind()) {
+        case SliceKind::at:
+          return getitem_at(static_cast<SliceAt*>(head.get())->at());
+        case SliceKind::range: {
+          SliceRange* range = static_cast<SliceRange*>(head.get());
+          if (range->step() == 1) {
+            return getitem_range(range->start(), range->stop());
+          }
+          break;
+        }
+        case SliceKind::field:
+          return getitem_field(static_cast<SliceField*>(head.get())->key());
+        case SliceKind::array64: {
+          SliceArray64* array = static_cast<SliceArray64*>(head.get());
+          if (array->ndim() == 1) {
+            Index64 flathead = array->ravel();
+            Index64 nextcarry(flathead.length());
+            struct Error err =
+              awkward_regulararray_getitem_next_array_regularize_64(
+              nextcarry.ptr().get(),
+              flathead.ptr().get(),
+              flathead.length(),
+              length());
+            util::handle_error(err, classname(), identities_.get());
+            return carry(nextcarry);
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+
     ContentPtr next = std::make_shared<RegularArray>(Identities::none(),
                                                      util::Parameters(),
                                                      shallow_copy(),
@@ -918,44 +1381,45 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (SliceAt* at =
-             dynamic_cast<SliceAt*>(head.get())) {
-      return getitem_next(*at, tail, advanced);
-    }
-    else if (SliceRange* range =
-             dynamic_cast<SliceRange*>(head.get())) {
-      return getitem_next(*range, tail, advanced);
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return getitem_next(*ellipsis, tail, advanced);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return getitem_next(*newaxis, tail, advanced);
-    }
-    else if (SliceArray64* array =
-             dynamic_cast<SliceArray64*>(head.get())) {
-      return getitem_next(*array, tail, advanced);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      return getitem_next(*field, tail, advanced);
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      return getitem_next(*fields, tail, advanced);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return getitem_next(*missing, tail, advanced);
-    }
-    else if (SliceJagged64* jagged =
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      return getitem_next(*jagged, tail, advanced);
-    }
-    else {
-      throw std::runtime_error("unrecognized slice type");
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+        return getitem_next(*static_cast<SliceAt*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::range:
+        return getitem_next(*static_cast<SliceRange*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::ellipsis:
+        return getitem_next(*static_cast<SliceEllipsis*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::newaxis:
+        return getitem_next(*static_cast<SliceNewAxis*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::array64:
+        return getitem_next(*static_cast<SliceArray64*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::field:
+        return getitem_next(*static_cast<SliceField*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::fields:
+        return getitem_next(*static_cast<SliceFields*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::missing64:
+        return getitem_next(*static_cast<SliceMissing64*>(head.get()),
+                            tail,
+                            advanced);
+      case SliceKind::jagged64:
+        return getitem_next(*static_cast<SliceJagged64*>(head.get()),
+                            tail,
+                            advanced);
+      default:
+        throw std::runtime_error("unrecognized slice type");
     }
   }
 
@@ -964,21 +1428,28 @@ namespace awkward {
                                const Index64& slicestops,
                                const SliceItemPtr& slicecontent,
                                const Slice& tail) const {
-    if (SliceArray64* array =
-        dynamic_cast<SliceArray64*>(slicecontent.get())) {
-      return getitem_next_jagged(slicestarts, slicestops, *array, tail);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(slicecontent.get())) {
-      return getitem_next_jagged(slicestarts, slicestops, *missing, tail);
-    }
-    else if (SliceJagged64* jagged =
-             dynamic_cast<SliceJagged64*>(slicecontent.get())) {
-      return getitem_next_jagged(slicestarts, slicestops, *jagged, tail);
-    }
-    else {
-      throw std::runtime_error(
-        "unexpected slice type for getitem_next_jagged");
+    switch (slicecontent.get()->kind()) {
+      case SliceKind::array64:
+        return getitem_next_jagged(
+          slicestarts,
+          slicestops,
+          *static_cast<SliceArray64*>(slicecontent.get()),
+          tail);
+      case SliceKind::missing64:
+        return getitem_next_jagged(
+          slicestarts,
+          slicestops,
+          *static_cast<SliceMissing64*>(slicecontent.get()),
+          tail);
+      case SliceKind::jagged64:
+        return getitem_next_jagged(
+          slicestarts,
+          slicestops,
+          *static_cast<SliceJagged64*>(slicecontent.get()),
+          tail);
+      default:
+        throw std::runtime_error(
+          "unexpected slice type for getitem_next_jagged");
     }
   }
 
@@ -1113,7 +1584,7 @@ namespace awkward {
     // general scenarios.
 
     if (that.get()->length() == 1  &&
-        dynamic_cast<SliceJagged64*>(missing.content().get())) {
+        missing.content().get()->kind() == SliceKind::jagged64) {
       ContentPtr tmp1 = that.get()->getitem_at_nowrap(0);
       ContentPtr tmp2(nullptr);
       if (IndexedOptionArray32* rawtmp1 =
@@ -1237,6 +1708,52 @@ namespace awkward {
     return out;
   }
 
+  const ContentPtr
+  Content::reduce_next_option_wrap(const ContentPtr& out,
+                                   const Index64& outindex,
+                                   const Index64& starts,
+                                   int64_t negaxis) const {
+    std::pair<bool, int64_t> branchdepth = branch_depth();
+    if (!branchdepth.first  &&  negaxis == branchdepth.second) {
+      return out;
+    }
+
+    ContentPtr lists = out;
+    if (lists.get()->kind() == ContentKind::RegularArray) {
+      lists = static_cast<RegularArray*>(lists.get())->toListOffsetArray64(true);
+    }
+    if (lists.get()->kind() != ContentKind::ListOffsetArray64) {
+      throw std::runtime_error(
+        std::string("reduce_next with unbranching depth > negaxis is only "
+                    "expected to return RegularArray or ListOffsetArray64; "
+                    "instead, it returned ") + out.get()->classname());
+    }
+    ListOffsetArray64* raw = static_cast<ListOffsetArray64*>(lists.get());
+
+    Index64 outoffsets(starts.length() + 1);
+    if (starts.length() > 0  &&  starts.getitem_at_nowrap(0) != 0) {
+      throw std::runtime_error(
+        "reduce_next with unbranching depth > negaxis expects a "
+        "ListOffsetArray64 whose offsets start at zero");
+    }
+    struct Error err = awkward_indexedarray_reduce_next_fix_offsets_64(
+      outoffsets.ptr().get(),
+      starts.ptr().get(),
+      starts.offset(),
+      starts.length(),
+      outindex.length());
+    util::handle_error(err, classname(), identities_.get());
+
+    return std::make_shared<ListOffsetArray64>(
+      raw->identities(),
+      raw->parameters(),
+      outoffsets,
+      std::make_shared<IndexedOptionArray64>(Identities::none(),
+                                             util::Parameters(),
+                                             outindex,
+                                             raw->content()));
+  }
+
   const std::string
   Content::parameters_tostring(const std::string& indent,
                                const std::string& pre,
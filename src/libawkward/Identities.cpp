@@ -70,9 +70,8 @@ namespace awkward {
                                 int64_t width,
                                 int64_t length)
       : Identities(ref, fieldloc, 0, width, length)
-      , ptr_(std::shared_ptr<T>(
-          length*width == 0 ? nullptr : new T[(size_t)(length*width)],
-          util::array_deleter<T>())) { }
+      , ptr_(length*width == 0 ? std::shared_ptr<T>(nullptr)
+                               : util::allocate<T>(length*width)) { }
 
   template <typename T>
   IdentitiesOf<T>::IdentitiesOf(const Ref ref,
@@ -215,8 +214,8 @@ namespace awkward {
   template <typename T>
   const IdentitiesPtr
   IdentitiesOf<T>::deep_copy() const {
-    std::shared_ptr<T> ptr(length_ == 0 ? nullptr : new T[(size_t)length_],
-                           util::array_deleter<T>());
+    std::shared_ptr<T> ptr = length_ == 0 ? std::shared_ptr<T>(nullptr)
+                                          : util::allocate<T>(length_);
     if (length_ != 0) {
       memcpy(ptr.get(),
              &ptr_.get()[(size_t)offset_],
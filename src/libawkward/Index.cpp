@@ -56,8 +56,8 @@ namespace awkward {
 
   template <typename T>
   IndexOf<T>::IndexOf(int64_t length)
-      : ptr_(std::shared_ptr<T>(length == 0 ? nullptr : new T[(size_t)length],
-                                util::array_deleter<T>()))
+      : ptr_(length == 0 ? std::shared_ptr<T>(nullptr)
+                         : util::allocate<T>(length))
       , offset_(0)
       , length_(length) { }
 
@@ -223,6 +223,21 @@ namespace awkward {
     return IndexOf<T>(ptr_, offset_ + start*(start != stop), stop - start);
   }
 
+  template <typename T>
+  IndexOf<T>
+  IndexOf<T>::getitem_carry_64(const IndexOf<int64_t>& carry) const {
+    IndexOf<T> out(carry.length());
+    struct Error err = util::awkward_index_carry_64<T>(
+      out.ptr().get(),
+      ptr_.get(),
+      carry.ptr().get() + carry.offset(),
+      offset_,
+      length_,
+      carry.length());
+    util::handle_error(err, classname(), nullptr);
+    return out;
+  }
+
   template <typename T>
   void
   IndexOf<T>::nbytes_part(std::map<size_t, int64_t>& largest) const {
@@ -241,9 +256,9 @@ namespace awkward {
 
   template <>
   IndexOf<int64_t> IndexOf<int8_t>::to64() const {
-    std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr =
+      length_ == 0 ? std::shared_ptr<int64_t>(nullptr)
+                   : util::allocate<int64_t>(length_);
     if (length_ != 0) {
       awkward_index8_to_index64(ptr.get(), &ptr_.get()[(size_t)offset_],
                                 length_);
@@ -253,9 +268,9 @@ namespace awkward {
 
   template <>
   IndexOf<int64_t> IndexOf<uint8_t>::to64() const {
-    std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr =
+      length_ == 0 ? std::shared_ptr<int64_t>(nullptr)
+                   : util::allocate<int64_t>(length_);
     if (length_ != 0) {
       awkward_indexU8_to_index64(ptr.get(), &ptr_.get()[(size_t)offset_],
                                  length_);
@@ -265,9 +280,9 @@ namespace awkward {
 
   template <>
   IndexOf<int64_t> IndexOf<int32_t>::to64() const {
-    std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr =
+      length_ == 0 ? std::shared_ptr<int64_t>(nullptr)
+                   : util::allocate<int64_t>(length_);
     if (length_ != 0) {
       awkward_index32_to_index64(ptr.get(),
                                  &ptr_.get()[(size_t)offset_],
@@ -278,9 +293,9 @@ namespace awkward {
 
   template <>
   IndexOf<int64_t> IndexOf<uint32_t>::to64() const {
-    std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr =
+      length_ == 0 ? std::shared_ptr<int64_t>(nullptr)
+                   : util::allocate<int64_t>(length_);
     if (length_ != 0) {
       awkward_indexU32_to_index64(ptr.get(),
                                   &ptr_.get()[(size_t)offset_],
@@ -297,9 +312,9 @@ namespace awkward {
   template <typename T>
   const IndexOf<T>
   IndexOf<T>::deep_copy() const {
-    std::shared_ptr<T> ptr(
-      length_ == 0 ? nullptr : new T[(size_t)length_],
-      util::array_deleter<T>());
+    std::shared_ptr<T> ptr =
+      length_ == 0 ? std::shared_ptr<T>(nullptr)
+                   : util::allocate<T>(length_);
     if (length_ != 0) {
       memcpy(ptr.get(),
              &ptr_.get()[(size_t)offset_],
@@ -30,6 +30,11 @@ namespace awkward {
     return std::make_shared<SliceAt>(at_);
   }
 
+  SliceKind
+  SliceAt::kind() const {
+    return SliceKind::at;
+  }
+
   const std::string
   SliceAt::tostring() const {
     return std::to_string(at_);
@@ -81,6 +86,11 @@ namespace awkward {
     return std::make_shared<SliceRange>(start_, stop_, step_);
   }
 
+  SliceKind
+  SliceRange::kind() const {
+    return SliceKind::range;
+  }
+
   const std::string
   SliceRange::tostring() const {
     std::stringstream out;
@@ -111,6 +121,11 @@ namespace awkward {
     return std::make_shared<SliceEllipsis>();
   }
 
+  SliceKind
+  SliceEllipsis::kind() const {
+    return SliceKind::ellipsis;
+  }
+
   const std::string
   SliceEllipsis::tostring() const {
     return std::string("...");
@@ -130,6 +145,11 @@ namespace awkward {
     return std::make_shared<SliceNewAxis>();
   }
 
+  SliceKind
+  SliceNewAxis::kind() const {
+    return SliceKind::newaxis;
+  }
+
   const std::string
   SliceNewAxis::tostring() const {
     return std::string("newaxis");
@@ -205,6 +225,12 @@ namespace awkward {
                                              frombool_);
   }
 
+  template <typename T>
+  SliceKind
+  SliceArrayOf<T>::kind() const {
+    return SliceKind::array64;
+  }
+
   template <typename T>
   const std::string
   SliceArrayOf<T>::tostring() const {
@@ -330,6 +356,11 @@ namespace awkward {
     return std::make_shared<SliceField>(key_);
   }
 
+  SliceKind
+  SliceField::kind() const {
+    return SliceKind::field;
+  }
+
   const std::string
   SliceField::tostring() const {
     return util::quote(key_, true);
@@ -355,6 +386,11 @@ namespace awkward {
     return std::make_shared<SliceFields>(keys_);
   }
 
+  SliceKind
+  SliceFields::kind() const {
+    return SliceKind::fields;
+  }
+
   const std::string
   SliceFields::tostring() const {
     std::stringstream out;
@@ -416,6 +452,12 @@ namespace awkward {
                                                content_);
   }
 
+  template <typename T>
+  SliceKind
+  SliceMissingOf<T>::kind() const {
+    return SliceKind::missing64;
+  }
+
   template <typename T>
   const std::string
   SliceMissingOf<T>::tostring() const {
@@ -495,6 +537,12 @@ namespace awkward {
     return std::make_shared<SliceJaggedOf<T>>(offsets_, content_);
   }
 
+  template <typename T>
+  SliceKind
+  SliceJaggedOf<T>::kind() const {
+    return SliceKind::jagged64;
+  }
+
   template <typename T>
   const std::string
   SliceJaggedOf<T>::tostring() const {
@@ -549,20 +597,31 @@ namespace awkward {
   }
 
   Slice::Slice()
-      : items_(std::vector<SliceItemPtr>())
+      : items_(std::make_shared<std::vector<SliceItemPtr>>())
+      , start_(0)
       , sealed_(false) { }
 
   Slice::Slice(const std::vector<SliceItemPtr>& items)
-      : items_(items)
+      : items_(std::make_shared<std::vector<SliceItemPtr>>(items))
+      , start_(0)
       , sealed_(false) { }
 
   Slice::Slice(const std::vector<SliceItemPtr>& items, bool sealed)
+      : items_(std::make_shared<std::vector<SliceItemPtr>>(items))
+      , start_(0)
+      , sealed_(sealed) { }
+
+  Slice::Slice(const std::shared_ptr<std::vector<SliceItemPtr>>& items,
+               size_t start,
+               bool sealed)
       : items_(items)
+      , start_(start)
       , sealed_(sealed) { }
 
   const std::vector<SliceItemPtr>
   Slice::items() const {
-    return items_;
+    return std::vector<SliceItemPtr>(items_.get()->begin() + start_,
+                                     items_.get()->end());
   }
 
   bool
@@ -572,21 +631,21 @@ namespace awkward {
 
   int64_t
   Slice::length() const {
-    return (int64_t)items_.size();
+    return (int64_t)(items_.get()->size() - start_);
   }
 
   int64_t
   Slice::dimlength() const {
     int64_t out = 0;
-    for (auto x : items_) {
-      if (dynamic_cast<SliceAt*>(x.get()) != nullptr) {
-        out += 1;
-      }
-      else if (dynamic_cast<SliceRange*>(x.get()) != nullptr) {
-        out += 1;
-      }
-      else if (dynamic_cast<SliceArray64*>(x.get()) != nullptr) {
-        out += 1;
+    for (size_t i = start_;  i < items_.get()->size();  i++) {
+      switch (items_.get()->at(i).get()->kind()) {
+        case SliceKind::at:
+        case SliceKind::range:
+        case SliceKind::array64:
+          out += 1;
+          break;
+        default:
+          break;
       }
     }
     return out;
@@ -594,8 +653,8 @@ namespace awkward {
 
   const SliceItemPtr
   Slice::head() const {
-    if (!items_.empty()) {
-      return items_[0];
+    if (start_ < items_.get()->size()) {
+      return items_.get()->at(start_);
     }
     else {
       return SliceItemPtr(nullptr);
@@ -604,22 +663,23 @@ namespace awkward {
 
   const Slice
   Slice::tail() const {
-    std::vector<SliceItemPtr> items;
-    if (!items_.empty()) {
-      items.insert(items.end(), items_.begin() + 1, items_.end());
+    if (start_ < items_.get()->size()) {
+      return Slice(items_, start_ + 1, true);
+    }
+    else {
+      return Slice(items_, start_, true);
     }
-    return Slice(items, true);
   }
 
   const std::string
   Slice::tostring() const {
     std::stringstream out;
     out << "[";
-    for (size_t i = 0;  i < items_.size();  i++) {
-      if (i != 0) {
+    for (size_t i = start_;  i < items_.get()->size();  i++) {
+      if (i != start_) {
         out << ", ";
       }
-      out << items_[i].get()->tostring();
+      out << items_.get()->at(i).get()->tostring();
     }
     out << "]";
     return out.str();
@@ -627,7 +687,7 @@ namespace awkward {
 
   const Slice
   Slice::prepended(const SliceItemPtr& item) const {
-    std::vector<SliceItemPtr> items(items_);
+    std::vector<SliceItemPtr> items = this->items();
     items.insert(items.begin(), item);
     return Slice(items, true);
   }
@@ -637,52 +697,62 @@ namespace awkward {
     if (sealed_) {
       throw std::runtime_error("Slice::append when sealed_ == true");
     }
-    items_.push_back(item);
+    own_items();
+    items_.get()->push_back(item);
   }
 
   void
   Slice::append(const SliceAt& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceRange& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceEllipsis& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceNewAxis& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceArray64& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceField& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceFields& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceMissing64& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
   Slice::append(const SliceJagged64& item) {
-    items_.push_back(item.shallow_copy());
+    own_items();
+    items_.get()->push_back(item.shallow_copy());
   }
 
   void
@@ -690,10 +760,13 @@ namespace awkward {
     if (sealed_) {
       throw std::runtime_error("Slice::become_sealed when sealed_ == true");
     }
+    own_items();
+    std::vector<SliceItemPtr>& items = *items_.get();
 
     std::vector<int64_t> shape;
-    for (size_t i = 0;  i < items_.size();  i++) {
-      if (SliceArray64* array = dynamic_cast<SliceArray64*>(items_[i].get())) {
+    for (size_t i = 0;  i < items.size();  i++) {
+      if (items[i].get()->kind() == SliceKind::array64) {
+        SliceArray64* array = static_cast<SliceArray64*>(items[i].get());
         if (shape.empty()) {
           shape = array->shape();
         }
@@ -715,21 +788,22 @@ namespace awkward {
     }
 
     if (!shape.empty()) {
-      for (size_t i = 0;  i < items_.size();  i++) {
-        if (SliceAt* at = dynamic_cast<SliceAt*>(items_[i].get())) {
+      for (size_t i = 0;  i < items.size();  i++) {
+        if (items[i].get()->kind() == SliceKind::at) {
+          SliceAt* at = static_cast<SliceAt*>(items[i].get());
           Index64 index(1);
           index.setitem_at_nowrap(0, at->at());
           std::vector<int64_t> strides;
           for (size_t j = 0;  j < shape.size();  j++) {
             strides.push_back(0);
           }
-          items_[i] = std::make_shared<SliceArray64>(index,
-                                                     shape,
-                                                     strides,
-                                                     false);
+          items[i] = std::make_shared<SliceArray64>(index,
+                                                    shape,
+                                                    strides,
+                                                    false);
         }
-        else if (SliceArray64* array =
-                 dynamic_cast<SliceArray64*>(items_[i].get())) {
+        else if (items[i].get()->kind() == SliceKind::array64) {
+          SliceArray64* array = static_cast<SliceArray64*>(items[i].get());
           std::vector<int64_t> arrayshape = array->shape();
           std::vector<int64_t> arraystrides = array->strides();
           std::vector<int64_t> strides;
@@ -744,41 +818,43 @@ namespace awkward {
               throw std::invalid_argument("cannot broadcast arrays in slice");
             }
           }
-          items_[i] = std::make_shared<SliceArray64>(array->index(),
-                                                     shape,
-                                                     strides,
-                                                     array->frombool());
+          items[i] = std::make_shared<SliceArray64>(array->index(),
+                                                    shape,
+                                                    strides,
+                                                    array->frombool());
         }
       }
 
       std::string types;
-      for (size_t i = 0;  i < items_.size();  i++) {
-        if (dynamic_cast<SliceAt*>(items_[i].get()) != nullptr) {
-          types.push_back('@');
-        }
-        else if (dynamic_cast<SliceRange*>(items_[i].get()) != nullptr) {
-          types.push_back(':');
-        }
-        else if (dynamic_cast<SliceEllipsis*>(items_[i].get()) != nullptr) {
-          types.push_back('.');
-        }
-        else if (dynamic_cast<SliceNewAxis*>(items_[i].get()) != nullptr) {
-          types.push_back('1');
-        }
-        else if (dynamic_cast<SliceArray64*>(items_[i].get()) != nullptr) {
-          types.push_back('A');
-        }
-        else if (dynamic_cast<SliceField*>(items_[i].get()) != nullptr) {
-          types.push_back('"');
-        }
-        else if (dynamic_cast<SliceFields*>(items_[i].get()) != nullptr) {
-          types.push_back('[');
-        }
-        else if (dynamic_cast<SliceMissing64*>(items_[i].get()) != nullptr) {
-          types.push_back('?');
-        }
-        else if (dynamic_cast<SliceJagged64*>(items_[i].get()) != nullptr) {
-          types.push_back('J');
+      for (size_t i = 0;  i < items.size();  i++) {
+        switch (items[i].get()->kind()) {
+          case SliceKind::at:
+            types.push_back('@');
+            break;
+          case SliceKind::range:
+            types.push_back(':');
+            break;
+          case SliceKind::ellipsis:
+            types.push_back('.');
+            break;
+          case SliceKind::newaxis:
+            types.push_back('1');
+            break;
+          case SliceKind::array64:
+            types.push_back('A');
+            break;
+          case SliceKind::field:
+            types.push_back('"');
+            break;
+          case SliceKind::fields:
+            types.push_back('[');
+            break;
+          case SliceKind::missing64:
+            types.push_back('?');
+            break;
+          case SliceKind::jagged64:
+            types.push_back('J');
+            break;
         }
       }
 
@@ -807,11 +883,19 @@ namespace awkward {
     if (!sealed_) {
       throw std::runtime_error("Slice::isadvanced when sealed_ == false");
     }
-    for (size_t i = 0;  i < items_.size();  i++) {
-      if (dynamic_cast<SliceArray64*>(items_[i].get()) != nullptr) {
+    for (size_t i = start_;  i < items_.get()->size();  i++) {
+      if (items_.get()->at(i).get()->kind() == SliceKind::array64) {
         return true;
       }
     }
     return false;
   }
+
+  void
+  Slice::own_items() {
+    if (start_ != 0  ||  !items_.unique()) {
+      items_ = std::make_shared<std::vector<SliceItemPtr>>(items());
+      start_ = 0;
+    }
+  }
 }
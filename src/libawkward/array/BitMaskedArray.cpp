@@ -6,6 +6,7 @@
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/reducers.h"
 #include "awkward/type/OptionType.h"
 #include "awkward/type/ArrayType.h"
 #include "awkward/type/UnknownType.h"
@@ -15,6 +16,8 @@
 #include "awkward/array/UnionArray.h"
 #include "awkward/array/NumpyArray.h"
 #include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/RegularArray.h"
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
 #include "awkward/array/VirtualArray.h"
@@ -56,6 +59,11 @@ namespace awkward {
     return lsb_order_;
   }
 
+  FormKind
+  BitMaskedForm::kind() const {
+    return FormKind::BitMaskedForm;
+  }
+
   const TypePtr
   BitMaskedForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
@@ -148,6 +156,28 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  BitMaskedForm::getitem_field(const std::string& key) const {
+    return std::make_shared<BitMaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      mask_,
+      content_.get()->getitem_field(key),
+      valid_when_,
+      lsb_order_);
+  }
+
+  const FormPtr
+  BitMaskedForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<BitMaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      mask_,
+      content_.get()->getitem_fields(keys),
+      valid_when_,
+      lsb_order_);
+  }
+
   bool
   BitMaskedForm::equal(const FormPtr& other,
                        bool check_identities,
@@ -161,7 +191,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (BitMaskedForm* t = dynamic_cast<BitMaskedForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::BitMaskedForm) {
+      BitMaskedForm* t = static_cast<BitMaskedForm*>(other.get());
       return (mask_ == t->mask()  &&
               content_.get()->equal(t->content(),
                                     check_identities,
@@ -223,7 +254,27 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::project() const {
-    return toByteMaskedArray().get()->project();
+    int64_t numnull;
+    struct Error err1 = awkward_bitmaskedarray_numnull(
+      &numnull,
+      mask_.ptr().get(),
+      mask_.offset(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err1, classname(), identities_.get());
+
+    Index64 nextcarry(length_ - numnull);
+    struct Error err2 = awkward_bitmaskedarray_getitem_nextcarry_64(
+      nextcarry.ptr().get(),
+      mask_.ptr().get(),
+      mask_.offset(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err2, classname(), identities_.get());
+
+    return content_.get()->carry(nextcarry);
   }
 
   const ContentPtr
@@ -247,14 +298,14 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::simplify_optiontype() const {
-    if (dynamic_cast<IndexedArray32*>(content_.get())        ||
-        dynamic_cast<IndexedArrayU32*>(content_.get())       ||
-        dynamic_cast<IndexedArray64*>(content_.get())        ||
-        dynamic_cast<IndexedOptionArray32*>(content_.get())  ||
-        dynamic_cast<IndexedOptionArray64*>(content_.get())  ||
-        dynamic_cast<ByteMaskedArray*>(content_.get())       ||
-        dynamic_cast<BitMaskedArray*>(content_.get())        ||
-        dynamic_cast<UnmaskedArray*>(content_.get())) {
+    if (content_.get()->kind() == ContentKind::IndexedArray32        ||
+        content_.get()->kind() == ContentKind::IndexedArrayU32       ||
+        content_.get()->kind() == ContentKind::IndexedArray64        ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray32  ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray64  ||
+        content_.get()->kind() == ContentKind::ByteMaskedArray       ||
+        content_.get()->kind() == ContentKind::BitMaskedArray        ||
+        content_.get()->kind() == ContentKind::UnmaskedArray) {
       ContentPtr step1 = toIndexedOptionArray64();
       IndexedOptionArray64* step2 =
         dynamic_cast<IndexedOptionArray64*>(step1.get());
@@ -307,6 +358,11 @@ namespace awkward {
     return "BitMaskedArray";
   }
 
+  ContentKind
+  BitMaskedArray::kind() const {
+    return ContentKind::BitMaskedArray;
+  }
+
   void
   BitMaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
@@ -450,14 +506,42 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  void
+  BitMaskedArray::tojson_elements(ToJson& builder,
+                                  int64_t start,
+                                  int64_t stop) const {
+    const uint8_t* mask = mask_.ptr().get() + mask_.offset();
+    int64_t i = start;
+    while (i < stop) {
+      int64_t run = 0;
+      while (i + run < stop) {
+        int64_t at = i + run;
+        uint8_t byte = mask[at / 8];
+        uint8_t shift = (uint8_t)(at % 8);
+        bool asbool = (lsb_order_ ? ((byte >> shift) & ((uint8_t)1))
+                                  : ((byte << shift) & ((uint8_t)128))) != 0;
+        if (asbool != valid_when_) {
+          break;
+        }
+        run++;
+      }
+      if (run == 0) {
+        builder.null();
+        i++;
+      }
+      else {
+        content_.get()->tojson_elements(builder, i, i + run);
+        i += run;
+      }
+    }
+  }
+
   void
   BitMaskedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
     mask_.nbytes_part(largest);
@@ -504,6 +588,21 @@ namespace awkward {
                                             lsb_order_);
   }
 
+  const ContentPtr
+  BitMaskedArray::pack() const {
+    IndexU8 mask =
+      mask_.getitem_range_nowrap(0, (length_ + 7) / 8).deep_copy();
+    ContentPtr content =
+      content_.get()->getitem_range_nowrap(0, length_).get()->pack();
+    return std::make_shared<BitMaskedArray>(identities_,
+                                            parameters_,
+                                            mask,
+                                            content,
+                                            valid_when_,
+                                            length_,
+                                            lsb_order_);
+  }
+
   void
   BitMaskedArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -569,29 +668,36 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
     int64_t bitstart = start / 8;
-    int64_t remainder = start % 8;
-    if (remainder == 0) {
-      IdentitiesPtr identities(nullptr);
-      if (identities_.get() != nullptr) {
-        identities = identities_.get()->getitem_range_nowrap(start, stop);
-      }
-      int64_t length = stop - start;
-      int64_t bitlength = length / 8;
-      int64_t remainder = length % 8;
-      int64_t bitstop = bitstart + (bitlength + (remainder != 0));
-      return std::make_shared<BitMaskedArray>(
-        identities,
-        parameters_,
-        mask_.getitem_range_nowrap(bitstart, bitstop),
-        content_.get()->getitem_range_nowrap(start, stop),
-        valid_when_,
+    int64_t length = stop - start;
+    int64_t bitlength = (length + 7) / 8;
+    IndexU8 nextmask = (start % 8 == 0
+      ? mask_.getitem_range_nowrap(bitstart, bitstart + bitlength)
+      : IndexU8(bitlength));
+    if (start % 8 != 0) {
+      // Unaligned starts shift the bits into a new mask, rather than
+      // falling back to a ByteMaskedArray.
+      struct Error err = awkward_bitmaskedarray_getitem_range(
+        nextmask.ptr().get(),
+        mask_.ptr().get(),
+        mask_.offset(),
+        start,
         length,
         lsb_order_);
+      util::handle_error(err, classname(), identities_.get());
     }
-    else {
-      return toByteMaskedArray().get()->getitem_range_nowrap(start, stop);
-    }
+    return std::make_shared<BitMaskedArray>(
+      identities,
+      parameters_,
+      nextmask,
+      content_.get()->getitem_range_nowrap(start, stop),
+      valid_when_,
+      length,
+      lsb_order_);
   }
 
   const ContentPtr
@@ -622,12 +728,55 @@ namespace awkward {
   BitMaskedArray::getitem_next(const SliceItemPtr& head,
                                const Slice& tail,
                                const Index64& advanced) const {
-    return toByteMaskedArray().get()->getitem_next(head, tail, advanced);
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+      case SliceKind::range:
+      case SliceKind::array64:
+      case SliceKind::jagged64: {
+        int64_t numnull;
+        std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+        Index64 nextcarry = pair.first;
+        Index64 outindex = pair.second;
+
+        ContentPtr next = content_.get()->carry(nextcarry);
+
+        ContentPtr out = next.get()->getitem_next(head, tail, advanced);
+        IndexedOptionArray64 out2(identities_, parameters_, outindex, out);
+        return out2.simplify_optiontype();
+      }
+      default:
+        // Ellipsis, newaxis, fields, and missing are independent of the
+        // option/union structure and are handled generically.
+        return Content::getitem_next(head, tail, advanced);
+    }
   }
 
   const ContentPtr
   BitMaskedArray::carry(const Index64& carry) const {
-    return toByteMaskedArray().get()->carry(carry);
+    IndexU8 nextmask((carry.length() + 7) / 8);
+    struct Error err = awkward_bitmaskedarray_getitem_carry_64(
+      nextmask.ptr().get(),
+      mask_.ptr().get(),
+      mask_.offset(),
+      length_,
+      carry.ptr().get(),
+      carry.length(),
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    return std::make_shared<BitMaskedArray>(identities,
+                                            parameters_,
+                                            nextmask,
+                                            content_.get()->carry(carry),
+                                            valid_when_,
+                                            carry.length(),
+                                            lsb_order_);
   }
 
   int64_t
@@ -667,7 +816,27 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::num(int64_t axis, int64_t depth) const {
-    return toByteMaskedArray().get()->num(axis, depth);
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      Index64 out(1);
+      out.setitem_at_nowrap(0, length());
+      return NumpyArray(out).getitem_at_nowrap(0);
+    }
+    else {
+      int64_t numnull;
+      std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+      Index64 nextcarry = pair.first;
+      Index64 outindex = pair.second;
+
+      ContentPtr next = content_.get()->carry(nextcarry);
+
+      ContentPtr out = next.get()->num(axis, depth);
+      IndexedOptionArray64 out2(Identities::none(),
+                                util::Parameters(),
+                                outindex,
+                                out);
+      return out2.simplify_optiontype();
+    }
   }
 
   const std::pair<Index64, ContentPtr>
@@ -677,7 +846,8 @@ namespace awkward {
 
   bool
   BitMaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -685,43 +855,48 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      default:
+        break;
     }
 
-    if (IndexedArray32* rawother =
-        dynamic_cast<IndexedArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::IndexedArray32) {
+      IndexedArray32* rawother = static_cast<IndexedArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArrayU32) {
+      IndexedArrayU32* rawother = static_cast<IndexedArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArray64) {
+      IndexedArray64* rawother = static_cast<IndexedArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray32) {
+      IndexedOptionArray32* rawother =
+        static_cast<IndexedOptionArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray64) {
+      IndexedOptionArray64* rawother =
+        static_cast<IndexedOptionArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ByteMaskedArray) {
+      ByteMaskedArray* rawother = static_cast<ByteMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::BitMaskedArray) {
+      BitMaskedArray* rawother = static_cast<BitMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnmaskedArray) {
+      UnmaskedArray* rawother = static_cast<UnmaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -772,18 +947,64 @@ namespace awkward {
                               int64_t outlength,
                               bool mask,
                               bool keepdims) const {
-    return toByteMaskedArray().get()->reduce_next(reducer,
-                                                  negaxis,
-                                                  starts,
-                                                  parents,
-                                                  outlength,
-                                                  mask,
-                                                  keepdims);
+    int64_t numnull;
+    struct Error err1 = awkward_bitmaskedarray_numnull(
+      &numnull,
+      mask_.ptr().get(),
+      mask_.offset(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err1, classname(), identities_.get());
+
+    Index64 nextparents(length_ - numnull);
+    Index64 nextcarry(length_ - numnull);
+    Index64 outindex(length_);
+    struct Error err2 = awkward_bitmaskedarray_reduce_next_64(
+      nextcarry.ptr().get(),
+      nextparents.ptr().get(),
+      outindex.ptr().get(),
+      mask_.ptr().get(),
+      mask_.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err2, classname(), identities_.get());
+
+    ContentPtr next = content_.get()->carry(nextcarry);
+    ContentPtr out = next.get()->reduce_next(reducer,
+                                             negaxis,
+                                             starts,
+                                             nextparents,
+                                             outlength,
+                                             mask,
+                                             keepdims);
+
+    return reduce_next_option_wrap(out, outindex, starts, negaxis);
   }
 
   const ContentPtr
   BitMaskedArray::localindex(int64_t axis, int64_t depth) const {
-    return toByteMaskedArray().get()->localindex(axis, depth);
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      return localindex_axis0();
+    }
+    else {
+      int64_t numnull;
+      std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+      Index64 nextcarry = pair.first;
+      Index64 outindex = pair.second;
+
+      ContentPtr next = content_.get()->carry(nextcarry);
+      ContentPtr out = next.get()->localindex(axis, depth);
+      IndexedOptionArray64 out2(Identities::none(),
+                                util::Parameters(),
+                                outindex,
+                                out);
+      return out2.simplify_optiontype();
+    }
   }
 
   const ContentPtr
@@ -838,10 +1059,10 @@ namespace awkward {
                                       const Index64& slicestops,
                                       const SliceArray64& slicecontent,
                                       const Slice& tail) const {
-    return toByteMaskedArray().get()->getitem_next_jagged(slicestarts,
-                                                          slicestops,
-                                                          slicecontent,
-                                                          tail);
+    return getitem_next_jagged_generic<SliceArray64>(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
   }
 
   const ContentPtr
@@ -849,10 +1070,10 @@ namespace awkward {
                                       const Index64& slicestops,
                                       const SliceMissing64& slicecontent,
                                       const Slice& tail) const {
-    return toByteMaskedArray().get()->getitem_next_jagged(slicestarts,
-                                                          slicestops,
-                                                          slicecontent,
-                                                          tail);
+    return getitem_next_jagged_generic<SliceMissing64>(slicestarts,
+                                                       slicestops,
+                                                       slicecontent,
+                                                       tail);
   }
 
   const ContentPtr
@@ -860,10 +1081,57 @@ namespace awkward {
                                       const Index64& slicestops,
                                       const SliceJagged64& slicecontent,
                                       const Slice& tail) const {
-    return toByteMaskedArray().get()->getitem_next_jagged(slicestarts,
-                                                          slicestops,
-                                                          slicecontent,
-                                                          tail);
+    return getitem_next_jagged_generic<SliceJagged64>(slicestarts,
+                                                      slicestops,
+                                                      slicecontent,
+                                                      tail);
+  }
+
+  template <typename S>
+  const ContentPtr
+  BitMaskedArray::getitem_next_jagged_generic(const Index64& slicestarts,
+                                              const Index64& slicestops,
+                                              const S& slicecontent,
+                                              const Slice& tail) const {
+    int64_t numnull;
+    std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+    Index64 nextcarry = pair.first;
+    Index64 outindex = pair.second;
+
+    ContentPtr next = content_.get()->carry(nextcarry);
+    ContentPtr out = next.get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+    IndexedOptionArray64 out2(identities_, parameters_, outindex, out);
+    return out2.simplify_optiontype();
+  }
+
+  const std::pair<Index64, Index64>
+  BitMaskedArray::nextcarry_outindex(int64_t& numnull) const {
+    struct Error err1 = awkward_bitmaskedarray_numnull(
+      &numnull,
+      mask_.ptr().get(),
+      mask_.offset(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err1, classname(), identities_.get());
+
+    Index64 nextcarry(length_ - numnull);
+    Index64 outindex(length_);
+    struct Error err2 =
+      awkward_bitmaskedarray_getitem_nextcarry_outindex_64(
+        nextcarry.ptr().get(),
+        outindex.ptr().get(),
+        mask_.ptr().get(),
+        mask_.offset(),
+        length_,
+        valid_when_,
+        lsb_order_);
+    util::handle_error(err2, classname(), identities_.get());
+
+    return std::pair<Index64, Index64>(nextcarry, outindex);
   }
 
 }
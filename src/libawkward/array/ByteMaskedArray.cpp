@@ -53,6 +53,11 @@ namespace awkward {
     return valid_when_;
   }
 
+  FormKind
+  ByteMaskedForm::kind() const {
+    return FormKind::ByteMaskedForm;
+  }
+
   const TypePtr
   ByteMaskedForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
@@ -142,6 +147,26 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  ByteMaskedForm::getitem_field(const std::string& key) const {
+    return std::make_shared<ByteMaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      mask_,
+      content_.get()->getitem_field(key),
+      valid_when_);
+  }
+
+  const FormPtr
+  ByteMaskedForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<ByteMaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      mask_,
+      content_.get()->getitem_fields(keys),
+      valid_when_);
+  }
+
   bool
   ByteMaskedForm::equal(const FormPtr& other,
                         bool check_identities,
@@ -155,7 +180,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (ByteMaskedForm* t = dynamic_cast<ByteMaskedForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::ByteMaskedForm) {
+      ByteMaskedForm* t = static_cast<ByteMaskedForm*>(other.get());
       return (mask_ == t->mask()  &&
               content_.get()->equal(t->content(),
                                     check_identities,
@@ -269,14 +295,14 @@ namespace awkward {
 
   const ContentPtr
   ByteMaskedArray::simplify_optiontype() const {
-    if (dynamic_cast<IndexedArray32*>(content_.get())        ||
-        dynamic_cast<IndexedArrayU32*>(content_.get())       ||
-        dynamic_cast<IndexedArray64*>(content_.get())        ||
-        dynamic_cast<IndexedOptionArray32*>(content_.get())  ||
-        dynamic_cast<IndexedOptionArray64*>(content_.get())  ||
-        dynamic_cast<ByteMaskedArray*>(content_.get())       ||
-        dynamic_cast<BitMaskedArray*>(content_.get())        ||
-        dynamic_cast<UnmaskedArray*>(content_.get())) {
+    if (content_.get()->kind() == ContentKind::IndexedArray32        ||
+        content_.get()->kind() == ContentKind::IndexedArrayU32       ||
+        content_.get()->kind() == ContentKind::IndexedArray64        ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray32  ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray64  ||
+        content_.get()->kind() == ContentKind::ByteMaskedArray       ||
+        content_.get()->kind() == ContentKind::BitMaskedArray        ||
+        content_.get()->kind() == ContentKind::UnmaskedArray) {
       ContentPtr step1 = toIndexedOptionArray64();
       IndexedOptionArray64* step2 =
         dynamic_cast<IndexedOptionArray64*>(step1.get());
@@ -308,6 +334,11 @@ namespace awkward {
     return "ByteMaskedArray";
   }
 
+  ContentKind
+  ByteMaskedArray::kind() const {
+    return ContentKind::ByteMaskedArray;
+  }
+
   void
   ByteMaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
@@ -449,14 +480,34 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  void
+  ByteMaskedArray::tojson_elements(ToJson& builder,
+                                   int64_t start,
+                                   int64_t stop) const {
+    const int8_t* mask = mask_.ptr().get() + mask_.offset();
+    int64_t i = start;
+    while (i < stop) {
+      int64_t run = 0;
+      while (i + run < stop  &&  (mask[i + run] != 0) == valid_when_) {
+        run++;
+      }
+      if (run == 0) {
+        builder.null();
+        i++;
+      }
+      else {
+        content_.get()->tojson_elements(builder, i, i + run);
+        i += run;
+      }
+    }
+  }
+
   void
   ByteMaskedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
     mask_.nbytes_part(largest);
@@ -499,6 +550,17 @@ namespace awkward {
                                              valid_when_);
   }
 
+  const ContentPtr
+  ByteMaskedArray::pack() const {
+    ContentPtr content =
+      content_.get()->getitem_range_nowrap(0, length()).get()->pack();
+    return std::make_shared<ByteMaskedArray>(identities_,
+                                             parameters_,
+                                             mask_.deep_copy(),
+                                             content,
+                                             valid_when_);
+  }
+
   void
   ByteMaskedArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -598,43 +660,26 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (dynamic_cast<SliceAt*>(head.get())  ||
-             dynamic_cast<SliceRange*>(head.get())  ||
-             dynamic_cast<SliceArray64*>(head.get())  ||
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      int64_t numnull;
-      std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
-      Index64 nextcarry = pair.first;
-      Index64 outindex = pair.second;
-
-      ContentPtr next = content_.get()->carry(nextcarry);
-
-      ContentPtr out = next.get()->getitem_next(head, tail, advanced);
-      IndexedOptionArray64 out2(identities_, parameters_, outindex, out);
-      return out2.simplify_optiontype();
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return Content::getitem_next(*ellipsis, tail, advanced);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return Content::getitem_next(*newaxis, tail, advanced);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      return Content::getitem_next(*field, tail, advanced);
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      return Content::getitem_next(*fields, tail, advanced);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return Content::getitem_next(*missing, tail, advanced);
-    }
-    else {
-      throw std::runtime_error("unrecognized slice type");
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+      case SliceKind::range:
+      case SliceKind::array64:
+      case SliceKind::jagged64: {
+        int64_t numnull;
+        std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+        Index64 nextcarry = pair.first;
+        Index64 outindex = pair.second;
+
+        ContentPtr next = content_.get()->carry(nextcarry);
+
+        ContentPtr out = next.get()->getitem_next(head, tail, advanced);
+        IndexedOptionArray64 out2(identities_, parameters_, outindex, out);
+        return out2.simplify_optiontype();
+      }
+      default:
+        // Ellipsis, newaxis, fields, and missing are independent of the
+        // option/union structure and are handled generically.
+        return Content::getitem_next(head, tail, advanced);
     }
   }
 
@@ -766,7 +811,8 @@ namespace awkward {
 
   bool
   ByteMaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -774,43 +820,48 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      default:
+        break;
     }
 
-    if (IndexedArray32* rawother =
-        dynamic_cast<IndexedArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::IndexedArray32) {
+      IndexedArray32* rawother = static_cast<IndexedArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArrayU32) {
+      IndexedArrayU32* rawother = static_cast<IndexedArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArray64) {
+      IndexedArray64* rawother = static_cast<IndexedArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray32) {
+      IndexedOptionArray32* rawother =
+        static_cast<IndexedOptionArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray64) {
+      IndexedOptionArray64* rawother =
+        static_cast<IndexedOptionArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ByteMaskedArray) {
+      ByteMaskedArray* rawother = static_cast<ByteMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::BitMaskedArray) {
+      BitMaskedArray* rawother = static_cast<BitMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnmaskedArray) {
+      UnmaskedArray* rawother = static_cast<UnmaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -950,48 +1001,7 @@ namespace awkward {
                                              mask,
                                              keepdims);
 
-    std::pair<bool, int64_t> branchdepth = branch_depth();
-    if (!branchdepth.first  &&  negaxis == branchdepth.second) {
-      return out;
-    }
-    else {
-      if (RegularArray* raw =
-          dynamic_cast<RegularArray*>(out.get())) {
-        out = raw->toListOffsetArray64(true);
-      }
-      if (ListOffsetArray64* raw =
-          dynamic_cast<ListOffsetArray64*>(out.get())) {
-        Index64 outoffsets(starts.length() + 1);
-        if (starts.length() > 0  &&  starts.getitem_at_nowrap(0) != 0) {
-          throw std::runtime_error(
-            "reduce_next with unbranching depth > negaxis expects "
-            "a ListOffsetArray64 whose offsets start at zero");
-        }
-        struct Error err3 = awkward_indexedarray_reduce_next_fix_offsets_64(
-          outoffsets.ptr().get(),
-          starts.ptr().get(),
-          starts.offset(),
-          starts.length(),
-          outindex.length());
-        util::handle_error(err3, classname(), identities_.get());
-
-        return std::make_shared<ListOffsetArray64>(
-          raw->identities(),
-          raw->parameters(),
-          outoffsets,
-          std::make_shared<IndexedOptionArray64>(Identities::none(),
-                                                 util::Parameters(),
-                                                 outindex,
-                                                 raw->content()));
-      }
-      else {
-        throw std::runtime_error(
-          std::string("reduce_next with unbranching depth > negaxis is only "
-                      "expected to return RegularArray or ListOffsetArray64; "
-                      "instead, it returned ")
-          + out.get()->classname());
-      }
-    }
+    return reduce_next_option_wrap(out, outindex, starts, negaxis);
   }
 
   const ContentPtr
@@ -20,6 +20,11 @@ namespace awkward {
                        const util::Parameters& parameters)
       : Form(has_identities, parameters) { }
 
+  FormKind
+  EmptyForm::kind() const {
+    return FormKind::EmptyForm;
+  }
+
   const TypePtr
   EmptyForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<UnknownType>(
@@ -97,6 +102,16 @@ namespace awkward {
     return std::vector<std::string>();
   }
 
+  const FormPtr
+  EmptyForm::getitem_field(const std::string& key) const {
+    throw std::invalid_argument("cannot slice EmptyArray by field name");
+  }
+
+  const FormPtr
+  EmptyForm::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument("cannot slice EmptyArray by field names");
+  }
+
   bool
   EmptyForm::equal(const FormPtr& other,
                    bool check_identities,
@@ -110,7 +125,7 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (EmptyForm* t = dynamic_cast<EmptyForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::EmptyForm) {
       return true;
     }
     else {
@@ -126,7 +141,7 @@ namespace awkward {
 
   const std::shared_ptr<NumpyArray>
   EmptyArray::toNumpyArray(const std::string& format, ssize_t itemsize) const {
-    std::shared_ptr<void> ptr(new uint8_t[0], util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr = util::allocate<uint8_t>(0);
     std::vector<ssize_t> shape({ 0 });
     std::vector<ssize_t> strides({ itemsize });
     return std::make_shared<NumpyArray>(identities_,
@@ -144,6 +159,11 @@ namespace awkward {
     return "EmptyArray";
   }
 
+  ContentKind
+  EmptyArray::kind() const {
+    return ContentKind::EmptyArray;
+  }
+
   void
   EmptyArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() != nullptr  &&
@@ -244,6 +264,11 @@ namespace awkward {
     return std::make_shared<EmptyArray>(identities, parameters_);
   }
 
+  const ContentPtr
+  EmptyArray::pack() const {
+    return shallow_copy();
+  }
+
   void
   EmptyArray::check_for_iteration() const { }
 
@@ -47,6 +47,11 @@ namespace awkward {
     return content_;
   }
 
+  FormKind
+  IndexedForm::kind() const {
+    return FormKind::IndexedForm;
+  }
+
   const TypePtr
   IndexedForm::type(const util::TypeStrs& typestrs) const {
     TypePtr out = content_.get()->type(typestrs);
@@ -143,6 +148,24 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  IndexedForm::getitem_field(const std::string& key) const {
+    return std::make_shared<IndexedForm>(
+      has_identities_,
+      util::Parameters(),
+      index_,
+      content_.get()->getitem_field(key));
+  }
+
+  const FormPtr
+  IndexedForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<IndexedForm>(
+      has_identities_,
+      util::Parameters(),
+      index_,
+      content_.get()->getitem_fields(keys));
+  }
+
   bool
   IndexedForm::equal(const FormPtr& other,
                      bool check_identities,
@@ -156,7 +179,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (IndexedForm* t = dynamic_cast<IndexedForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::IndexedForm) {
+      IndexedForm* t = static_cast<IndexedForm*>(other.get());
       return (index_ == t->index()  &&
               content_.get()->equal(t->content(),
                                     check_identities,
@@ -188,6 +212,11 @@ namespace awkward {
     return content_;
   }
 
+  FormKind
+  IndexedOptionForm::kind() const {
+    return FormKind::IndexedOptionForm;
+  }
+
   const TypePtr
   IndexedOptionForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
@@ -282,6 +311,25 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  IndexedOptionForm::getitem_field(const std::string& key) const {
+    return std::make_shared<IndexedOptionForm>(
+      has_identities_,
+      util::Parameters(),
+      index_,
+      content_.get()->getitem_field(key));
+  }
+
+  const FormPtr
+  IndexedOptionForm::getitem_fields(
+    const std::vector<std::string>& keys) const {
+    return std::make_shared<IndexedOptionForm>(
+      has_identities_,
+      util::Parameters(),
+      index_,
+      content_.get()->getitem_fields(keys));
+  }
+
   bool
   IndexedOptionForm::equal(const FormPtr& other,
                            bool check_identities,
@@ -295,7 +343,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (IndexedOptionForm* t = dynamic_cast<IndexedOptionForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::IndexedOptionForm) {
+      IndexedOptionForm* t = static_cast<IndexedOptionForm*>(other.get());
       return (index_ == t->index()  &&
               content_.get()->equal(t->content(),
                                     check_identities,
@@ -426,8 +475,9 @@ namespace awkward {
   const ContentPtr
   IndexedArrayOf<T, ISOPTION>::simplify_optiontype() const {
     if (ISOPTION) {
-      if (IndexedArray32* rawcontent =
-          dynamic_cast<IndexedArray32*>(content_.get())) {
+      if (content_.get()->kind() == ContentKind::IndexedArray32) {
+        IndexedArray32* rawcontent =
+          static_cast<IndexedArray32*>(content_.get());
         Index32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify32_to64(
@@ -444,8 +494,9 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (IndexedArrayU32* rawcontent =
-               dynamic_cast<IndexedArrayU32*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedArrayU32) {
+        IndexedArrayU32* rawcontent =
+          static_cast<IndexedArrayU32*>(content_.get());
         IndexU32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplifyU32_to64(
@@ -462,8 +513,9 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (IndexedArray64* rawcontent =
-               dynamic_cast<IndexedArray64*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedArray64) {
+        IndexedArray64* rawcontent =
+          static_cast<IndexedArray64*>(content_.get());
         Index64 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify64_to64(
@@ -480,8 +532,9 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (IndexedOptionArray32* rawcontent =
-               dynamic_cast<IndexedOptionArray32*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedOptionArray32) {
+        IndexedOptionArray32* rawcontent =
+          static_cast<IndexedOptionArray32*>(content_.get());
         Index32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify32_to64(
@@ -498,8 +551,9 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (IndexedOptionArray64* rawcontent =
-               dynamic_cast<IndexedOptionArray64*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedOptionArray64) {
+        IndexedOptionArray64* rawcontent =
+          static_cast<IndexedOptionArray64*>(content_.get());
         Index64 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify64_to64(
@@ -516,8 +570,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (ByteMaskedArray* step1 =
-               dynamic_cast<ByteMaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::ByteMaskedArray) {
+        ByteMaskedArray* step1 = static_cast<ByteMaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -537,8 +591,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (BitMaskedArray* step1 =
-               dynamic_cast<BitMaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::BitMaskedArray) {
+        BitMaskedArray* step1 = static_cast<BitMaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -558,8 +612,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (UnmaskedArray* step1 =
-               dynamic_cast<UnmaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::UnmaskedArray) {
+        UnmaskedArray* step1 = static_cast<UnmaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -584,8 +638,9 @@ namespace awkward {
       }
     }
     else {
-      if (IndexedArray32* rawcontent =
-          dynamic_cast<IndexedArray32*>(content_.get())) {
+      if (content_.get()->kind() == ContentKind::IndexedArray32) {
+        IndexedArray32* rawcontent =
+          static_cast<IndexedArray32*>(content_.get());
         Index32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify32_to64(
@@ -602,8 +657,9 @@ namespace awkward {
                                                 result,
                                                 rawcontent->content());
       }
-      else if (IndexedArrayU32* rawcontent =
-               dynamic_cast<IndexedArrayU32*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedArrayU32) {
+        IndexedArrayU32* rawcontent =
+          static_cast<IndexedArrayU32*>(content_.get());
         IndexU32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplifyU32_to64(
@@ -620,8 +676,9 @@ namespace awkward {
                                                 result,
                                                 rawcontent->content());
       }
-      else if (IndexedArray64* rawcontent =
-               dynamic_cast<IndexedArray64*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedArray64) {
+        IndexedArray64* rawcontent =
+          static_cast<IndexedArray64*>(content_.get());
         Index64 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify64_to64(
@@ -638,8 +695,9 @@ namespace awkward {
                                                 result,
                                                 rawcontent->content());
       }
-      else if (IndexedOptionArray32* rawcontent =
-               dynamic_cast<IndexedOptionArray32*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedOptionArray32) {
+        IndexedOptionArray32* rawcontent =
+          static_cast<IndexedOptionArray32*>(content_.get());
         Index32 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify32_to64(
@@ -656,8 +714,9 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (IndexedOptionArray64* rawcontent =
-               dynamic_cast<IndexedOptionArray64*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::IndexedOptionArray64) {
+        IndexedOptionArray64* rawcontent =
+          static_cast<IndexedOptionArray64*>(content_.get());
         Index64 inner = rawcontent->index();
         Index64 result(index_.length());
         struct Error err = util::awkward_indexedarray_simplify64_to64(
@@ -674,8 +733,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (ByteMaskedArray* step1 =
-               dynamic_cast<ByteMaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::ByteMaskedArray) {
+        ByteMaskedArray* step1 = static_cast<ByteMaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -695,8 +754,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (BitMaskedArray* step1 =
-               dynamic_cast<BitMaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::BitMaskedArray) {
+        BitMaskedArray* step1 = static_cast<BitMaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -716,8 +775,8 @@ namespace awkward {
                                                       result,
                                                       rawcontent->content());
       }
-      else if (UnmaskedArray* step1 =
-               dynamic_cast<UnmaskedArray*>(content_.get())) {
+      else if (content_.get()->kind() == ContentKind::UnmaskedArray) {
+        UnmaskedArray* step1 = static_cast<UnmaskedArray*>(content_.get());
         ContentPtr step2 = step1->toIndexedOptionArray64();
         IndexedOptionArray64* rawcontent =
           dynamic_cast<IndexedOptionArray64*>(step2.get());
@@ -774,6 +833,30 @@ namespace awkward {
     return "UnrecognizedIndexedArray";
   }
 
+  template <typename T, bool ISOPTION>
+  ContentKind
+  IndexedArrayOf<T, ISOPTION>::kind() const {
+    if (ISOPTION) {
+      if (std::is_same<T, int32_t>::value) {
+        return ContentKind::IndexedOptionArray32;
+      }
+      else {
+        return ContentKind::IndexedOptionArray64;
+      }
+    }
+    else {
+      if (std::is_same<T, int32_t>::value) {
+        return ContentKind::IndexedArray32;
+      }
+      else if (std::is_same<T, uint32_t>::value) {
+        return ContentKind::IndexedArrayU32;
+      }
+      else {
+        return ContentKind::IndexedArray64;
+      }
+    }
+  }
+
   template <typename T, bool ISOPTION>
   void
   IndexedArrayOf<T, ISOPTION>::setidentities(const IdentitiesPtr& identities) {
@@ -955,14 +1038,51 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  template <typename T, bool ISOPTION>
+  void
+  IndexedArrayOf<T, ISOPTION>::tojson_elements(ToJson& builder,
+                                               int64_t start,
+                                               int64_t stop) const {
+    const T* index = index_.ptr().get() + index_.offset();
+    int64_t lencontent = content_.get()->length();
+    int64_t i = start;
+    while (i < stop) {
+      int64_t first = (int64_t)index[i];
+      if (first < 0) {
+        if (ISOPTION) {
+          builder.null();
+          i++;
+          continue;
+        }
+        else {
+          util::handle_error(
+            failure("index[i] < 0", kSliceNone, i),
+            classname(),
+            identities_.get());
+        }
+      }
+      // Consecutive runs of the index are written in one call.
+      int64_t run = 1;
+      while (i + run < stop  &&  (int64_t)index[i + run] == first + run) {
+        run++;
+      }
+      if (first + run > lencontent) {
+        util::handle_error(
+          failure("index[i] >= len(content)", kSliceNone, i),
+          classname(),
+          identities_.get());
+      }
+      content_.get()->tojson_elements(builder, first, first + run);
+      i += run;
+    }
+  }
+
   template <typename T, bool ISOPTION>
   void
   IndexedArrayOf<T, ISOPTION>::nbytes_part(std::map<size_t,
@@ -1008,6 +1128,33 @@ namespace awkward {
                                                          content);
   }
 
+  template <typename T, bool ISOPTION>
+  const ContentPtr
+  IndexedArrayOf<T, ISOPTION>::pack() const {
+    if (ISOPTION) {
+      // Only the valid items are kept, in order, and missing ones stay -1.
+      int64_t numnull;
+      std::pair<Index64, IndexOf<T>> pair = nextcarry_outindex(numnull);
+      ContentPtr content =
+        content_.get()->carry(pair.first).get()->pack();
+      return std::make_shared<IndexedArrayOf<T, ISOPTION>>(identities_,
+                                                           parameters_,
+                                                           pair.second,
+                                                           content);
+    }
+    else if (parameters_.empty()) {
+      return project().get()->pack();
+    }
+    else {
+      // The index has a meaning of its own (e.g. categorical data).
+      return std::make_shared<IndexedArrayOf<T, ISOPTION>>(
+        identities_,
+        parameters_,
+        index_.deep_copy(),
+        content_.get()->pack());
+    }
+  }
+
   template <typename T, bool ISOPTION>
   void
   IndexedArrayOf<T, ISOPTION>::check_for_iteration() const {
@@ -1129,75 +1276,51 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (dynamic_cast<SliceAt*>(head.get())  ||
-             dynamic_cast<SliceRange*>(head.get())  ||
-             dynamic_cast<SliceArray64*>(head.get())  ||
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      if (ISOPTION) {
-        int64_t numnull;
-        std::pair<Index64, IndexOf<T>> pair = nextcarry_outindex(numnull);
-        Index64 nextcarry = pair.first;
-        IndexOf<T> outindex = pair.second;
-
-        ContentPtr next = content_.get()->carry(nextcarry);
-        ContentPtr out = next.get()->getitem_next(head, tail, advanced);
-        IndexedArrayOf<T, ISOPTION> out2(identities_,
-                                         parameters_,
-                                         outindex,
-                                         out);
-        return out2.simplify_optiontype();
-      }
-      else {
-        Index64 nextcarry(length());
-        struct Error err = util::awkward_indexedarray_getitem_nextcarry_64<T>(
-          nextcarry.ptr().get(),
-          index_.ptr().get(),
-          index_.offset(),
-          index_.length(),
-          content_.get()->length());
-        util::handle_error(err, classname(), identities_.get());
-
-        ContentPtr next = content_.get()->carry(nextcarry);
-        return next.get()->getitem_next(head, tail, advanced);
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+      case SliceKind::range:
+      case SliceKind::array64:
+      case SliceKind::jagged64: {
+        if (ISOPTION) {
+          int64_t numnull;
+          std::pair<Index64, IndexOf<T>> pair = nextcarry_outindex(numnull);
+          Index64 nextcarry = pair.first;
+          IndexOf<T> outindex = pair.second;
+
+          ContentPtr next = content_.get()->carry(nextcarry);
+          ContentPtr out = next.get()->getitem_next(head, tail, advanced);
+          IndexedArrayOf<T, ISOPTION> out2(identities_,
+                                           parameters_,
+                                           outindex,
+                                           out);
+          return out2.simplify_optiontype();
+        }
+        else {
+          Index64 nextcarry(length());
+          struct Error err = util::awkward_indexedarray_getitem_nextcarry_64<T>(
+            nextcarry.ptr().get(),
+            index_.ptr().get(),
+            index_.offset(),
+            index_.length(),
+            content_.get()->length());
+          util::handle_error(err, classname(), identities_.get());
+
+          ContentPtr next = content_.get()->carry(nextcarry);
+          return next.get()->getitem_next(head, tail, advanced);
+        }
       }
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return Content::getitem_next(*ellipsis, tail, advanced);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return Content::getitem_next(*newaxis, tail, advanced);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      return Content::getitem_next(*field, tail, advanced);
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      return Content::getitem_next(*fields, tail, advanced);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return Content::getitem_next(*missing, tail, advanced);
-    }
-    else {
-      throw std::runtime_error("unrecognized slice type");
+      default:
+        // Ellipsis, newaxis, fields, and missing are independent of the
+        // option/union structure and are handled generically.
+        return Content::getitem_next(head, tail, advanced);
     }
   }
 
   template <typename T, bool ISOPTION>
   const ContentPtr
   IndexedArrayOf<T, ISOPTION>::carry(const Index64& carry) const {
-    IndexOf<T> nextindex(carry.length());
-    struct Error err = util::awkward_indexedarray_getitem_carry_64<T>(
-      nextindex.ptr().get(),
-      index_.ptr().get(),
-      carry.ptr().get(),
-      index_.offset(),
-      index_.length(),
-      carry.length());
-    util::handle_error(err, classname(), identities_.get());
+    // Compose the indexes; content_ is only gathered when projected.
+    IndexOf<T> nextindex = index_.getitem_carry_64(carry);
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
       identities = identities_.get()->getitem_carry_64(carry);
@@ -1343,7 +1466,8 @@ namespace awkward {
   bool
   IndexedArrayOf<T, ISOPTION>::mergeable(const ContentPtr& other,
                                          bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -1351,43 +1475,48 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      default:
+        break;
     }
 
-    if (IndexedArray32* rawother =
-        dynamic_cast<IndexedArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::IndexedArray32) {
+      IndexedArray32* rawother = static_cast<IndexedArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArrayU32) {
+      IndexedArrayU32* rawother = static_cast<IndexedArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArray64) {
+      IndexedArray64* rawother = static_cast<IndexedArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray32) {
+      IndexedOptionArray32* rawother =
+        static_cast<IndexedOptionArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray64) {
+      IndexedOptionArray64* rawother =
+        static_cast<IndexedOptionArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ByteMaskedArray) {
+      ByteMaskedArray* rawother = static_cast<ByteMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::BitMaskedArray) {
+      BitMaskedArray* rawother = static_cast<BitMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnmaskedArray) {
+      UnmaskedArray* rawother = static_cast<UnmaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -1398,7 +1527,8 @@ namespace awkward {
   template <typename T, bool ISOPTION>
   const ContentPtr
   IndexedArrayOf<T, ISOPTION>::reverse_merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return reverse_merge(raw->array());
     }
 
@@ -1414,7 +1544,6 @@ namespace awkward {
       0);
     util::handle_error(err1, classname(), identities_.get());
 
-    int64_t mycontentlength = content_.get()->length();
     if (std::is_same<T, int32_t>::value) {
       struct Error err2 = awkward_indexedarray_fill_to64_from32(
         index.ptr().get(),
@@ -1422,7 +1551,7 @@ namespace awkward {
         reinterpret_cast<int32_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
     else if (std::is_same<T, uint32_t>::value) {
@@ -1432,17 +1561,17 @@ namespace awkward {
         reinterpret_cast<uint32_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
-    if (std::is_same<T, int64_t>::value) {
+    else if (std::is_same<T, int64_t>::value) {
       struct Error err2 = awkward_indexedarray_fill_to64_from64(
         index.ptr().get(),
         theirlength,
         reinterpret_cast<int64_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
     else {
@@ -1459,7 +1588,8 @@ namespace awkward {
   template <typename T, bool ISOPTION>
   const ContentPtr
   IndexedArrayOf<T, ISOPTION>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -1467,20 +1597,15 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
     }
 
     int64_t mylength = length();
@@ -1522,24 +1647,25 @@ namespace awkward {
     }
 
     ContentPtr replaced_other = other;
-    if (ByteMaskedArray* rawother =
-        dynamic_cast<ByteMaskedArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::ByteMaskedArray) {
+      ByteMaskedArray* rawother = static_cast<ByteMaskedArray*>(other.get());
       replaced_other = rawother->toIndexedOptionArray64();
     }
-    else if (BitMaskedArray* rawother =
-        dynamic_cast<BitMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::BitMaskedArray) {
+      BitMaskedArray* rawother = static_cast<BitMaskedArray*>(other.get());
       replaced_other = rawother->toIndexedOptionArray64();
     }
-    else if (UnmaskedArray* rawother =
-        dynamic_cast<UnmaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnmaskedArray) {
+      UnmaskedArray* rawother = static_cast<UnmaskedArray*>(other.get());
       replaced_other = rawother->toIndexedOptionArray64();
     }
 
     int64_t mycontentlength = content_.get()->length();
     ContentPtr content;
     bool other_isoption = false;
-    if (IndexedArray32* rawother =
-        dynamic_cast<IndexedArray32*>(replaced_other.get())) {
+    if (replaced_other.get()->kind() == ContentKind::IndexedArray32) {
+      IndexedArray32* rawother =
+        static_cast<IndexedArray32*>(replaced_other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_index = rawother->index();
       struct Error err = awkward_indexedarray_fill_to64_from32(
@@ -1553,8 +1679,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(replaced_other.get())) {
+    else if (replaced_other.get()->kind() == ContentKind::IndexedArrayU32) {
+      IndexedArrayU32* rawother =
+        static_cast<IndexedArrayU32*>(replaced_other.get());
       content = content_.get()->merge(rawother->content());
       IndexU32 other_index = rawother->index();
       struct Error err = awkward_indexedarray_fill_to64_fromU32(
@@ -1568,8 +1695,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(replaced_other.get())) {
+    else if (replaced_other.get()->kind() == ContentKind::IndexedArray64) {
+      IndexedArray64* rawother =
+        static_cast<IndexedArray64*>(replaced_other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_index = rawother->index();
       struct Error err = awkward_indexedarray_fill_to64_from64(
@@ -1583,8 +1711,10 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(replaced_other.get())) {
+    else if (replaced_other.get()->kind() ==
+             ContentKind::IndexedOptionArray32) {
+      IndexedOptionArray32* rawother =
+        static_cast<IndexedOptionArray32*>(replaced_other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_index = rawother->index();
       struct Error err = awkward_indexedarray_fill_to64_from32(
@@ -1599,8 +1729,10 @@ namespace awkward {
                          rawother->identities().get());
       other_isoption = true;
     }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(replaced_other.get())) {
+    else if (replaced_other.get()->kind() ==
+             ContentKind::IndexedOptionArray64) {
+      IndexedOptionArray64* rawother =
+        static_cast<IndexedOptionArray64*>(replaced_other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_index = rawother->index();
       struct Error err = awkward_indexedarray_fill_to64_from64(
@@ -1666,8 +1798,8 @@ namespace awkward {
       ContentPtr next = content_.get()->carry(nextcarry);
 
       SliceItemPtr slicecontent = next.get()->asslice();
-      if (SliceArray64* raw =
-          dynamic_cast<SliceArray64*>(slicecontent.get())) {
+      if (slicecontent.get()->kind() == SliceKind::array64) {
+        SliceArray64* raw = static_cast<SliceArray64*>(slicecontent.get());
         if (raw->frombool()) {
           Index64 nonzero(raw->index());
           Index8 originalmask(length());
@@ -1865,49 +1997,7 @@ namespace awkward {
                                              mask,
                                              keepdims);
 
-    std::pair<bool, int64_t> branchdepth = branch_depth();
-    if (!branchdepth.first  &&  negaxis == branchdepth.second) {
-      return out;
-    }
-    else {
-      if (RegularArray* raw =
-          dynamic_cast<RegularArray*>(out.get())) {
-        out = raw->toListOffsetArray64(true);
-      }
-      if (ListOffsetArray64* raw =
-          dynamic_cast<ListOffsetArray64*>(out.get())) {
-        Index64 outoffsets(starts.length() + 1);
-        if (starts.length() > 0  &&  starts.getitem_at_nowrap(0) != 0) {
-          throw std::runtime_error(
-            "reduce_next with unbranching depth > negaxis expects a "
-            "ListOffsetArray64 whose offsets start at zero");
-        }
-        struct Error err3 = awkward_indexedarray_reduce_next_fix_offsets_64(
-          outoffsets.ptr().get(),
-          starts.ptr().get(),
-          starts.offset(),
-          starts.length(),
-          outindex.length());
-        util::handle_error(err3, classname(), identities_.get());
-
-        return std::make_shared<ListOffsetArray64>(
-          raw->identities(),
-          raw->parameters(),
-          outoffsets,
-          std::make_shared<IndexedOptionArray64>(Identities::none(),
-                                                 util::Parameters(),
-                                                 outindex,
-                                                 raw->content()));
-      }
-      else {
-        throw std::runtime_error(
-          std::string("reduce_next with unbranching depth > negaxis is only "
-                      "expected to return RegularArray or ListOffsetArray64; "
-                      "instead, it returned ") + out.get()->classname());
-      }
-    }
-
-    return out;
+    return reduce_next_option_wrap(out, outindex, starts, negaxis);
   }
 
   template <typename T, bool ISOPTION>
@@ -53,6 +53,11 @@ namespace awkward {
     return content_;
   }
 
+  FormKind
+  ListForm::kind() const {
+    return FormKind::ListForm;
+  }
+
   const TypePtr
   ListForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<ListType>(
@@ -157,6 +162,26 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  ListForm::getitem_field(const std::string& key) const {
+    return std::make_shared<ListForm>(
+      has_identities_,
+      util::Parameters(),
+      starts_,
+      stops_,
+      content_.get()->getitem_field(key));
+  }
+
+  const FormPtr
+  ListForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<ListForm>(
+      has_identities_,
+      util::Parameters(),
+      starts_,
+      stops_,
+      content_.get()->getitem_fields(keys));
+  }
+
   bool
   ListForm::equal(const FormPtr& other,
                   bool check_identities,
@@ -170,7 +195,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (ListForm* t = dynamic_cast<ListForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::ListForm) {
+      ListForm* t = static_cast<ListForm*>(other.get());
       return (starts_ == t->starts()  &&
               stops_ == t->stops()  &&
               content_.get()->equal(t->content(),
@@ -185,6 +211,86 @@ namespace awkward {
 
   ////////// ListArray
 
+  namespace {
+    struct Error
+    listarray_fill_to64(Index64& tostarts,
+                        Index64& tostops,
+                        int64_t at,
+                        const Index32& fromstarts,
+                        const Index32& fromstops,
+                        int64_t base) {
+      return awkward_listarray_fill_to64_from32(tostarts.ptr().get(),
+                                                at,
+                                                tostops.ptr().get(),
+                                                at,
+                                                fromstarts.ptr().get(),
+                                                fromstarts.offset(),
+                                                fromstops.ptr().get(),
+                                                fromstops.offset(),
+                                                fromstarts.length(),
+                                                base);
+    }
+
+    struct Error
+    listarray_fill_to64(Index64& tostarts,
+                        Index64& tostops,
+                        int64_t at,
+                        const IndexU32& fromstarts,
+                        const IndexU32& fromstops,
+                        int64_t base) {
+      return awkward_listarray_fill_to64_fromU32(tostarts.ptr().get(),
+                                                 at,
+                                                 tostops.ptr().get(),
+                                                 at,
+                                                 fromstarts.ptr().get(),
+                                                 fromstarts.offset(),
+                                                 fromstops.ptr().get(),
+                                                 fromstops.offset(),
+                                                 fromstarts.length(),
+                                                 base);
+    }
+
+    struct Error
+    listarray_fill_to64(Index64& tostarts,
+                        Index64& tostops,
+                        int64_t at,
+                        const Index64& fromstarts,
+                        const Index64& fromstops,
+                        int64_t base) {
+      return awkward_listarray_fill_to64_from64(tostarts.ptr().get(),
+                                                at,
+                                                tostops.ptr().get(),
+                                                at,
+                                                fromstarts.ptr().get(),
+                                                fromstarts.offset(),
+                                                fromstops.ptr().get(),
+                                                fromstops.offset(),
+                                                fromstarts.length(),
+                                                base);
+    }
+
+    /// @brief Fills the starts and stops of `list`, a node of type `L`,
+    /// into `tostarts` and `tostops` at `at`, shifted by `base`, and returns
+    /// its content.
+    template <typename L>
+    const ContentPtr
+    fill_list_to64(Index64& tostarts,
+                   Index64& tostops,
+                   int64_t at,
+                   const ContentPtr& list,
+                   int64_t base) {
+      L* raw = static_cast<L*>(list.get());
+      struct Error err = listarray_fill_to64(tostarts,
+                                             tostops,
+                                             at,
+                                             raw->starts(),
+                                             raw->stops(),
+                                             base);
+      util::handle_error(err, raw->classname(), raw->identities().get());
+      return raw->content();
+    }
+  }
+
   template <typename T>
   ListArrayOf<T>::ListArrayOf(const IdentitiesPtr& identities,
                               const util::Parameters& parameters,
@@ -310,6 +416,20 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  ContentKind
+  ListArrayOf<T>::kind() const {
+    if (std::is_same<T, int32_t>::value) {
+      return ContentKind::ListArray32;
+    }
+    else if (std::is_same<T, uint32_t>::value) {
+      return ContentKind::ListArrayU32;
+    }
+    else {
+      return ContentKind::ListArray64;
+    }
+  }
+
   template <typename T>
   void
   ListArrayOf<T>::setidentities(const IdentitiesPtr& identities) {
@@ -487,14 +607,50 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  template <typename T>
+  void
+  ListArrayOf<T>::tojson_elements(ToJson& builder,
+                                  int64_t start,
+                                  int64_t stop) const {
+    const T* starts = starts_.ptr().get() + starts_.offset();
+    const T* stops = stops_.ptr().get() + stops_.offset();
+    int64_t lencontent = content_.get()->length();
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t liststart = (int64_t)starts[i];
+      int64_t liststop = (int64_t)stops[i];
+      if (liststart == liststop) {
+        liststart = liststop = 0;
+      }
+      if (liststart < 0) {
+        util::handle_error(
+          failure("starts[i] < 0", kSliceNone, i),
+          classname(),
+          identities_.get());
+      }
+      if (liststart > liststop) {
+        util::handle_error(
+          failure("starts[i] > stops[i]", kSliceNone, i),
+          classname(),
+          identities_.get());
+      }
+      if (liststop > lencontent) {
+        util::handle_error(
+          failure("starts[i] != stops[i] and stops[i] > len(content)",
+                  kSliceNone,
+                  i),
+          classname(),
+          identities_.get());
+      }
+      content_.get()->tojson_sublist(builder, liststart, liststop);
+    }
+  }
+
   template <typename T>
   void
   ListArrayOf<T>::nbytes_part(std::map<size_t, int64_t>& largest) const {
@@ -543,6 +699,13 @@ namespace awkward {
                                             content);
   }
 
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::pack() const {
+    // Carrying the content into list order leaves only what is reachable.
+    return toListOffsetArray64(true).get()->pack();
+  }
+
   template <typename T>
   void
   ListArrayOf<T>::check_for_iteration() const {
@@ -806,7 +969,8 @@ namespace awkward {
   template <typename T>
   bool
   ListArrayOf<T>::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -814,71 +978,54 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-
-    if (RegularArray* rawother =
-        dynamic_cast<RegularArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+        return mergeable(option_content(other), mergebool);
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawother = static_cast<RegularArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray32* rawother =
-             dynamic_cast<ListArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray32) {
+      ListArray32* rawother = static_cast<ListArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArrayU32* rawother =
-             dynamic_cast<ListArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArrayU32) {
+      ListArrayU32* rawother = static_cast<ListArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray64* rawother =
-             dynamic_cast<ListArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray64) {
+      ListArray64* rawother = static_cast<ListArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray32* rawother =
-             dynamic_cast<ListOffsetArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray32) {
+      ListOffsetArray32* rawother =
+        static_cast<ListOffsetArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArrayU32* rawother =
-             dynamic_cast<ListOffsetArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArrayU32) {
+      ListOffsetArrayU32* rawother =
+        static_cast<ListOffsetArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray64* rawother =
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray64) {
+      ListOffsetArray64* rawother =
+        static_cast<ListOffsetArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -889,7 +1036,8 @@ namespace awkward {
   template <typename T>
   const ContentPtr
   ListArrayOf<T>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -897,52 +1045,23 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
     }
 
     int64_t mylength = length();
@@ -998,8 +1117,8 @@ namespace awkward {
 
     int64_t mycontentlength = content_.get()->length();
     ContentPtr content;
-    if (ListArray32* rawother =
-        dynamic_cast<ListArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::ListArray32) {
+      ListArray32* rawother = static_cast<ListArray32*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_starts = rawother->starts();
       Index32 other_stops = rawother->stops();
@@ -1018,8 +1137,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListArrayU32* rawother =
-             dynamic_cast<ListArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArrayU32) {
+      ListArrayU32* rawother = static_cast<ListArrayU32*>(other.get());
       content = content_.get()->merge(rawother->content());
       IndexU32 other_starts = rawother->starts();
       IndexU32 other_stops = rawother->stops();
@@ -1038,8 +1157,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListArray64* rawother =
-             dynamic_cast<ListArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray64) {
+      ListArray64* rawother = static_cast<ListArray64*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_starts = rawother->starts();
       Index64 other_stops = rawother->stops();
@@ -1058,8 +1177,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArray32* rawother =
-             dynamic_cast<ListOffsetArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray32) {
+      ListOffsetArray32* rawother =
+        static_cast<ListOffsetArray32*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_starts = rawother->starts();
       Index32 other_stops = rawother->stops();
@@ -1077,8 +1197,9 @@ namespace awkward {
       util::handle_error(err, rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArrayU32* rawother =
-             dynamic_cast<ListOffsetArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArrayU32) {
+      ListOffsetArrayU32* rawother =
+        static_cast<ListOffsetArrayU32*>(other.get());
       content = content_.get()->merge(rawother->content());
       IndexU32 other_starts = rawother->starts();
       IndexU32 other_stops = rawother->stops();
@@ -1097,8 +1218,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArray64* rawother =
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray64) {
+      ListOffsetArray64* rawother =
+        static_cast<ListOffsetArray64*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_starts = rawother->starts();
       Index64 other_stops = rawother->stops();
@@ -1117,8 +1239,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (RegularArray* rawregulararray =
-             dynamic_cast<RegularArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawregulararray = static_cast<RegularArray*>(other.get());
       ContentPtr listoffsetarray = rawregulararray->toListOffsetArray64(true);
       ListOffsetArray64* rawother =
         dynamic_cast<ListOffsetArray64*>(listoffsetarray.get());
@@ -1153,6 +1275,89 @@ namespace awkward {
                                          content);
   }
 
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::merge_many(const ContentPtrVec& others,
+                             bool mergebool) const {
+    ContentPtrVec lists({ shallow_copy() });
+    ContentPtrVec inputs(lists);
+    inputs.insert(inputs.end(), others.begin(), others.end());
+    if (!all_mergeable(inputs, mergebool)) {
+      return Content::merge_many(others, mergebool);
+    }
+    int64_t total = length();
+    for (auto& other : others) {
+      if (!parameters_equal(other.get()->parameters())) {
+        return Content::merge_many(others, mergebool);
+      }
+      switch (other.get()->kind()) {
+        case ContentKind::EmptyArray:
+          break;
+        case ContentKind::ListArray32:
+        case ContentKind::ListArrayU32:
+        case ContentKind::ListArray64:
+        case ContentKind::ListOffsetArray32:
+        case ContentKind::ListOffsetArrayU32:
+        case ContentKind::ListOffsetArray64:
+          lists.push_back(other);
+          total += other.get()->length();
+          break;
+        case ContentKind::RegularArray:
+          lists.push_back(static_cast<RegularArray*>(other.get())
+                            ->toListOffsetArray64(true));
+          total += other.get()->length();
+          break;
+        default:
+          return Content::merge_many(others, mergebool);
+      }
+    }
+
+    // Each list's starts and stops are shifted past the contents before it,
+    // and the contents are concatenated in one step.
+    Index64 starts(total);
+    Index64 stops(total);
+    ContentPtrVec contents;
+    int64_t at = 0;
+    int64_t base = 0;
+    for (auto& list : lists) {
+      ContentPtr content;
+      switch (list.get()->kind()) {
+        case ContentKind::ListArray32:
+          content = fill_list_to64<ListArray32>(starts, stops, at, list, base);
+          break;
+        case ContentKind::ListArrayU32:
+          content = fill_list_to64<ListArrayU32>(starts, stops, at, list, base);
+          break;
+        case ContentKind::ListArray64:
+          content = fill_list_to64<ListArray64>(starts, stops, at, list, base);
+          break;
+        case ContentKind::ListOffsetArray32:
+          content =
+            fill_list_to64<ListOffsetArray32>(starts, stops, at, list, base);
+          break;
+        case ContentKind::ListOffsetArrayU32:
+          content =
+            fill_list_to64<ListOffsetArrayU32>(starts, stops, at, list, base);
+          break;
+        default:
+          content =
+            fill_list_to64<ListOffsetArray64>(starts, stops, at, list, base);
+          break;
+      }
+      contents.push_back(content);
+      at += list.get()->length();
+      base += content.get()->length();
+    }
+    ContentPtrVec rest(contents.begin() + 1, contents.end());
+    ContentPtr content = contents[0].get()->merge_many(rest, mergebool);
+
+    return std::make_shared<ListArray64>(Identities::none(),
+                                         parameters_,
+                                         starts,
+                                         stops,
+                                         content);
+  }
+
   template <typename T>
   const SliceItemPtr
   ListArrayOf<T>::asslice() const {
@@ -1335,8 +1540,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr = util::allocate<int64_t>(totallen);
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
@@ -1714,7 +1918,7 @@ namespace awkward {
     util::handle_error(err2, classname(), nullptr);
 
     ContentPtr out;
-    if (dynamic_cast<SliceJagged64*>(slicecontent.content().get())) {
+    if (slicecontent.content().get()->kind() == SliceKind::jagged64) {
       ContentPtr nextcontent = content_.get()->carry(nextcarry);
       ContentPtr next = std::make_shared<ListOffsetArray64>(Identities::none(),
                                                             util::Parameters(),
@@ -47,6 +47,11 @@ namespace awkward {
     return content_;
   }
 
+  FormKind
+  ListOffsetForm::kind() const {
+    return FormKind::ListOffsetForm;
+  }
+
   const TypePtr
   ListOffsetForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<ListType>(
@@ -148,6 +153,24 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  ListOffsetForm::getitem_field(const std::string& key) const {
+    return std::make_shared<ListOffsetForm>(
+      has_identities_,
+      util::Parameters(),
+      offsets_,
+      content_.get()->getitem_field(key));
+  }
+
+  const FormPtr
+  ListOffsetForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<ListOffsetForm>(
+      has_identities_,
+      util::Parameters(),
+      offsets_,
+      content_.get()->getitem_fields(keys));
+  }
+
   bool
   ListOffsetForm::equal(const FormPtr& other,
                         bool check_identities,
@@ -161,7 +184,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (ListOffsetForm* t = dynamic_cast<ListOffsetForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::ListOffsetForm) {
+      ListOffsetForm* t = static_cast<ListOffsetForm*>(other.get());
       return (offsets_ == t->offsets()  &&
               content_.get()->equal(t->content(),
                                     check_identities,
@@ -344,6 +368,20 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  ContentKind
+  ListOffsetArrayOf<T>::kind() const {
+    if (std::is_same<T, int32_t>::value) {
+      return ContentKind::ListOffsetArray32;
+    }
+    else if (std::is_same<T, uint32_t>::value) {
+      return ContentKind::ListOffsetArrayU32;
+    }
+    else {
+      return ContentKind::ListOffsetArray64;
+    }
+  }
+
   template <typename T>
   void
   ListOffsetArrayOf<T>::setidentities(const IdentitiesPtr& identities) {
@@ -503,14 +541,48 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  template <typename T>
+  void
+  ListOffsetArrayOf<T>::tojson_elements(ToJson& builder,
+                                        int64_t start,
+                                        int64_t stop) const {
+    const T* offsets = offsets_.ptr().get() + offsets_.offset();
+    int64_t lencontent = content_.get()->length();
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t liststart = (int64_t)offsets[i];
+      int64_t liststop = (int64_t)offsets[i + 1];
+      if (liststart == liststop) {
+        liststart = liststop = 0;
+      }
+      if (liststart < 0) {
+        util::handle_error(failure(
+                             "offsets[i] < 0", kSliceNone, i),
+                           classname(),
+                           identities_.get());
+      }
+      if (liststart > liststop) {
+        util::handle_error(failure(
+                             "offsets[i] > offsets[i + 1]", kSliceNone, i),
+                           classname(),
+                           identities_.get());
+      }
+      if (liststop > lencontent) {
+        util::handle_error(failure(
+                             "offsets[i] != offsets[i + 1] and "
+                             "offsets[i + 1] > len(content)", kSliceNone, i),
+                           classname(),
+                           identities_.get());
+      }
+      content_.get()->tojson_sublist(builder, liststart, liststop);
+    }
+  }
+
   template <typename T>
   void
   ListOffsetArrayOf<T>::nbytes_part(std::map<size_t, int64_t>& largest) const {
@@ -555,6 +627,22 @@ namespace awkward {
                                                   content);
   }
 
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::pack() const {
+    Index64 compact = compact_offsets64(true);
+    Index64 offsets = (compact.ptr().get() == (void*)offsets_.ptr().get())
+                        ? compact.deep_copy() : compact;
+    int64_t start = (int64_t)offsets_.getitem_at_nowrap(0);
+    int64_t stop = (int64_t)offsets_.getitem_at_nowrap(offsets_.length() - 1);
+    ContentPtr content =
+      content_.get()->getitem_range_nowrap(start, stop).get()->pack();
+    return std::make_shared<ListOffsetArray64>(identities_,
+                                               parameters_,
+                                               offsets,
+                                               content);
+  }
+
   template <typename T>
   void
   ListOffsetArrayOf<T>::check_for_iteration() const {
@@ -861,7 +949,8 @@ namespace awkward {
   bool
   ListOffsetArrayOf<T>::mergeable(const ContentPtr& other,
                                   bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -869,71 +958,54 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-
-    if (RegularArray* rawother =
-        dynamic_cast<RegularArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+        return mergeable(option_content(other), mergebool);
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawother = static_cast<RegularArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray32* rawother =
-             dynamic_cast<ListArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray32) {
+      ListArray32* rawother = static_cast<ListArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArrayU32* rawother =
-             dynamic_cast<ListArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArrayU32) {
+      ListArrayU32* rawother = static_cast<ListArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray64* rawother =
-             dynamic_cast<ListArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray64) {
+      ListArray64* rawother = static_cast<ListArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray32* rawother =
-             dynamic_cast<ListOffsetArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray32) {
+      ListOffsetArray32* rawother =
+        static_cast<ListOffsetArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArrayU32* rawother =
-             dynamic_cast<ListOffsetArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArrayU32) {
+      ListOffsetArrayU32* rawother =
+        static_cast<ListOffsetArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray64* rawother =
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray64) {
+      ListOffsetArray64* rawother =
+        static_cast<ListOffsetArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -944,7 +1016,8 @@ namespace awkward {
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -952,52 +1025,23 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
     }
 
     int64_t mylength = length();
@@ -1056,8 +1100,8 @@ namespace awkward {
 
     int64_t mycontentlength = content_.get()->length();
     ContentPtr content;
-    if (ListArray32* rawother =
-        dynamic_cast<ListArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::ListArray32) {
+      ListArray32* rawother = static_cast<ListArray32*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_starts = rawother->starts();
       Index32 other_stops = rawother->stops();
@@ -1076,8 +1120,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListArrayU32* rawother =
-             dynamic_cast<ListArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArrayU32) {
+      ListArrayU32* rawother = static_cast<ListArrayU32*>(other.get());
       content = content_.get()->merge(rawother->content());
       IndexU32 other_starts = rawother->starts();
       IndexU32 other_stops = rawother->stops();
@@ -1096,8 +1140,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListArray64* rawother =
-             dynamic_cast<ListArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray64) {
+      ListArray64* rawother = static_cast<ListArray64*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_starts = rawother->starts();
       Index64 other_stops = rawother->stops();
@@ -1116,8 +1160,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArray32* rawother =
-             dynamic_cast<ListOffsetArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray32) {
+      ListOffsetArray32* rawother =
+        static_cast<ListOffsetArray32*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index32 other_starts = rawother->starts();
       Index32 other_stops = rawother->stops();
@@ -1136,8 +1181,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArrayU32* rawother =
-             dynamic_cast<ListOffsetArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArrayU32) {
+      ListOffsetArrayU32* rawother =
+        static_cast<ListOffsetArrayU32*>(other.get());
       content = content_.get()->merge(rawother->content());
       IndexU32 other_starts = rawother->starts();
       IndexU32 other_stops = rawother->stops();
@@ -1156,8 +1202,9 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (ListOffsetArray64* rawother =
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray64) {
+      ListOffsetArray64* rawother =
+        static_cast<ListOffsetArray64*>(other.get());
       content = content_.get()->merge(rawother->content());
       Index64 other_starts = rawother->starts();
       Index64 other_stops = rawother->stops();
@@ -1176,8 +1223,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (RegularArray* rawregulararray =
-             dynamic_cast<RegularArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawregulararray = static_cast<RegularArray*>(other.get());
       ContentPtr listoffsetarray = rawregulararray->toListOffsetArray64(true);
       ListOffsetArray64* rawother =
         dynamic_cast<ListOffsetArray64*>(listoffsetarray.get());
@@ -1212,6 +1259,18 @@ namespace awkward {
                                          content);
   }
 
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::merge_many(const ContentPtrVec& others,
+                                   bool mergebool) const {
+    ListArrayOf<T> lists(identities_,
+                         parameters_,
+                         util::make_starts(offsets_),
+                         util::make_stops(offsets_),
+                         content_);
+    return lists.merge_many(others, mergebool);
+  }
+
   template <>
   const SliceItemPtr ListOffsetArrayOf<int64_t>::asslice() const {
     int64_t start = offsets_.getitem_at_nowrap(0);
@@ -1231,8 +1290,8 @@ namespace awkward {
     }
 
     SliceItemPtr slicecontent = next.get()->asslice();
-    if (SliceArray64* array =
-        dynamic_cast<SliceArray64*>(slicecontent.get())) {
+    if (slicecontent.get()->kind() == SliceKind::array64) {
+      SliceArray64* array = static_cast<SliceArray64*>(slicecontent.get());
       if (array->frombool()) {
         Index64 nonzero(array->index());
         Index64 adjustedoffsets(offsets.get()->length());
@@ -1254,10 +1313,12 @@ namespace awkward {
         return std::make_shared<SliceJagged64>(adjustedoffsets, newarray);
       }
     }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(slicecontent.get())) {
-      if (SliceArray64* array =
-          dynamic_cast<SliceArray64*>(missing->content().get())) {
+    else if (slicecontent.get()->kind() == SliceKind::missing64) {
+      SliceMissing64* missing =
+        static_cast<SliceMissing64*>(slicecontent.get());
+      if (missing->content().get()->kind() == SliceKind::array64) {
+        SliceArray64* array =
+          static_cast<SliceArray64*>(missing->content().get());
         if (array->frombool()) {
           Index8 originalmask = missing->originalmask();
           Index64 index = missing->index();
@@ -1402,13 +1463,15 @@ namespace awkward {
     }
   }
 
-  template <>
-  const ContentPtr ListOffsetArrayOf<int64_t>::reduce_next(
-    const Reducer& reducer,
-    int64_t negaxis,
-    const Index64& starts,
-    const Index64& parents,
-    int64_t outlength, bool mask, bool keepdims) const {
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::reduce_next(const Reducer& reducer,
+                                    int64_t negaxis,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength,
+                                    bool mask,
+                                    bool keepdims) const {
 
     std::pair<bool, int64_t> branchdepth = branch_depth();
 
@@ -1419,7 +1482,8 @@ namespace awkward {
 
       int64_t globalstart;
       int64_t globalstop;
-      struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
+      struct Error err1 =
+        util::awkward_listoffsetarray_reduce_global_startstop_64<T>(
         &globalstart,
         &globalstop,
         offsets_.ptr().get(),
@@ -1431,7 +1495,7 @@ namespace awkward {
       int64_t maxcount;
       Index64 offsetscopy(offsets_.length());
       struct Error err2 =
-        awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+        util::awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64<T>(
         &maxcount,
         offsetscopy.ptr().get(),
         offsets_.ptr().get(),
@@ -1444,7 +1508,7 @@ namespace awkward {
       int64_t maxnextparents;
       Index64 distincts(maxcount * outlength);
       struct Error err3 =
-        awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+        util::awkward_listoffsetarray_reduce_nonlocal_preparenext_64<T>(
         nextcarry.ptr().get(),
         nextparents.ptr().get(),
         nextlen,
@@ -1510,7 +1574,8 @@ namespace awkward {
     else {
       int64_t globalstart;
       int64_t globalstop;
-      struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
+      struct Error err1 =
+        util::awkward_listoffsetarray_reduce_global_startstop_64<T>(
         &globalstart,
         &globalstop,
         offsets_.ptr().get(),
@@ -1518,28 +1583,52 @@ namespace awkward {
         offsets_.length() - 1);
       util::handle_error(err1, classname(), identities_.get());
 
-      Index64 nextparents(globalstop - globalstart);
-      struct Error err2 = awkward_listoffsetarray_reduce_local_nextparents_64(
-        nextparents.ptr().get(),
-        offsets_.ptr().get(),
-        offsets_.offset(),
-        offsets_.length() - 1);
-      util::handle_error(err2, classname(), identities_.get());
+      ContentPtr outcontent;
+      NumpyArray* rawcontent = dynamic_cast<NumpyArray*>(content_.get());
+      if (rawcontent != nullptr  &&
+          rawcontent->ndim() == 1  &&
+          rawcontent->iscontiguous()) {
+        // Contiguous leaf: reduce each list straight from the offsets,
+        // without materializing a parents index as long as the content.
+        outcontent = rawcontent->reduce_segments(reducer,
+                                                 offsets_,
+                                                 mask,
+                                                 keepdims);
+      }
+      else {
+        Index64 nextparents(globalstop - globalstart);
+        struct Error err2 =
+          util::awkward_listoffsetarray_reduce_local_nextparents_64<T>(
+          nextparents.ptr().get(),
+          offsets_.ptr().get(),
+          offsets_.offset(),
+          offsets_.length() - 1);
+        util::handle_error(err2, classname(), identities_.get());
 
-      ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
-                                                                globalstop);
-      ContentPtr outcontent = trimmed.get()->reduce_next(
-        reducer, negaxis, util::make_starts(offsets_), nextparents,
-        offsets_.length() - 1, mask, keepdims);
+        Index64 starts(offsets_.length() - 1);
+        struct Error err3 =
+          util::awkward_listoffsetarray_reduce_local_starts_64<T>(
+          starts.ptr().get(),
+          offsets_.ptr().get(),
+          offsets_.offset(),
+          offsets_.length() - 1);
+        util::handle_error(err3, classname(), identities_.get());
+
+        ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
+                                                                  globalstop);
+        outcontent = trimmed.get()->reduce_next(
+          reducer, negaxis, starts, nextparents,
+          offsets_.length() - 1, mask, keepdims);
+      }
 
       Index64 outoffsets(outlength + 1);
-      struct Error err3 = awkward_listoffsetarray_reduce_local_outoffsets_64(
+      struct Error err4 = awkward_listoffsetarray_reduce_local_outoffsets_64(
         outoffsets.ptr().get(),
         parents.ptr().get(),
         parents.offset(),
         parents.length(),
         outlength);
-      util::handle_error(err3, classname(), identities_.get());
+      util::handle_error(err4, classname(), identities_.get());
 
       return std::make_shared<ListOffsetArray64>(Identities::none(),
                                                  util::Parameters(),
@@ -1548,24 +1637,6 @@ namespace awkward {
     }
   }
 
-  template <typename T>
-  const ContentPtr
-  ListOffsetArrayOf<T>::reduce_next(const Reducer& reducer,
-                                    int64_t negaxis,
-                                    const Index64& starts,
-                                    const Index64& parents,
-                                    int64_t length,
-                                    bool mask,
-                                    bool keepdims) const {
-    return toListOffsetArray64(true).get()->reduce_next(reducer,
-                                                        negaxis,
-                                                        starts,
-                                                        parents,
-                                                        length,
-                                                        mask,
-                                                        keepdims);
-  }
-
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::localindex(int64_t axis, int64_t depth) const {
@@ -1636,8 +1707,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr = util::allocate<int64_t>(totallen);
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
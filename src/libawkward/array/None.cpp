@@ -23,6 +23,11 @@ namespace awkward {
     return "None";
   }
 
+  ContentKind
+  None::kind() const {
+    return ContentKind::None;
+  }
+
   void
   None::setidentities(const IdentitiesPtr& identities) {
     throw std::runtime_error(
@@ -91,6 +96,11 @@ namespace awkward {
     return std::make_shared<None>();
   }
 
+  const ContentPtr
+  None::pack() const {
+    return shallow_copy();
+  }
+
   void
   None::check_for_iteration() const { }
 
@@ -1,5 +1,7 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <numeric>
 #include <sstream>
@@ -25,6 +27,264 @@
 #include "awkward/array/NumpyArray.h"
 
 namespace awkward {
+  namespace {
+    /// @brief The awkward_numpyarray_fill_* kernels with their pointers
+    /// erased, so that they can be collected in tables indexed by
+    /// util::dtype.
+    typedef struct Error (*fill_fcn)(void* toptr,
+                                     int64_t tooffset,
+                                     const void* fromptr,
+                                     int64_t fromoffset,
+                                     int64_t length);
+
+    template <typename TO,
+              typename FROM,
+              struct Error (*KERNEL)(TO*, int64_t, const FROM*, int64_t,
+                                     int64_t)>
+    struct Error
+    fill_as(void* toptr,
+            int64_t tooffset,
+            const void* fromptr,
+            int64_t fromoffset,
+            int64_t length) {
+      return KERNEL(reinterpret_cast<TO*>(toptr),
+                    tooffset,
+                    reinterpret_cast<const FROM*>(fromptr),
+                    fromoffset,
+                    length);
+    }
+
+    // Each table is indexed by the util::dtype of the source array:
+    // boolean, int8, int16, int32, int64, uint8, uint16, uint32, uint64,
+    // float32, float64.
+
+    const fill_fcn fill_todouble[(size_t)util::dtype::size] = {
+      fill_as<double, bool, awkward_numpyarray_fill_todouble_frombool>,
+      fill_as<double, int8_t, awkward_numpyarray_fill_todouble_from8>,
+      fill_as<double, int16_t, awkward_numpyarray_fill_todouble_from16>,
+      fill_as<double, int32_t, awkward_numpyarray_fill_todouble_from32>,
+      fill_as<double, int64_t, awkward_numpyarray_fill_todouble_from64>,
+      fill_as<double, uint8_t, awkward_numpyarray_fill_todouble_fromU8>,
+      fill_as<double, uint16_t, awkward_numpyarray_fill_todouble_fromU16>,
+      fill_as<double, uint32_t, awkward_numpyarray_fill_todouble_fromU32>,
+      fill_as<double, uint64_t, awkward_numpyarray_fill_todouble_fromU64>,
+      fill_as<double, float, awkward_numpyarray_fill_todouble_fromfloat>,
+      fill_as<double, double, awkward_numpyarray_fill_todouble_fromdouble>
+    };
+
+    const fill_fcn fill_to64[(size_t)util::dtype::size] = {
+      fill_as<int64_t, bool, awkward_numpyarray_fill_to64_frombool>,
+      fill_as<int64_t, int8_t, awkward_numpyarray_fill_to64_from8>,
+      fill_as<int64_t, int16_t, awkward_numpyarray_fill_to64_from16>,
+      fill_as<int64_t, int32_t, awkward_numpyarray_fill_to64_from32>,
+      fill_as<int64_t, int64_t, awkward_numpyarray_fill_to64_from64>,
+      fill_as<int64_t, uint8_t, awkward_numpyarray_fill_to64_fromU8>,
+      fill_as<int64_t, uint16_t, awkward_numpyarray_fill_to64_fromU16>,
+      fill_as<int64_t, uint32_t, awkward_numpyarray_fill_to64_fromU32>,
+      fill_as<int64_t, uint64_t, awkward_numpyarray_fill_to64_fromU64>,
+      nullptr,
+      nullptr
+    };
+
+    const fill_fcn fill_toU64[(size_t)util::dtype::size] = {
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      fill_as<uint64_t, uint64_t, awkward_numpyarray_fill_toU64_fromU64>,
+      nullptr,
+      nullptr
+    };
+
+    const fill_fcn fill_tobool[(size_t)util::dtype::size] = {
+      fill_as<bool, bool, awkward_numpyarray_fill_tobool_frombool>,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr
+    };
+
+    /// @brief The dtype of the concatenation of two NumpyArrays:
+    /// `float64` if either is real, `uint64` if both are `uint64`,
+    /// `int64` if either is an integer, `boolean` if both are booleans,
+    /// and `NOT_PRIMITIVE` if they can't be merged.
+    util::dtype
+    merged_dtype(util::dtype left, util::dtype right) {
+      if (left == util::dtype::NOT_PRIMITIVE  ||
+          right == util::dtype::NOT_PRIMITIVE) {
+        return util::dtype::NOT_PRIMITIVE;
+      }
+      else if (util::is_real(left)  ||  util::is_real(right)) {
+        return util::dtype::float64;
+      }
+      else if (left == util::dtype::uint64  &&  right == util::dtype::uint64) {
+        return util::dtype::uint64;
+      }
+      else if (util::is_integer(left)  ||  util::is_integer(right)) {
+        return util::dtype::int64;
+      }
+      else {
+        return util::dtype::boolean;
+      }
+    }
+
+    /// @brief The fill table for a #merged_dtype result; every source
+    /// dtype that merges into it has a non-null entry.
+    const fill_fcn*
+    fill_kernels(util::dtype to) {
+      switch (to) {
+        case util::dtype::float64:
+          return fill_todouble;
+        case util::dtype::uint64:
+          return fill_toU64;
+        case util::dtype::int64:
+          return fill_to64;
+        default:
+          return fill_tobool;
+      }
+    }
+
+    /// @brief The Reducer::apply_* methods (for groups given by `parents`)
+    /// with their data pointer erased, so that they can be collected in a
+    /// table indexed by util::dtype.
+    typedef const std::shared_ptr<void> (*reduce_parents_fcn)(
+      const Reducer& reducer,
+      const void* data,
+      int64_t offset,
+      const Index64& starts,
+      const Index64& parents,
+      int64_t outlength);
+
+    template <typename T,
+              const std::shared_ptr<void> (Reducer::*APPLY)(
+                const T*, int64_t, const Index64&, const Index64&, int64_t)
+                const>
+    const std::shared_ptr<void>
+    reduce_parents_as(const Reducer& reducer,
+                      const void* data,
+                      int64_t offset,
+                      const Index64& starts,
+                      const Index64& parents,
+                      int64_t outlength) {
+      return (reducer.*APPLY)(reinterpret_cast<const T*>(data),
+                              offset,
+                              starts,
+                              parents,
+                              outlength);
+    }
+
+    const reduce_parents_fcn reduce_parents[(size_t)util::dtype::size] = {
+      reduce_parents_as<bool, &Reducer::apply_bool>,
+      reduce_parents_as<int8_t, &Reducer::apply_int8>,
+      reduce_parents_as<int16_t, &Reducer::apply_int16>,
+      reduce_parents_as<int32_t, &Reducer::apply_int32>,
+      reduce_parents_as<int64_t, &Reducer::apply_int64>,
+      reduce_parents_as<uint8_t, &Reducer::apply_uint8>,
+      reduce_parents_as<uint16_t, &Reducer::apply_uint16>,
+      reduce_parents_as<uint32_t, &Reducer::apply_uint32>,
+      reduce_parents_as<uint64_t, &Reducer::apply_uint64>,
+      reduce_parents_as<float, &Reducer::apply_float32>,
+      reduce_parents_as<double, &Reducer::apply_float64>
+    };
+
+    /// @brief The Reducer::apply_* methods for contiguous groups given by
+    /// `offsets` of type `O`, with their data pointer erased.
+    template <typename O>
+    using reduce_offsets_fcn = const std::shared_ptr<void> (*)(
+      const Reducer& reducer,
+      const void* data,
+      int64_t offset,
+      const IndexOf<O>& offsets);
+
+    template <typename T,
+              typename O,
+              const std::shared_ptr<void> (Reducer::*APPLY)(
+                const T*, int64_t, const IndexOf<O>&) const>
+    const std::shared_ptr<void>
+    reduce_offsets_as(const Reducer& reducer,
+                      const void* data,
+                      int64_t offset,
+                      const IndexOf<O>& offsets) {
+      return (reducer.*APPLY)(reinterpret_cast<const T*>(data),
+                              offset,
+                              offsets);
+    }
+
+    /// @brief The table of #reduce_offsets_as for each util::dtype, for
+    /// offsets of type `O`.
+    template <typename O>
+    const reduce_offsets_fcn<O>*
+    reduce_offsets() {
+      static const reduce_offsets_fcn<O> table[(size_t)util::dtype::size] = {
+        reduce_offsets_as<bool, O, &Reducer::apply_bool>,
+        reduce_offsets_as<int8_t, O, &Reducer::apply_int8>,
+        reduce_offsets_as<int16_t, O, &Reducer::apply_int16>,
+        reduce_offsets_as<int32_t, O, &Reducer::apply_int32>,
+        reduce_offsets_as<int64_t, O, &Reducer::apply_int64>,
+        reduce_offsets_as<uint8_t, O, &Reducer::apply_uint8>,
+        reduce_offsets_as<uint16_t, O, &Reducer::apply_uint16>,
+        reduce_offsets_as<uint32_t, O, &Reducer::apply_uint32>,
+        reduce_offsets_as<uint64_t, O, &Reducer::apply_uint64>,
+        reduce_offsets_as<float, O, &Reducer::apply_float32>,
+        reduce_offsets_as<double, O, &Reducer::apply_float64>
+      };
+      return table;
+    }
+
+    /// @brief Writes items `start` through `stop` of a one-dimensional
+    /// buffer whose items are `stride` bytes apart as JSON values.
+    typedef void (*tojson_fcn)(ToJson& builder,
+                               const uint8_t* data,
+                               ssize_t stride,
+                               int64_t start,
+                               int64_t stop);
+
+    void
+    tojson_booleans(ToJson& builder,
+                    const uint8_t* data,
+                    ssize_t stride,
+                    int64_t start,
+                    int64_t stop) {
+      for (int64_t i = start;  i < stop;  i++) {
+        builder.boolean(*reinterpret_cast<const bool*>(data + stride*i));
+      }
+    }
+
+    template <typename T>
+    void
+    tojson_integers(ToJson& builder,
+                    const uint8_t* data,
+                    ssize_t stride,
+                    int64_t start,
+                    int64_t stop) {
+      for (int64_t i = start;  i < stop;  i++) {
+        builder.integer(*reinterpret_cast<const T*>(data + stride*i));
+      }
+    }
+
+    template <typename T>
+    void
+    tojson_reals(ToJson& builder,
+                 const uint8_t* data,
+                 ssize_t stride,
+                 int64_t start,
+                 int64_t stop) {
+      for (int64_t i = start;  i < stop;  i++) {
+        builder.real(*reinterpret_cast<const T*>(data + stride*i));
+      }
+    }
+
+    /// @brief The table of JSON writers for each util::dtype.
+    const tojson_fcn tojson_table[(size_t)util::dtype::size] = {
+      tojson_booleans,
+      tojson_integers<int8_t>,
+      tojson_integers<int16_t>,
+      tojson_integers<int32_t>,
+      tojson_integers<int64_t>,
+      tojson_integers<uint8_t>,
+      tojson_integers<uint16_t>,
+      tojson_integers<uint32_t>,
+      tojson_integers<uint64_t>,
+      tojson_reals<float>,
+      tojson_reals<double>
+    };
+  }
+
   ////////// NumpyForm
 
   NumpyForm::NumpyForm(bool has_identities,
@@ -35,7 +295,8 @@ namespace awkward {
       : Form(has_identities, parameters)
       , inner_shape_(inner_shape)
       , itemsize_(itemsize)
-      , format_(format) { }
+      , format_(format)
+      , dtype_(util::format_to_dtype(format, itemsize)) { }
 
   const std::vector<int64_t>
   NumpyForm::inner_shape() const {
@@ -52,152 +313,34 @@ namespace awkward {
     return format_;
   }
 
+  util::dtype
+  NumpyForm::dtype() const {
+    return dtype_;
+  }
+
   const std::string
   NumpyForm::primitive() const {
-    if (format_.compare("d") == 0) {
-      return "float64";
-    }
-    else if (format_.compare("f") == 0) {
-      return "float32";
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("q") == 0) {
-#else
-    else if (format_.compare("l") == 0) {
-#endif
-      return "int64";
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("Q") == 0) {
-#else
-    else if (format_.compare("L") == 0) {
-#endif
-      return "uint64";
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("l") == 0) {
-#else
-    else if (format_.compare("i") == 0) {
-#endif
-      return "int32";
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("L") == 0) {
-#else
-    else if (format_.compare("I") == 0) {
-#endif
-      return "uint32";
-    }
-    else if (format_.compare("h") == 0) {
-      return "int16";
-    }
-    else if (format_.compare("H") == 0) {
-      return "uint16";
-    }
-    else if (format_.compare("b") == 0) {
-      return "int8";
-    }
-    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-      return "uint8";
-    }
-    else if (format_.compare("?") == 0) {
-      return "bool";
-    }
-    else {
-      return "unknown";
-    }
+    return util::dtype_to_name(dtype_);
+  }
+
+  FormKind
+  NumpyForm::kind() const {
+    return FormKind::NumpyForm;
   }
 
   const TypePtr
   NumpyForm::type(const util::TypeStrs& typestrs) const {
-    TypePtr out;
-    if (format_.compare("d") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::float64);
-    }
-    else if (format_.compare("f") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::float32);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("q") == 0) {
-#else
-    else if (format_.compare("l") == 0) {
-#endif
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::int64);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("Q") == 0) {
-#else
-    else if (format_.compare("L") == 0) {
-#endif
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::uint64);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("l") == 0) {
-#else
-    else if (format_.compare("i") == 0) {
-#endif
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::int32);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("L") == 0) {
-#else
-    else if (format_.compare("I") == 0) {
-#endif
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::uint32);
-    }
-    else if (format_.compare("h") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::int16);
-    }
-    else if (format_.compare("H") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::uint16);
-    }
-    else if (format_.compare("b") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::int8);
-    }
-    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::uint8);
-    }
-    else if (format_.compare("?") == 0) {
-      out = std::make_shared<PrimitiveType>(
-                parameters_,
-                util::gettypestr(parameters_, typestrs),
-                PrimitiveType::boolean);
-    }
-    else {
+    if (dtype_ == util::dtype::NOT_PRIMITIVE) {
       throw std::invalid_argument(
         std::string("Numpy format \"") + format_
         + std::string("\" cannot be expressed as a PrimitiveType"));
     }
+    static_assert((int)util::dtype::float64 == (int)PrimitiveType::float64,
+                  "util::dtype and PrimitiveType::DType must agree");
+    TypePtr out = std::make_shared<PrimitiveType>(
+                      parameters_,
+                      util::gettypestr(parameters_, typestrs),
+                      (PrimitiveType::DType)dtype_);
     for (int64_t i = ((int64_t)inner_shape_.size()) - 1;  i >= 0;  i--) {
       out = std::make_shared<RegularType>(
                 util::Parameters(),
@@ -334,6 +477,16 @@ namespace awkward {
     return std::vector<std::string>();
   }
 
+  const FormPtr
+  NumpyForm::getitem_field(const std::string& key) const {
+    throw std::invalid_argument("cannot slice NumpyArray by field name");
+  }
+
+  const FormPtr
+  NumpyForm::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument("cannot slice NumpyArray by field names");
+  }
+
   bool
   NumpyForm::equal(const FormPtr& other,
                    bool check_identities,
@@ -347,7 +500,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (NumpyForm* t = dynamic_cast<NumpyForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::NumpyForm) {
+      NumpyForm* t = static_cast<NumpyForm*>(other.get());
       return (inner_shape_ == t->inner_shape()  &&
               itemsize_ == t->itemsize()  &&
               format_ == t->format());
@@ -361,17 +515,11 @@ namespace awkward {
 
   const std::unordered_map<std::type_index, std::string>
   NumpyArray::format_map = {
-    { typeid(int8_t), "b"},
-    { typeid(uint8_t), "B"},
-#if defined _MSC_VER || defined __i386__
-    { typeid(int32_t), "l"},
-    { typeid(uint32_t), "L"},
-    { typeid(int64_t), "q"}
-#else
-    { typeid(int32_t), "i"},
-    { typeid(uint32_t), "I"},
-    { typeid(int64_t), "l"}
-#endif
+    { typeid(int8_t), util::dtype_to_format(util::dtype::int8) },
+    { typeid(uint8_t), util::dtype_to_format(util::dtype::uint8) },
+    { typeid(int32_t), util::dtype_to_format(util::dtype::int32) },
+    { typeid(uint32_t), util::dtype_to_format(util::dtype::uint32) },
+    { typeid(int64_t), util::dtype_to_format(util::dtype::int64) }
  };
 
   NumpyArray::NumpyArray(const IdentitiesPtr& identities,
@@ -388,7 +536,8 @@ namespace awkward {
       , strides_(strides)
       , byteoffset_(byteoffset)
       , itemsize_(itemsize)
-      , format_(format) {
+      , format_(format)
+      , dtype_(util::format_to_dtype(format, (int64_t)itemsize)) {
     if (shape.size() != strides.size()) {
       throw std::invalid_argument(
         std::string("len(shape), which is ") + std::to_string(shape.size())
@@ -492,6 +641,11 @@ namespace awkward {
     return format_;
   }
 
+  util::dtype
+  NumpyArray::dtype() const {
+    return dtype_;
+  }
+
   ssize_t
   NumpyArray::ndim() const {
     return (ssize_t)shape_.size();
@@ -623,6 +777,11 @@ namespace awkward {
     return "NumpyArray";
   }
 
+  ContentKind
+  NumpyArray::kind() const {
+    return ContentKind::NumpyArray;
+  }
+
   void
   NumpyArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() != nullptr  &&
@@ -762,35 +921,27 @@ namespace awkward {
       out << "\" ";
     }
     out << "data=\"";
-#if defined _MSC_VER || defined __i386__
-    if (ndim() == 1  &&  format_.compare("l") == 0) {
-#else
-    if (ndim() == 1  &&  format_.compare("i") == 0) {
-#endif
+    if (ndim() == 1  &&  dtype_ == util::dtype::int32) {
       tostring_as<int32_t>(out,
                            reinterpret_cast<int32_t*>(byteptr()),
                            length());
     }
-#if defined _MSC_VER || defined __i386__
-    else if (ndim() == 1  &&  format_.compare("q") == 0) {
-#else
-    else if (ndim() == 1  &&  format_.compare("l") == 0) {
-#endif
+    else if (ndim() == 1  &&  dtype_ == util::dtype::int64) {
       tostring_as<int64_t>(out,
                            reinterpret_cast<int64_t*>(byteptr()),
                            length());
     }
-    else if (ndim() == 1  &&  format_.compare("f") == 0) {
+    else if (ndim() == 1  &&  dtype_ == util::dtype::float32) {
       tostring_as<float>(out,
                          reinterpret_cast<float*>(byteptr()),
                          length());
     }
-    else if (ndim() == 1  &&  format_.compare("d") == 0) {
+    else if (ndim() == 1  &&  dtype_ == util::dtype::float64) {
       tostring_as<double>(out,
                           reinterpret_cast<double*>(byteptr()),
                           length());
     }
-    else if (ndim() == 1  &&  format_.compare("?") == 0) {
+    else if (ndim() == 1  &&  dtype_ == util::dtype::boolean) {
       tostring_as<bool>(out,
                         reinterpret_cast<bool*>(byteptr()),
                         length());
@@ -855,59 +1006,111 @@ namespace awkward {
     else if (parameter_equals("__array__", "\"char\"")) {
       tojson_string(builder, include_beginendlist);
     }
-    else if (format_.compare("d") == 0) {
-      tojson_real<double>(builder, include_beginendlist);
-    }
-    else if (format_.compare("f") == 0) {
-      tojson_real<float>(builder, include_beginendlist);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("q") == 0) {
-#else
-    else if (format_.compare("l") == 0) {
-#endif
-      tojson_integer<int64_t>(builder, include_beginendlist);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("Q") == 0) {
-#else
-    else if (format_.compare("L") == 0) {
-#endif
-      tojson_integer<uint64_t>(builder, include_beginendlist);
-    }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("l") == 0) {
-#else
-      else if (format_.compare("i") == 0) {
-#endif
-      tojson_integer<int32_t>(builder, include_beginendlist);
-    }
-#if defined _MSC_VER || defined __i386__
-    else if (format_.compare("L") == 0) {
-#else
-    else if (format_.compare("I") == 0) {
-#endif
-      tojson_integer<uint32_t>(builder, include_beginendlist);
-    }
-    else if (format_.compare("h") == 0) {
-      tojson_integer<int16_t>(builder, include_beginendlist);
+    else {
+      switch (dtype_) {
+        case util::dtype::boolean:
+          tojson_boolean(builder, include_beginendlist);
+          break;
+        case util::dtype::int8:
+          tojson_integer<int8_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::int16:
+          tojson_integer<int16_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::int32:
+          tojson_integer<int32_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::int64:
+          tojson_integer<int64_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::uint8:
+          tojson_integer<uint8_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::uint16:
+          tojson_integer<uint16_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::uint32:
+          tojson_integer<uint32_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::uint64:
+          tojson_integer<uint64_t>(builder, include_beginendlist);
+          break;
+        case util::dtype::float32:
+          tojson_real<float>(builder, include_beginendlist);
+          break;
+        case util::dtype::float64:
+          tojson_real<double>(builder, include_beginendlist);
+          break;
+        default:
+          throw std::invalid_argument(
+            std::string("cannot convert Numpy format \"") + format_
+            + std::string("\" into JSON"));
+      }
     }
-    else if (format_.compare("H") == 0) {
-      tojson_integer<uint16_t>(builder, include_beginendlist);
+  }
+
+  void
+  NumpyArray::tojson_elements(ToJson& builder,
+                              int64_t start,
+                              int64_t stop) const {
+    bool isstring = (parameter_equals("__array__", "\"byte\"")  ||
+                     parameter_equals("__array__", "\"char\""));
+    if (ndim() == 1  &&  isstring) {
+      const char* data = reinterpret_cast<const char*>(byteptr());
+      for (int64_t i = start;  i < stop;  i++) {
+        builder.string(data + strides_[0]*i, 1);
+      }
+    }
+    else if (ndim() == 1  &&  dtype_ != util::dtype::NOT_PRIMITIVE) {
+      tojson_table[(size_t)dtype_](
+        builder,
+        reinterpret_cast<const uint8_t*>(byteptr()),
+        strides_[0],
+        start,
+        stop);
     }
-    else if (format_.compare("b") == 0) {
-      tojson_integer<int8_t>(builder, include_beginendlist);
+    else if (ndim() == 1) {
+      throw std::invalid_argument(
+        std::string("cannot convert Numpy format \"") + format_
+        + std::string("\" into JSON"));
     }
-    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-      tojson_integer<uint8_t>(builder, include_beginendlist);
+    else {
+      const std::vector<ssize_t> shape(shape_.begin() + 1, shape_.end());
+      const std::vector<ssize_t> strides(strides_.begin() + 1, strides_.end());
+      for (int64_t i = start;  i < stop;  i++) {
+        NumpyArray numpy(Identities::none(),
+                         parameters_,
+                         ptr_,
+                         shape,
+                         strides,
+                         byteoffset_ + strides_[0]*((ssize_t)i),
+                         itemsize_,
+                         format_);
+        numpy.tojson_part(builder, true);
+      }
     }
-    else if (format_.compare("?") == 0) {
-      tojson_boolean(builder, include_beginendlist);
+  }
+
+  void
+  NumpyArray::tojson_sublist(ToJson& builder,
+                             int64_t start,
+                             int64_t stop) const {
+    if (ndim() == 1  &&  (parameter_equals("__array__", "\"byte\"")  ||
+                          parameter_equals("__array__", "\"char\""))) {
+      const char* data = reinterpret_cast<const char*>(byteptr());
+      if (strides_[0] == 1) {
+        builder.string(data + start, stop - start);
+      }
+      else {
+        std::string gathered((size_t)(stop - start), '\0');
+        for (int64_t i = start;  i < stop;  i++) {
+          gathered[(size_t)(i - start)] = data[strides_[0]*i];
+        }
+        builder.string(gathered.data(), stop - start);
+      }
     }
     else {
-      throw std::invalid_argument(
-        std::string("cannot convert Numpy format \"") + format_
-        + std::string("\" into JSON"));
+      Content::tojson_sublist(builder, start, stop);
     }
   }
 
@@ -957,7 +1160,16 @@ namespace awkward {
     std::vector<ssize_t> shape = shape_;
     std::vector<ssize_t> strides = strides_;
     ssize_t byteoffset = byteoffset_;
-    if (copyarrays) {
+    if (copyarrays  &&  iscontiguous()) {
+      // contiguous() would return the same buffer, not a copy of it.
+      ssize_t bytes = bytelength();
+      ptr = util::allocate<uint8_t>(bytes);
+      if (bytes != 0) {
+        memcpy(ptr.get(), byteptr(), (size_t)bytes);
+      }
+      byteoffset = 0;
+    }
+    else if (copyarrays) {
       NumpyArray tmp = contiguous();
       ptr = tmp.ptr();
       shape = tmp.shape();
@@ -978,6 +1190,11 @@ namespace awkward {
                                         format_);
   }
 
+  const ContentPtr
+  NumpyArray::pack() const {
+    return deep_copy(true, false, false);
+  }
+
   void
   NumpyArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -1100,8 +1317,8 @@ namespace awkward {
     if (head.get() == nullptr) {
       return false;
     }
-    else if (dynamic_cast<SliceMissing64*>(head.get())  ||
-             dynamic_cast<SliceJagged64*>(head.get())) {
+    else if (head.get()->kind() == SliceKind::missing64  ||
+             head.get()->kind() == SliceKind::jagged64) {
       return true;
     }
     else {
@@ -1220,9 +1437,8 @@ namespace awkward {
 
   const ContentPtr
   NumpyArray::carry(const Index64& carry) const {
-    std::shared_ptr<void> ptr(
-      new uint8_t[(size_t)(carry.length()*strides_[0])],
-      util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr =
+      util::allocate<uint8_t>(carry.length()*strides_[0]);
     struct Error err = awkward_numpyarray_getitem_next_null_64(
       reinterpret_cast<uint8_t*>(ptr.get()),
       reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -1426,7 +1642,8 @@ namespace awkward {
 
   bool
   NumpyArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -1434,90 +1651,44 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+        return mergeable(option_content(other), mergebool);
+      default:
+        break;
     }
 
     if (ndim() == 0) {
       return false;
     }
 
-    if (NumpyArray* rawother = dynamic_cast<NumpyArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::NumpyArray) {
+      NumpyArray* rawother = static_cast<NumpyArray*>(other.get());
       if (ndim() != rawother->ndim()) {
         return false;
       }
 
-      std::string other_format = rawother->format();
+      util::dtype other_dtype = rawother->dtype();
 
       if (!mergebool  &&
-          ((format_.compare("?") == 0  &&  other_format.compare("?") != 0)  ||
-           (format_.compare("?") != 0  &&  other_format.compare("?") == 0))) {
+          ((dtype_ == util::dtype::boolean)  !=
+           (other_dtype == util::dtype::boolean))) {
         return false;
       }
 
-      if (!(format_.compare("d") == 0  ||
-            format_.compare("f") == 0  ||
-            format_.compare("q") == 0  ||
-            format_.compare("Q") == 0  ||
-            format_.compare("l") == 0  ||
-            format_.compare("L") == 0  ||
-            format_.compare("i") == 0  ||
-            format_.compare("I") == 0  ||
-            format_.compare("h") == 0  ||
-            format_.compare("H") == 0  ||
-            format_.compare("b") == 0  ||
-            format_.compare("B") == 0  ||
-            format_.compare("c") == 0  ||
-            format_.compare("?") == 0  ||
-            other_format.compare("d") == 0  ||
-            other_format.compare("f") == 0  ||
-            other_format.compare("q") == 0  ||
-            other_format.compare("Q") == 0  ||
-            other_format.compare("l") == 0  ||
-            other_format.compare("L") == 0  ||
-            other_format.compare("i") == 0  ||
-            other_format.compare("I") == 0  ||
-            other_format.compare("h") == 0  ||
-            other_format.compare("H") == 0  ||
-            other_format.compare("b") == 0  ||
-            other_format.compare("B") == 0  ||
-            other_format.compare("c") == 0  ||
-            other_format.compare("?") == 0)) {
+      if (merged_dtype(dtype_, other_dtype) == util::dtype::NOT_PRIMITIVE) {
         return false;
       }
 
@@ -1537,7 +1708,8 @@ namespace awkward {
 
   const ContentPtr
   NumpyArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -1545,52 +1717,23 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
     }
 
     if (ndim() == 0) {
@@ -1611,71 +1754,23 @@ namespace awkward {
     }
 
     NumpyArray contiguous_self = contiguous();
-    if (NumpyArray* rawother = dynamic_cast<NumpyArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::NumpyArray) {
+      NumpyArray* rawother = static_cast<NumpyArray*>(other.get());
       if (ndim() != rawother->ndim()) {
         throw std::invalid_argument(
           "cannot merge arrays with different shapes");
       }
 
-      std::string other_format = rawother->format();
-
-      ssize_t itemsize;
-      std::string format;
-      if (format_.compare("d") == 0  ||
-          format_.compare("f") == 0  ||
-          other_format.compare("d") == 0  ||
-          other_format.compare("f") == 0) {
-        itemsize = 8;
-        format = "d";
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("Q") == 0  &&  other_format.compare("Q") == 0) {
-        itemsize = 8;
-        format = "Q";
-#else
-      else if (format_.compare("L") == 0  &&  other_format.compare("L") == 0) {
-        itemsize = 8;
-        format = "L";
-#endif
-      }
-      else if (format_.compare("q") == 0  ||
-               format_.compare("Q") == 0  ||
-               format_.compare("l") == 0  ||
-               format_.compare("L") == 0  ||
-               format_.compare("i") == 0  ||
-               format_.compare("I") == 0  ||
-               format_.compare("h") == 0  ||
-               format_.compare("H") == 0  ||
-               format_.compare("b") == 0  ||
-               format_.compare("B") == 0  ||
-               format_.compare("c") == 0  ||
-               other_format.compare("q") == 0  ||
-               other_format.compare("Q") == 0  ||
-               other_format.compare("l") == 0  ||
-               other_format.compare("L") == 0  ||
-               other_format.compare("i") == 0  ||
-               other_format.compare("I") == 0  ||
-               other_format.compare("h") == 0  ||
-               other_format.compare("H") == 0  ||
-               other_format.compare("b") == 0  ||
-               other_format.compare("B") == 0  ||
-               other_format.compare("c") == 0) {
-        itemsize = 8;
-#if defined _MSC_VER || defined __i386__
-        format = "q";
-#else
-        format = "l";
-#endif
-      }
-      else if (format_.compare("?") == 0  &&  other_format.compare("?") == 0) {
-        itemsize = 1;
-        format = "?";
-      }
-      else {
+      util::dtype other_dtype = rawother->dtype();
+      util::dtype dtype = merged_dtype(dtype_, other_dtype);
+      if (dtype == util::dtype::NOT_PRIMITIVE) {
         throw std::invalid_argument(
           std::string("cannot merge Numpy format \"") + format_
-          + std::string("\" with \"") + other_format + std::string("\""));
+          + std::string("\" with \"") + rawother->format()
+          + std::string("\""));
       }
+      ssize_t itemsize = (ssize_t)util::dtype_to_itemsize(dtype);
+      const fill_fcn* fills = fill_kernels(dtype);
 
       std::vector<ssize_t> other_shape = rawother->shape();
       std::vector<ssize_t> shape;
@@ -1695,9 +1790,8 @@ namespace awkward {
         other_flatlength *= (int64_t)shape_[(size_t)i];
       }
 
-      std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(itemsize*(self_flatlength + other_flatlength))],
-        util::array_deleter<uint8_t>());
+      std::shared_ptr<void> ptr =
+        util::allocate<uint8_t>(itemsize*(self_flatlength + other_flatlength));
 
       NumpyArray contiguous_other = rawother->contiguous();
 
@@ -1706,458 +1800,20 @@ namespace awkward {
       int64_t other_offset = (contiguous_other.byteoffset() /
                               contiguous_other.itemsize());
 
-      struct Error err;
-      if (format.compare("d") == 0) {
-        if (format_.compare("d") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromdouble(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<double*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("f") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromfloat(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<float*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-        else if (format_.compare("q") == 0) {
-#else
-        else if (format_.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("Q") == 0) {
-#else
-          else if (format_.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("l") == 0) {
-#else
-          else if (format_.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("L") == 0) {
-#else
-          else if (format_.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("h") == 0) {
-          err = awkward_numpyarray_fill_todouble_from16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("H") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("b") == 0) {
-          err = awkward_numpyarray_fill_todouble_from8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("?") == 0) {
-          err = awkward_numpyarray_fill_todouble_frombool(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-
-        if (other_format.compare("d") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromdouble(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<double*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("f") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromfloat(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<float*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-        else if (other_format.compare("q") == 0) {
-#else
-        else if (other_format.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("Q") == 0) {
-#else
-          else if (other_format.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("l") == 0) {
-#else
-          else if (other_format.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("L") == 0) {
-#else
-          else if (other_format.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("h") == 0) {
-          err = awkward_numpyarray_fill_todouble_from16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("H") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("b") == 0) {
-          err = awkward_numpyarray_fill_todouble_from8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("B") == 0  ||
-                 format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("?") == 0) {
-          err = awkward_numpyarray_fill_todouble_frombool(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else if (format.compare("Q") == 0  ||  format.compare("L") == 0) {
-        err = awkward_numpyarray_fill_toU64_fromU64(
-                reinterpret_cast<uint64_t*>(ptr.get()),
-                0,
-                reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                self_offset,
-                self_flatlength);
-        util::handle_error(err, classname(), nullptr);
-        err = awkward_numpyarray_fill_toU64_fromU64(
-                reinterpret_cast<uint64_t*>(ptr.get()),
-                self_flatlength,
-                reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                other_offset,
-                other_flatlength);
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else if (itemsize == 8) {
-#if defined _MSC_VER || defined __i386__
-        if (format_.compare("q") == 0) {
-#else
-        if (format_.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("Q") == 0) {
-#else
-          else if (format_.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("l") == 0) {
-#else
-          else if (format_.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("L") == 0) {
-#else
-          else if (format_.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("h") == 0) {
-          err = awkward_numpyarray_fill_to64_from16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("H") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("b") == 0) {
-          err = awkward_numpyarray_fill_to64_from8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("?") == 0) {
-          err = awkward_numpyarray_fill_to64_frombool(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-
-#if defined _MSC_VER || defined __i386__
-        if (other_format.compare("q") == 0) {
-#else
-        if (other_format.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("Q") == 0) {
-#else
-          else if (other_format.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("l") == 0) {
-#else
-          else if (other_format.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("L") == 0) {
-#else
-          else if (other_format.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("h") == 0) {
-          err = awkward_numpyarray_fill_to64_from16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("H") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("b") == 0) {
-          err = awkward_numpyarray_fill_to64_from8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("B") == 0  ||
-                 format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("?") == 0) {
-          err = awkward_numpyarray_fill_to64_frombool(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else {
-        err = awkward_numpyarray_fill_tobool_frombool(
-                reinterpret_cast<bool*>(ptr.get()),
-                0,
-                reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                self_offset,
-                self_flatlength);
-        util::handle_error(err, classname(), nullptr);
-        err = awkward_numpyarray_fill_tobool_frombool(
-                reinterpret_cast<bool*>(ptr.get()),
-                self_flatlength,
-                reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                other_offset,
-                other_flatlength);
-        util::handle_error(err, classname(), nullptr);
-      }
+      struct Error err = fills[(size_t)dtype_](
+        ptr.get(),
+        0,
+        contiguous_self.ptr().get(),
+        self_offset,
+        self_flatlength);
+      util::handle_error(err, classname(), nullptr);
+      err = fills[(size_t)other_dtype](
+        ptr.get(),
+        self_flatlength,
+        contiguous_other.ptr().get(),
+        other_offset,
+        other_flatlength);
+      util::handle_error(err, classname(), nullptr);
 
       return std::make_shared<NumpyArray>(Identities::none(),
                                           parameters_,
@@ -2166,7 +1822,7 @@ namespace awkward {
                                           strides,
                                           0,
                                           itemsize,
-                                          format);
+                                          util::dtype_to_format(dtype));
     }
 
     else {
@@ -2176,14 +1832,94 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  NumpyArray::merge_many(const ContentPtrVec& others, bool mergebool) const {
+    ContentPtrVec inputs({ shallow_copy() });
+    inputs.insert(inputs.end(), others.begin(), others.end());
+    if (ndim() == 0  ||  !all_mergeable(inputs, mergebool)  ||
+        parameter_equals("__array__", "\"byte\"")  ||
+        parameter_equals("__array__", "\"char\"")) {
+      return Content::merge_many(others, mergebool);
+    }
+
+    // Anything that isn't a NumpyArray with the same parameters and inner
+    // shape takes the general path, which also reports errors.
+    std::vector<NumpyArray> arrays({ contiguous() });
+    util::dtype dtype = dtype_;
+    for (auto& other : others) {
+      if (!parameters_equal(other.get()->parameters())) {
+        return Content::merge_many(others, mergebool);
+      }
+      if (other.get()->kind() == ContentKind::EmptyArray) {
+        continue;
+      }
+      if (other.get()->kind() != ContentKind::NumpyArray) {
+        return Content::merge_many(others, mergebool);
+      }
+      NumpyArray* rawother = static_cast<NumpyArray*>(other.get());
+      if (rawother->ndim() != ndim()  ||
+          !std::equal(shape_.begin() + 1,
+                      shape_.end(),
+                      rawother->shape().begin() + 1)) {
+        return Content::merge_many(others, mergebool);
+      }
+      dtype = merged_dtype(dtype, rawother->dtype());
+      if (dtype == util::dtype::NOT_PRIMITIVE) {
+        return Content::merge_many(others, mergebool);
+      }
+      arrays.push_back(rawother->contiguous());
+    }
+
+    ssize_t itemsize = (ssize_t)util::dtype_to_itemsize(dtype);
+    const fill_fcn* fills = fill_kernels(dtype);
+
+    int64_t inner = 1;
+    std::vector<ssize_t> shape({ 0 });
+    std::vector<ssize_t> strides({ itemsize });
+    for (int64_t i = ((int64_t)shape_.size()) - 1;  i > 0;  i--) {
+      shape.insert(shape.begin() + 1, shape_[(size_t)i]);
+      strides.insert(strides.begin(), strides[0]*shape_[(size_t)i]);
+      inner *= (int64_t)shape_[(size_t)i];
+    }
+    std::vector<int64_t> starts;
+    int64_t total = 0;
+    for (auto& array : arrays) {
+      starts.push_back(total);
+      shape[0] += array.shape()[0];
+      total += (int64_t)array.shape()[0]*inner;
+    }
+
+    std::shared_ptr<void> ptr = util::allocate<uint8_t>(itemsize*total);
+
+    // The fill kernels split large inputs among the cpu-kernels' threads
+    // (see AWKWARD_NUM_THREADS), so the inputs are filled one at a time.
+    for (size_t i = 0;  i < arrays.size();  i++) {
+      struct Error err = fills[(size_t)arrays[i].dtype()](
+        ptr.get(),
+        starts[i],
+        arrays[i].ptr().get(),
+        arrays[i].byteoffset() / arrays[i].itemsize(),
+        (int64_t)arrays[i].shape()[0]*inner);
+      util::handle_error(err, classname(), nullptr);
+    }
+
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        parameters_,
+                                        ptr,
+                                        shape,
+                                        strides,
+                                        0,
+                                        itemsize,
+                                        util::dtype_to_format(dtype));
+  }
+
   const ContentPtr
   NumpyArray::merge_bytes(const std::shared_ptr<NumpyArray>& other) const {
     NumpyArray contiguous_self = contiguous();
     NumpyArray contiguous_other = other.get()->contiguous();
 
-    std::shared_ptr<void> ptr(
-      new uint8_t[(size_t)(length() + other.get()->length())],
-      util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr =
+      util::allocate<uint8_t>(length() + other.get()->length());
 
     struct Error err;
 
@@ -2223,11 +1959,7 @@ namespace awkward {
         "slice rules) or they can have all var-sized dimensions (for jagged "
         "indexing), but not both in the same slice item");
     }
-#if defined _MSC_VER || defined __i386__
-    if (format_.compare("q") == 0) {
-#else
-    if (format_.compare("l") == 0) {
-#endif
+    if (dtype_ == util::dtype::int64) {
       int64_t* raw = reinterpret_cast<int64_t*>(ptr_.get());
       std::shared_ptr<int64_t> ptr(ptr_, raw);
       std::vector<int64_t> shape({ (int64_t)shape_[0] });
@@ -2239,100 +1971,24 @@ namespace awkward {
         strides,
         false);
     }
-    else if (format_.compare("q") == 0  ||
-             format_.compare("Q") == 0  ||
-             format_.compare("l") == 0  ||
-             format_.compare("L") == 0  ||
-             format_.compare("i") == 0  ||
-             format_.compare("I") == 0  ||
-             format_.compare("h") == 0  ||
-             format_.compare("H") == 0  ||
-             format_.compare("b") == 0  ||
-             format_.compare("B") == 0  ||
-             format_.compare("c") == 0) {
+    else if (util::is_integer(dtype_)) {
       NumpyArray contiguous_self = contiguous();
       int64_t offset = ((int64_t)contiguous_self.byteoffset() /
                         (int64_t)itemsize_);
       Index64 index(length());
-      struct Error err;
-#if defined _MSC_VER || defined __i386__
-      if (format_.compare("Q") == 0) {
-#else
-      if (format_.compare("L") == 0) {
-#endif
-        err = awkward_numpyarray_fill_to64_fromU64(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("l") == 0) {
-#else
-      else if (format_.compare("i") == 0) {
-#endif
-        err = awkward_numpyarray_fill_to64_from32(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("L") == 0) {
-#else
-      else if (format_.compare("I") == 0) {
-#endif
-        err = awkward_numpyarray_fill_to64_fromU32(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("h") == 0) {
-        err = awkward_numpyarray_fill_to64_from16(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("H") == 0) {
-        err = awkward_numpyarray_fill_to64_fromU16(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("b") == 0) {
-        err = awkward_numpyarray_fill_to64_from8(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-        err = awkward_numpyarray_fill_to64_fromU8(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else {
-        throw std::runtime_error("oops: check format_.compare cases above");
-      }
+      struct Error err = fill_to64[(size_t)dtype_](
+        index.ptr().get(),
+        0,
+        contiguous_self.ptr().get(),
+        offset,
+        length());
       util::handle_error(err, classname(), identities_.get());
 
       std::vector<int64_t> shape({ (int64_t)shape_[0] });
       std::vector<int64_t> strides({ 1 });
       return std::make_shared<SliceArray64>(index, shape, strides, false);
     }
-    else if (format_.compare("?") == 0) {
+    else if (dtype_ == util::dtype::boolean) {
       int64_t numtrue;
       struct Error err1 = awkward_numpyarray_getitem_boolean_numtrue(
         &numtrue,
@@ -2424,108 +2080,22 @@ namespace awkward {
                                                  keepdims);
     }
     else {
-      std::shared_ptr<void> ptr;
-      if (format_.compare("?") == 0) {
-        ptr = reducer.apply_bool(reinterpret_cast<bool*>(ptr_.get()),
-                                 byteoffset_ / itemsize_,
-                                 starts,
-                                 parents,
-                                 outlength);
-      }
-      else if (format_.compare("b") == 0) {
-        ptr = reducer.apply_int8(reinterpret_cast<int8_t*>(ptr_.get()),
-                                 byteoffset_ / itemsize_,
-                                 starts,
-                                 parents,
-                                 outlength);
-      }
-      else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-        ptr = reducer.apply_uint8(reinterpret_cast<uint8_t*>(ptr_.get()),
-                                  byteoffset_ / itemsize_,
-                                  starts,
-                                  parents,
-                                  outlength);
-      }
-      else if (format_.compare("h") == 0) {
-        ptr = reducer.apply_int16(reinterpret_cast<int16_t*>(ptr_.get()),
-                                  byteoffset_ / itemsize_,
-                                  starts,
-                                  parents,
-                                  outlength);
-      }
-      else if (format_.compare("H") == 0) {
-        ptr = reducer.apply_uint16(reinterpret_cast<uint16_t*>(ptr_.get()),
-                                   byteoffset_ / itemsize_,
-                                   starts,
-                                   parents,
-                                   outlength);
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("l") == 0) {
-#else
-      else if (format_.compare("i") == 0) {
-#endif
-        ptr = reducer.apply_int32(reinterpret_cast<int32_t*>(ptr_.get()),
-                                  byteoffset_ / itemsize_,
-                                  starts,
-                                  parents,
-                                  outlength);
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("L") == 0) {
-#else
-      else if (format_.compare("I") == 0) {
-#endif
-        ptr = reducer.apply_uint32(reinterpret_cast<uint32_t*>(ptr_.get()),
-                                   byteoffset_ / itemsize_,
-                                   starts,
-                                   parents,
-                                   outlength);
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("q") == 0) {
-#else
-      else if (format_.compare("l") == 0) {
-#endif
-        ptr = reducer.apply_int64(reinterpret_cast<int64_t*>(ptr_.get()),
-                                  byteoffset_ / itemsize_,
-                                  starts,
-                                  parents,
-                                  outlength);
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("Q") == 0) {
-#else
-      else if (format_.compare("L") == 0) {
-#endif
-        ptr = reducer.apply_uint64(reinterpret_cast<uint64_t*>(ptr_.get()),
-                                   byteoffset_ / itemsize_,
-                                   starts,
-                                   parents,
-                                   outlength);
-      }
-      else if (format_.compare("f") == 0) {
-        ptr = reducer.apply_float32(reinterpret_cast<float*>(ptr_.get()),
-                                    byteoffset_ / itemsize_,
-                                    starts,
-                                    parents,
-                                    outlength);
-      }
-      else if (format_.compare("d") == 0) {
-        ptr = reducer.apply_float64(reinterpret_cast<double*>(ptr_.get()),
-                                    byteoffset_ / itemsize_,
-                                    starts,
-                                    parents,
-                                    outlength);
-      }
-      else {
+      if (dtype_ == util::dtype::NOT_PRIMITIVE) {
         throw std::invalid_argument(
           std::string("cannot apply reducers to NumpyArray with format \"")
           + format_ + std::string("\""));
       }
-
-      std::string format = reducer.return_type(format_);
-      ssize_t itemsize = reducer.return_typesize(format_);
+      std::shared_ptr<void> ptr = reduce_parents[(size_t)dtype_](
+        reducer,
+        ptr_.get(),
+        byteoffset_ / itemsize_,
+        starts,
+        parents,
+        outlength);
+
+      util::dtype dtype = reducer.return_dtype(dtype_);
+      std::string format = util::dtype_to_format(dtype);
+      ssize_t itemsize = (ssize_t)util::dtype_to_itemsize(dtype);
       std::vector<ssize_t> shape({ (ssize_t)outlength });
       std::vector<ssize_t> strides({ itemsize });
       ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
@@ -2564,6 +2134,85 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  const ContentPtr
+  NumpyArray::reduce_segments(const Reducer& reducer,
+                              const IndexOf<T>& offsets,
+                              bool mask,
+                              bool keepdims) const {
+    if (shape_.size() != 1  ||  !iscontiguous()) {
+      throw std::invalid_argument(
+        "NumpyArray::reduce_segments requires a one-dimensional, "
+        "contiguous array");
+    }
+    int64_t outlength = offsets.length() - 1;
+    if (dtype_ == util::dtype::NOT_PRIMITIVE) {
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to NumpyArray with format \"")
+        + format_ + std::string("\""));
+    }
+    std::shared_ptr<void> ptr = reduce_offsets<T>()[(size_t)dtype_](
+      reducer,
+      ptr_.get(),
+      byteoffset_ / itemsize_,
+      offsets);
+
+    util::dtype dtype = reducer.return_dtype(dtype_);
+    std::string format = util::dtype_to_format(dtype);
+    ssize_t itemsize = (ssize_t)util::dtype_to_itemsize(dtype);
+    std::vector<ssize_t> shape({ (ssize_t)outlength });
+    std::vector<ssize_t> strides({ itemsize });
+    ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
+                                                  util::Parameters(),
+                                                  ptr,
+                                                  shape,
+                                                  strides,
+                                                  0,
+                                                  itemsize,
+                                                  format);
+
+    if (mask) {
+      Index8 mask(outlength);
+      struct Error err =
+        util::awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64<T>(
+        mask.ptr().get(),
+        offsets.ptr().get(),
+        offsets.offset(),
+        outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              mask,
+                                              out,
+                                              false);
+    }
+
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1);
+    }
+
+    return out;
+  }
+
+  template const ContentPtr
+  NumpyArray::reduce_segments<int32_t>(const Reducer& reducer,
+                                       const Index32& offsets,
+                                       bool mask,
+                                       bool keepdims) const;
+  template const ContentPtr
+  NumpyArray::reduce_segments<uint32_t>(const Reducer& reducer,
+                                        const IndexU32& offsets,
+                                        bool mask,
+                                        bool keepdims) const;
+  template const ContentPtr
+  NumpyArray::reduce_segments<int64_t>(const Reducer& reducer,
+                                       const Index64& offsets,
+                                       bool mask,
+                                       bool keepdims) const;
+
   const ContentPtr
   NumpyArray::localindex(int64_t axis, int64_t depth) const {
     int64_t toaxis = axis_wrap_if_negative(axis);
@@ -2756,9 +2405,8 @@ namespace awkward {
   const NumpyArray
   NumpyArray::contiguous_next(const Index64& bytepos) const {
     if (iscontiguous()) {
-      std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(bytepos.length()*strides_[0])],
-        util::array_deleter<uint8_t>());
+      std::shared_ptr<void> ptr =
+        util::allocate<uint8_t>(bytepos.length()*strides_[0]);
       struct Error err = awkward_numpyarray_contiguous_copy_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -2778,9 +2426,8 @@ namespace awkward {
     }
 
     else if (shape_.size() == 1) {
-      std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(bytepos.length()*itemsize_)],
-        util::array_deleter<uint8_t>());
+      std::shared_ptr<void> ptr =
+        util::allocate<uint8_t>(bytepos.length()*itemsize_);
       struct Error err = awkward_numpyarray_contiguous_copy_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -2849,25 +2496,26 @@ namespace awkward {
                         itemsize_,
                         format_);
     }
-    else if (SliceAt* at =
-             dynamic_cast<SliceAt*>(head.get())) {
-      return getitem_bystrides(*at, tail, length);
-    }
-    else if (SliceRange* range =
-             dynamic_cast<SliceRange*>(head.get())) {
-      return getitem_bystrides(*range, tail, length);
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return getitem_bystrides(*ellipsis, tail, length);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return getitem_bystrides(*newaxis, tail, length);
-    }
-    else {
-      throw std::runtime_error(
-        "unrecognized slice item type for NumpyArray::getitem_bystrides");
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+        return getitem_bystrides(*static_cast<SliceAt*>(head.get()),
+                                 tail,
+                                 length);
+      case SliceKind::range:
+        return getitem_bystrides(*static_cast<SliceRange*>(head.get()),
+                                 tail,
+                                 length);
+      case SliceKind::ellipsis:
+        return getitem_bystrides(*static_cast<SliceEllipsis*>(head.get()),
+                                 tail,
+                                 length);
+      case SliceKind::newaxis:
+        return getitem_bystrides(*static_cast<SliceNewAxis*>(head.get()),
+                                 tail,
+                                 length);
+      default:
+        throw std::runtime_error(
+          "unrecognized slice item type for NumpyArray::getitem_bystrides");
     }
   }
 
@@ -3035,8 +2683,8 @@ namespace awkward {
                            int64_t stride,
                            bool first) const {
     if (head.get() == nullptr) {
-      std::shared_ptr<void> ptr(new uint8_t[(size_t)(carry.length()*stride)],
-                                util::array_deleter<uint8_t>());
+      std::shared_ptr<void> ptr =
+        util::allocate<uint8_t>(carry.length()*stride);
       struct Error err = awkward_numpyarray_getitem_next_null_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -3065,80 +2713,63 @@ namespace awkward {
                         format_);
     }
 
-    else if (SliceAt* at =
-             dynamic_cast<SliceAt*>(head.get())) {
-      return getitem_next(*at,
-                          tail,
-                          carry,
-                          advanced,
-                          length,
-                          stride,
-                          first);
-    }
-    else if (SliceRange* range =
-             dynamic_cast<SliceRange*>(head.get())) {
-      return getitem_next(*range,
-                          tail,
-                          carry,
-                          advanced,
-                          length,
-                          stride,
-                          first);
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return getitem_next(*ellipsis,
-                          tail,
-                          carry,
-                          advanced,
-                          length,
-                          stride,
-                          first);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return getitem_next(*newaxis,
-                          tail,
-                          carry,
-                          advanced,
-                          length,
-                          stride,
-                          first);
-    }
-    else if (SliceArray64* array =
-             dynamic_cast<SliceArray64*>(head.get())) {
-      return getitem_next(*array,
-                          tail,
-                          carry,
-                          advanced,
-                          length,
-                          stride,
-                          first);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      throw std::invalid_argument(
-        std::string("cannot slice ") + classname()
-        + std::string(" by a field name because it has no fields"));
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      throw std::invalid_argument(
-        std::string("cannot slice ") + classname()
-        + std::string(" by field names because it has no fields"));
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      throw std::runtime_error(
-        "undefined operation: NumpyArray::getitem_next(missing) "
-        "(defer to Content::getitem_next(missing))");
-    }
-    else if (SliceJagged64* jagged =
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      throw std::runtime_error("FIXME: NumpyArray::getitem_next(jagged)");
-    }
-    else {
-      throw std::runtime_error("unrecognized slice item type");
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+        return getitem_next(*static_cast<SliceAt*>(head.get()),
+                            tail,
+                            carry,
+                            advanced,
+                            length,
+                            stride,
+                            first);
+      case SliceKind::range:
+        return getitem_next(*static_cast<SliceRange*>(head.get()),
+                            tail,
+                            carry,
+                            advanced,
+                            length,
+                            stride,
+                            first);
+      case SliceKind::ellipsis:
+        return getitem_next(*static_cast<SliceEllipsis*>(head.get()),
+                            tail,
+                            carry,
+                            advanced,
+                            length,
+                            stride,
+                            first);
+      case SliceKind::newaxis:
+        return getitem_next(*static_cast<SliceNewAxis*>(head.get()),
+                            tail,
+                            carry,
+                            advanced,
+                            length,
+                            stride,
+                            first);
+      case SliceKind::array64:
+        return getitem_next(*static_cast<SliceArray64*>(head.get()),
+                            tail,
+                            carry,
+                            advanced,
+                            length,
+                            stride,
+                            first);
+      case SliceKind::field:
+        throw std::invalid_argument(
+          std::string("cannot slice ") + classname()
+          + std::string(" by a field name because it has no fields"));
+      case SliceKind::fields:
+        throw std::invalid_argument(
+          std::string("cannot slice ") + classname()
+          + std::string(" by field names because it has no fields"));
+      case SliceKind::missing64:
+        throw std::runtime_error(
+          "undefined operation: NumpyArray::getitem_next(missing) "
+          "(defer to Content::getitem_next(missing))");
+      case SliceKind::jagged64:
+        throw std::runtime_error("FIXME: NumpyArray::getitem_next(jagged)");
+      default:
+        throw std::runtime_error("unrecognized slice item type");
     }
   }
 
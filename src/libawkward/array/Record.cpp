@@ -60,6 +60,11 @@ namespace awkward {
     return "Record";
   }
 
+  ContentKind
+  Record::kind() const {
+    return ContentKind::Record;
+  }
+
   const IdentitiesPtr
   Record::identities() const {
     IdentitiesPtr recidentities = array_.get()->identities();
@@ -117,22 +122,7 @@ namespace awkward {
 
   void
   Record::tojson_part(ToJson& builder, bool include_beginendlist) const {
-    size_t cols = (size_t)numfields();
-    util::RecordLookupPtr keys = array_.get()->recordlookup();
-    if (istuple()) {
-      keys = std::make_shared<util::RecordLookup>();
-      for (size_t j = 0;  j < cols;  j++) {
-        keys.get()->push_back(std::to_string(j));
-      }
-    }
-    ContentPtrVec contents = array_.get()->contents();
-    builder.beginrecord();
-    for (size_t j = 0;  j < cols;  j++) {
-      builder.field(keys.get()->at(j).c_str());
-      contents[j].get()->getitem_at_nowrap(at_).get()->tojson_part(builder,
-                                                                   true);
-    }
-    builder.endrecord();
+    array_.get()->tojson_elements(builder, at_, at_ + 1);
   }
 
   void
@@ -161,6 +151,14 @@ namespace awkward {
       std::dynamic_pointer_cast<RecordArray>(out), at_);
   }
 
+  const ContentPtr
+  Record::pack() const {
+    ContentPtr out =
+      array_.get()->getitem_range_nowrap(at_, at_ + 1).get()->pack();
+    return std::make_shared<Record>(
+      std::dynamic_pointer_cast<RecordArray>(out), 0);
+  }
+
   void
   Record::check_for_iteration() const {
     if (array_.get()->identities().get() != nullptr  &&
@@ -90,6 +90,11 @@ namespace awkward {
     return out;
   }
 
+  FormKind
+  RecordForm::kind() const {
+    return FormKind::RecordForm;
+  }
+
   const TypePtr
   RecordForm::type(const util::TypeStrs& typestrs) const {
     std::vector<TypePtr> types;
@@ -220,6 +225,30 @@ namespace awkward {
     return util::keys(recordlookup_, numfields());
   }
 
+  const FormPtr
+  RecordForm::getitem_field(const std::string& key) const {
+    return contents_[(size_t)fieldindex(key)];
+  }
+
+  const FormPtr
+  RecordForm::getitem_fields(const std::vector<std::string>& keys) const {
+    std::vector<FormPtr> contents;
+    util::RecordLookupPtr recordlookup(nullptr);
+    if (recordlookup_.get() != nullptr) {
+      recordlookup = std::make_shared<util::RecordLookup>();
+    }
+    for (auto key : keys) {
+      contents.push_back(contents_[(size_t)fieldindex(key)]);
+      if (recordlookup.get() != nullptr) {
+        recordlookup.get()->push_back(key);
+      }
+    }
+    return std::make_shared<RecordForm>(has_identities_,
+                                        parameters_,
+                                        recordlookup,
+                                        contents);
+  }
+
   bool
   RecordForm::equal(const FormPtr& other,
                     bool check_identities,
@@ -233,7 +262,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (RecordForm* t = dynamic_cast<RecordForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::RecordForm) {
+      RecordForm* t = static_cast<RecordForm*>(other.get());
       if (recordlookup_.get() == nullptr  &&
           t->recordlookup().get() != nullptr) {
         return false;
@@ -298,7 +328,9 @@ namespace awkward {
       : Content(identities, parameters)
       , contents_(contents)
       , recordlookup_(recordlookup)
-      , length_(length) {
+      , length_(length)
+      , has_lazycarry_(false)
+      , lazycarry_(0) {
     if (recordlookup_.get() != nullptr  &&
         recordlookup_.get()->size() != contents_.size()) {
       throw std::invalid_argument(
@@ -332,9 +364,134 @@ namespace awkward {
                     recordlookup,
                     minlength(contents)) { }
 
+  namespace {
+    // Content::carry implementations read a carry from its first item, so
+    // a lazy carry with an offset is aliased to a pointer without one.
+    const Index64
+    without_offset(const Index64& index) {
+      if (index.offset() == 0) {
+        return index;
+      }
+      std::shared_ptr<int64_t> ptr(index.ptr(),
+                                   index.ptr().get() + index.offset());
+      return Index64(ptr, 0, index.length());
+    }
+
+    // Fails, as getitem_carry_64 would, if any item of `carry` is not a
+    // valid index for an array of length `length`.
+    void
+    check_carry(const Index64& carry,
+                int64_t length,
+                const std::string& classname,
+                const Identities* identities) {
+      struct Error err = awkward_index_carry_check_64(
+        carry.ptr().get(),
+        carry.offset(),
+        length,
+        carry.length());
+      util::handle_error(err, classname, identities);
+    }
+  }
+
+  RecordArray::RecordArray(const IdentitiesPtr& identities,
+                           const util::Parameters& parameters,
+                           const ContentPtrVec& contents,
+                           const util::RecordLookupPtr& recordlookup,
+                           const Index64& lazycarry)
+      : Content(identities, parameters)
+      , contents_(contents)
+      , recordlookup_(recordlookup)
+      , length_(lazycarry.length())
+      , has_lazycarry_(true)
+      , lazycarry_(without_offset(lazycarry))
+      , carried_(contents.size(), ContentPtr(nullptr)) {
+    if (recordlookup_.get() != nullptr  &&
+        recordlookup_.get()->size() != contents_.size()) {
+      throw std::invalid_argument(
+        "recordlookup and contents must have the same number of fields");
+    }
+    if (!contents_.empty()) {
+      check_carry(lazycarry_,
+                  minlength(contents_),
+                  classname(),
+                  identities_.get());
+    }
+  }
+
   const ContentPtrVec
   RecordArray::contents() const {
-    return contents_;
+    if (!has_lazycarry_) {
+      return contents_;
+    }
+    ContentPtrVec out;
+    for (size_t j = 0;  j < contents_.size();  j++) {
+      out.push_back(carried_field(j));
+    }
+    return out;
+  }
+
+  bool
+  RecordArray::has_lazycarry() const {
+    return has_lazycarry_;
+  }
+
+  const Index64
+  RecordArray::lazycarry() const {
+    return lazycarry_;
+  }
+
+  const ContentPtr
+  RecordArray::carried_field(size_t fieldindex) const {
+    if (!has_lazycarry_) {
+      return contents_[fieldindex];
+    }
+    {
+      std::lock_guard<std::mutex> lock(carried_mutex_);
+      if (carried_[fieldindex].get() != nullptr) {
+        return carried_[fieldindex];
+      }
+    }
+    // Carry outside the lock so that different fields can be carried by
+    // different threads; if two threads race on one field, the first
+    // result wins and both return it.
+    ContentPtr out = contents_[fieldindex].get()->carry(lazycarry_);
+    std::lock_guard<std::mutex> lock(carried_mutex_);
+    if (carried_[fieldindex].get() == nullptr) {
+      carried_[fieldindex] = out;
+    }
+    return carried_[fieldindex];
+  }
+
+  const std::shared_ptr<RecordArray>
+  RecordArray::lazy_copy(const IdentitiesPtr& identities,
+                         const std::vector<int64_t>& fieldindexes,
+                         const util::RecordLookupPtr& recordlookup,
+                         int64_t start,
+                         int64_t stop) const {
+    bool whole = (start == 0  &&  stop == length_);
+    ContentPtrVec contents;
+    ContentPtrVec carried;
+    {
+      std::lock_guard<std::mutex> lock(carried_mutex_);
+      for (auto j : fieldindexes) {
+        contents.push_back(contents_[(size_t)j]);
+        ContentPtr done = carried_[(size_t)j];
+        if (done.get() != nullptr  &&  !whole) {
+          // A range of the carry is that range of the carried field.
+          done = done.get()->getitem_range_nowrap(start, stop);
+        }
+        carried.push_back(done);
+      }
+    }
+    std::shared_ptr<RecordArray> out =
+      std::make_shared<RecordArray>(identities,
+                                    parameters_,
+                                    contents,
+                                    recordlookup,
+                                    lazycarry_.getitem_range_nowrap(start,
+                                                                    stop));
+    out.get()->carried_ = carried;
+    return out;
   }
 
   const util::RecordLookupPtr
@@ -358,12 +515,14 @@ namespace awkward {
         + std::string(" cannot be assigned to record array of length ")
         + std::to_string(length()));
     }
+    // `what` is already carried, so it cannot share a lazy carry with the
+    // other fields: they are carried here instead.
     ContentPtrVec contents;
     for (size_t i = 0;  i < contents_.size();  i++) {
       if (where == (int64_t)i) {
         contents.push_back(what);
       }
-      contents.push_back(contents_[i]);
+      contents.push_back(carried_field(i));
     }
     if (where >= numfields()) {
       contents.push_back(what);
@@ -396,7 +555,8 @@ namespace awkward {
         + std::string(" cannot be assigned to record array of length ")
         + std::to_string(length()));
     }
-    ContentPtrVec contents(contents_.begin(), contents_.end());
+    // As above, `what` is already carried, so the other fields are too.
+    ContentPtrVec contents = this->contents();
     contents.push_back(what);
     util::RecordLookupPtr recordlookup;
     if (recordlookup_.get() != nullptr) {
@@ -421,6 +581,11 @@ namespace awkward {
     return "RecordArray";
   }
 
+  ContentKind
+  RecordArray::kind() const {
+    return ContentKind::RecordArray;
+  }
+
   void
   RecordArray::setidentities() {
     int64_t len = length();
@@ -453,8 +618,11 @@ namespace awkward {
 
   void
   RecordArray::setidentities(const IdentitiesPtr& identities) {
+    // Never set identities on uncarried fields: they belong to the array
+    // this one was carried from.
+    ContentPtrVec contents = this->contents();
     if (identities.get() == nullptr) {
-      for (auto content : contents_) {
+      for (auto content : contents) {
         content.get()->setidentities(identities);
       }
     }
@@ -474,7 +642,7 @@ namespace awkward {
           fieldloc.push_back(
             std::pair<int64_t, std::string>(identities.get()->width() - 1,
                                             std::to_string(j)));
-          contents_[j].get()->setidentities(
+          contents[j].get()->setidentities(
             identities.get()->withfieldloc(fieldloc));
         }
       }
@@ -484,7 +652,7 @@ namespace awkward {
           Identities::FieldLoc fieldloc(original.begin(), original.end());
           fieldloc.push_back(std::pair<int64_t, std::string>(
             identities.get()->width() - 1, recordlookup_.get()->at(j)));
-          contents_[j].get()->setidentities(
+          contents[j].get()->setidentities(
             identities.get()->withfieldloc(fieldloc));
         }
       }
@@ -494,14 +662,45 @@ namespace awkward {
 
   const TypePtr
   RecordArray::type(const util::TypeStrs& typestrs) const {
+    if (has_lazycarry_) {
+      // Carrying never changes a type, so there is no need to carry.
+      std::vector<TypePtr> types;
+      for (auto x : contents_) {
+        types.push_back(x.get()->type(typestrs));
+      }
+      return std::make_shared<RecordType>(
+                 parameters_,
+                 util::gettypestr(parameters_, typestrs),
+                 types,
+                 recordlookup_);
+    }
     return form(true).get()->type(typestrs);
   }
 
   const FormPtr
   RecordArray::form(bool materialize) const {
     std::vector<FormPtr> contents;
-    for (auto x : contents_) {
-      contents.push_back(x.get()->form(materialize));
+    if (has_lazycarry_) {
+      // Carrying changes some Forms (a ListOffsetArray becomes a ListArray),
+      // but not by how much is carried, so an empty carry has the right
+      // Form without gathering the fields.
+      Index64 nocarry(0);
+      for (size_t j = 0;  j < contents_.size();  j++) {
+        ContentPtr done(nullptr);
+        {
+          std::lock_guard<std::mutex> lock(carried_mutex_);
+          done = carried_[j];
+        }
+        if (done.get() == nullptr) {
+          done = contents_[j].get()->carry(nocarry);
+        }
+        contents.push_back(done.get()->form(materialize));
+      }
+    }
+    else {
+      for (auto x : contents_) {
+        contents.push_back(x.get()->form(materialize));
+      }
     }
     return std::make_shared<RecordForm>(identities_.get() != nullptr,
                                         parameters_,
@@ -555,7 +754,7 @@ namespace awkward {
         out << ">";
       }
       out << "\n";
-      out << contents_[j].get()->tostring_part(
+      out << carried_field(j).get()->tostring_part(
                indent + std::string("        "), "", "\n");
       out << indent << "    </field>\n";
     }
@@ -565,7 +764,20 @@ namespace awkward {
 
   void
   RecordArray::tojson_part(ToJson& builder, bool include_beginendlist) const {
-    int64_t rows = length();
+    check_for_iteration();
+    if (include_beginendlist) {
+      builder.beginlist();
+    }
+    tojson_elements(builder, 0, length());
+    if (include_beginendlist) {
+      builder.endlist();
+    }
+  }
+
+  void
+  RecordArray::tojson_elements(ToJson& builder,
+                               int64_t start,
+                               int64_t stop) const {
     size_t cols = contents_.size();
     util::RecordLookupPtr keys = recordlookup_;
     if (istuple()) {
@@ -574,22 +786,20 @@ namespace awkward {
         keys.get()->push_back(std::to_string(j));
       }
     }
-    check_for_iteration();
-    if (include_beginendlist) {
-      builder.beginlist();
-    }
-    for (int64_t i = 0;  i < rows;  i++) {
+    // A pending lazy carry is followed row by row, rather than gathering
+    // every field only to write it out.
+    const int64_t* carry = (has_lazycarry_
+                              ? lazycarry_.ptr().get() + lazycarry_.offset()
+                              : nullptr);
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t at = (carry == nullptr ? i : carry[i]);
       builder.beginrecord();
       for (size_t j = 0;  j < cols;  j++) {
         builder.field(keys.get()->at(j).c_str());
-        contents_[j].get()->getitem_at_nowrap(i).get()->tojson_part(builder,
-                                                                    true);
+        contents_[j].get()->tojson_elements(builder, at, at + 1);
       }
       builder.endrecord();
     }
-    if (include_beginendlist) {
-      builder.endlist();
-    }
   }
 
   void
@@ -597,6 +807,15 @@ namespace awkward {
     for (auto x : contents_) {
       x.get()->nbytes_part(largest);
     }
+    if (has_lazycarry_) {
+      lazycarry_.nbytes_part(largest);
+      std::lock_guard<std::mutex> lock(carried_mutex_);
+      for (auto x : carried_) {
+        if (x.get() != nullptr) {
+          x.get()->nbytes_part(largest);
+        }
+      }
+    }
     if (identities_.get() != nullptr) {
       identities_.get()->nbytes_part(largest);
     }
@@ -609,6 +828,14 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::shallow_copy() const {
+    if (has_lazycarry_) {
+      std::vector<int64_t> fieldindexes;
+      for (int64_t i = 0;  i < numfields();  i++) {
+        fieldindexes.push_back(i);
+      }
+      return lazy_copy(identities_, fieldindexes,
+                       recordlookup_, 0, length_);
+    }
     return std::make_shared<RecordArray>(identities_,
                                          parameters_,
                                          contents_,
@@ -621,7 +848,7 @@ namespace awkward {
                          bool copyindexes,
                          bool copyidentities) const {
     ContentPtrVec contents;
-    for (auto x : contents_) {
+    for (auto x : this->contents()) {
       contents.push_back(x.get()->deep_copy(copyarrays,
                                             copyindexes,
                                             copyidentities));
@@ -637,6 +864,21 @@ namespace awkward {
                                          length_);
   }
 
+  const ContentPtr
+  RecordArray::pack() const {
+    // field applies a lazy carry, if any.
+    ContentPtrVec contents;
+    for (int64_t i = 0;  i < numfields();  i++) {
+      contents.push_back(
+        field(i).get()->getitem_range_nowrap(0, length()).get()->pack());
+    }
+    return std::make_shared<RecordArray>(identities_,
+                                         parameters_,
+                                         contents,
+                                         recordlookup_,
+                                         length());
+  }
+
   void
   RecordArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -692,7 +934,15 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
-    if (contents_.empty()) {
+    if (has_lazycarry_) {
+      std::vector<int64_t> fieldindexes;
+      for (int64_t i = 0;  i < numfields();  i++) {
+        fieldindexes.push_back(i);
+      }
+      return lazy_copy(identities_, fieldindexes,
+                       recordlookup_, start, stop);
+    }
+    else if (contents_.empty()) {
       return std::make_shared<RecordArray>(identities_,
                                            parameters_,
                                            contents_,
@@ -724,6 +974,17 @@ namespace awkward {
     if (recordlookup_.get() != nullptr) {
       recordlookup = std::make_shared<util::RecordLookup>();
     }
+    if (has_lazycarry_) {
+      std::vector<int64_t> fieldindexes;
+      for (auto key : keys) {
+        fieldindexes.push_back(fieldindex(key));
+        if (recordlookup.get() != nullptr) {
+          recordlookup.get()->push_back(key);
+        }
+      }
+      return lazy_copy(identities_, fieldindexes,
+                       recordlookup, 0, length_);
+    }
     for (auto key : keys) {
       contents.push_back(field(key).get()->getitem_range_nowrap(0, length()));
       if (recordlookup.get() != nullptr) {
@@ -738,19 +999,37 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::carry(const Index64& carry) const {
-    ContentPtrVec contents;
-    for (auto content : contents_) {
-      contents.push_back(content.get()->carry(carry));
+    if (!has_lazycarry_) {
+      // A lazy carry reaches the fields long after this call, so check it
+      // now; composing with an existing one is checked by getitem_carry_64.
+      check_carry(carry, length(), classname(), identities_.get());
     }
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
       identities = identities_.get()->getitem_carry_64(carry);
     }
-    return std::make_shared<RecordArray>(identities,
-                                         parameters_,
-                                         contents,
-                                         recordlookup_,
-                                         carry.length());
+    if (contents_.empty()) {
+      return std::make_shared<RecordArray>(identities,
+                                           parameters_,
+                                           contents_,
+                                           recordlookup_,
+                                           carry.length());
+    }
+    else if (has_lazycarry_) {
+      // Compose the carries rather than carrying any field twice.
+      return std::make_shared<RecordArray>(identities,
+                                           parameters_,
+                                           contents_,
+                                           recordlookup_,
+                                           lazycarry_.getitem_carry_64(carry));
+    }
+    else {
+      return std::make_shared<RecordArray>(identities,
+                                           parameters_,
+                                           contents_,
+                                           recordlookup_,
+                                           carry);
+    }
   }
 
   int64_t
@@ -822,7 +1101,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->num(axis, depth));
       }
       return std::make_shared<RecordArray>(Identities::none(),
@@ -846,7 +1125,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         ContentPtr trimmed = content.get()->getitem_range(0, length());
         std::pair<Index64, ContentPtr> pair =
           trimmed.get()->offsets_and_flattened(axis, depth);
@@ -868,7 +1147,8 @@ namespace awkward {
 
   bool
   RecordArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -876,47 +1156,27 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-
-    if (RecordArray* rawother =
-        dynamic_cast<RecordArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+        return mergeable(option_content(other), mergebool);
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RecordArray) {
+      RecordArray* rawother = static_cast<RecordArray*>(other.get());
       if (istuple()  &&  rawother->istuple()) {
         if (numfields() == rawother->numfields()) {
           for (int64_t i = 0;  i < numfields();  i++) {
@@ -951,7 +1211,8 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -959,56 +1220,27 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-
-    if (RecordArray* rawother =
-        dynamic_cast<RecordArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RecordArray) {
+      RecordArray* rawother = static_cast<RecordArray*>(other.get());
       int64_t mylength = length();
       int64_t theirlength = rawother->length();
 
@@ -1066,6 +1298,69 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  RecordArray::merge_many(const ContentPtrVec& others,
+                          bool mergebool) const {
+    ContentPtrVec inputs({ shallow_copy() });
+    inputs.insert(inputs.end(), others.begin(), others.end());
+    if (!all_mergeable(inputs, mergebool)) {
+      return Content::merge_many(others, mergebool);
+    }
+    std::vector<const RecordArray*> records({ this });
+    int64_t total = length();
+    std::vector<std::string> self_keys = keys();
+    std::sort(self_keys.begin(), self_keys.end());
+    for (auto& other : others) {
+      if (!parameters_equal(other.get()->parameters())) {
+        return Content::merge_many(others, mergebool);
+      }
+      if (other.get()->kind() == ContentKind::EmptyArray) {
+        continue;
+      }
+      if (other.get()->kind() != ContentKind::RecordArray) {
+        return Content::merge_many(others, mergebool);
+      }
+      RecordArray* rawother = static_cast<RecordArray*>(other.get());
+      if (istuple() != rawother->istuple()  ||
+          numfields() != rawother->numfields()) {
+        return Content::merge_many(others, mergebool);
+      }
+      if (!istuple()) {
+        std::vector<std::string> other_keys = rawother->keys();
+        std::sort(other_keys.begin(), other_keys.end());
+        if (self_keys != other_keys) {
+          return Content::merge_many(others, mergebool);
+        }
+      }
+      records.push_back(rawother);
+      total += rawother->length();
+    }
+
+    if (numfields() == 0) {
+      return std::make_shared<RecordArray>(Identities::none(),
+                                           parameters_,
+                                           contents_,
+                                           util::RecordLookupPtr(nullptr),
+                                           total);
+    }
+    ContentPtrVec contents;
+    for (int64_t i = 0;  i < numfields();  i++) {
+      ContentPtrVec fields;
+      for (auto record : records) {
+        ContentPtr field = istuple() ? record->field(i)
+                                     : record->field(key(i));
+        fields.push_back(
+          field.get()->getitem_range_nowrap(0, record->length()));
+      }
+      ContentPtrVec rest(fields.begin() + 1, fields.end());
+      contents.push_back(fields[0].get()->merge_many(rest, mergebool));
+    }
+    return std::make_shared<RecordArray>(Identities::none(),
+                                         parameters_,
+                                         contents,
+                                         recordlookup_);
+  }
+
   const SliceItemPtr
   RecordArray::asslice() const {
     throw std::invalid_argument("cannot use records as a slice");
@@ -1074,7 +1369,7 @@ namespace awkward {
   const ContentPtr
   RecordArray::fillna(const ContentPtr& value) const {
     ContentPtrVec contents;
-    for (auto content : contents_) {
+    for (auto content : this->contents()) {
       contents.push_back(content.get()->fillna(value));
     }
     return std::make_shared<RecordArray>(identities_,
@@ -1092,7 +1387,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->rpad(target, toaxis, depth));
       }
       if (contents.empty()) {
@@ -1121,7 +1416,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(
           content.get()->rpad_and_clip(target, toaxis, depth));
       }
@@ -1150,7 +1445,7 @@ namespace awkward {
                            bool mask,
                            bool keepdims) const {
     ContentPtrVec contents;
-    for (auto content : contents_) {
+    for (auto content : this->contents()) {
       ContentPtr trimmed = content.get()->getitem_range_nowrap(0, length());
       ContentPtr next = trimmed.get()->reduce_next(reducer,
                                                    negaxis,
@@ -1176,7 +1471,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->localindex(axis, depth));
       }
       return std::make_shared<RecordArray>(identities_,
@@ -1203,7 +1498,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->combinations(n,
                                                        replacement,
                                                        recordlookup,
@@ -1227,17 +1522,17 @@ namespace awkward {
         + std::string(" for record with only " + std::to_string(numfields()))
         + std::string(" fields"));
     }
-    return contents_[(size_t)fieldindex];
+    return carried_field((size_t)fieldindex);
   }
 
   const ContentPtr
   RecordArray::field(const std::string& key) const {
-    return contents_[(size_t)fieldindex(key)];
+    return carried_field((size_t)fieldindex(key));
   }
 
   const ContentPtrVec
   RecordArray::fields() const {
-    return ContentPtrVec(contents_);
+    return contents();
   }
 
   const std::vector<std::pair<std::string, ContentPtr>>
@@ -1247,7 +1542,8 @@ namespace awkward {
       size_t cols = contents_.size();
       for (size_t j = 0;  j < cols;  j++) {
         out.push_back(
-          std::pair<std::string, ContentPtr>(std::to_string(j), contents_[j]));
+          std::pair<std::string, ContentPtr>(std::to_string(j),
+                                             carried_field(j)));
       }
     }
     else {
@@ -1255,7 +1551,7 @@ namespace awkward {
       for (size_t j = 0;  j < cols;  j++) {
         out.push_back(
           std::pair<std::string, ContentPtr>(recordlookup_.get()->at(j),
-                                             contents_[j]));
+                                             carried_field(j)));
       }
     }
     return out;
@@ -1263,6 +1559,14 @@ namespace awkward {
 
   const std::shared_ptr<RecordArray>
   RecordArray::astuple() const {
+    if (has_lazycarry_) {
+      std::vector<int64_t> fieldindexes;
+      for (int64_t i = 0;  i < numfields();  i++) {
+        fieldindexes.push_back(i);
+      }
+      return lazy_copy(identities_, fieldindexes,
+                       util::RecordLookupPtr(nullptr), 0, length_);
+    }
     return std::make_shared<RecordArray>(identities_,
                                          parameters_,
                                          contents_,
@@ -1282,23 +1586,26 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      ContentPtr out = getitem_next(*field, emptytail, advanced);
+    else if (head.get()->kind() == SliceKind::field) {
+      ContentPtr out = getitem_next(*static_cast<SliceField*>(head.get()),
+                                    emptytail,
+                                    advanced);
       return out.get()->getitem_next(nexthead, nexttail, advanced);
     }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      ContentPtr out = getitem_next(*fields, emptytail, advanced);
+    else if (head.get()->kind() == SliceKind::fields) {
+      ContentPtr out = getitem_next(*static_cast<SliceFields*>(head.get()),
+                                    emptytail,
+                                    advanced);
       return out.get()->getitem_next(nexthead, nexttail, advanced);
     }
-    else if (const SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return Content::getitem_next(*missing, tail, advanced);
+    else if (head.get()->kind() == SliceKind::missing64) {
+      return Content::getitem_next(*static_cast<SliceMissing64*>(head.get()),
+                                   tail,
+                                   advanced);
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->getitem_next(head,
                                                        emptytail,
                                                        advanced));
@@ -1410,7 +1717,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->getitem_next_jagged(slicestarts,
                                                               slicestops,
                                                               slicecontent,
@@ -45,6 +45,11 @@ namespace awkward {
     return size_;
   }
 
+  FormKind
+  RegularForm::kind() const {
+    return FormKind::RegularForm;
+  }
+
   const TypePtr
   RegularForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<RegularType>(
@@ -136,6 +141,24 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  RegularForm::getitem_field(const std::string& key) const {
+    return std::make_shared<RegularForm>(
+      has_identities_,
+      util::Parameters(),
+      content_.get()->getitem_field(key),
+      size_);
+  }
+
+  const FormPtr
+  RegularForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<RegularForm>(
+      has_identities_,
+      util::Parameters(),
+      content_.get()->getitem_fields(keys),
+      size_);
+  }
+
   bool
   RegularForm::equal(const FormPtr& other,
                      bool check_identities,
@@ -149,7 +172,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (RegularForm* t = dynamic_cast<RegularForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::RegularForm) {
+      RegularForm* t = static_cast<RegularForm*>(other.get());
       return (content_.get()->equal(t->content(),
                                     check_identities,
                                     check_parameters,
@@ -263,6 +287,11 @@ namespace awkward {
     return "RegularArray";
   }
 
+  ContentKind
+  RegularArray::kind() const {
+    return ContentKind::RegularArray;
+  }
+
   void
   RegularArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
@@ -408,14 +437,21 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  void
+  RegularArray::tojson_elements(ToJson& builder,
+                                int64_t start,
+                                int64_t stop) const {
+    for (int64_t i = start;  i < stop;  i++) {
+      content_.get()->tojson_sublist(builder, i*size_, (i + 1)*size_);
+    }
+  }
+
   void
   RegularArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
     content_.get()->nbytes_part(largest);
@@ -456,6 +492,16 @@ namespace awkward {
                                           size_);
   }
 
+  const ContentPtr
+  RegularArray::pack() const {
+    ContentPtr content =
+      content_.get()->getitem_range_nowrap(0, length()*size_).get()->pack();
+    return std::make_shared<RegularArray>(identities_,
+                                          parameters_,
+                                          content,
+                                          size_);
+  }
+
   void
   RegularArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -626,7 +672,8 @@ namespace awkward {
 
   bool
   RegularArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -634,71 +681,54 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return mergeable(rawother->content(), mergebool);
-    }
-
-    if (RegularArray* rawother =
-        dynamic_cast<RegularArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+        return mergeable(option_content(other), mergebool);
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawother = static_cast<RegularArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray32* rawother =
-             dynamic_cast<ListArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray32) {
+      ListArray32* rawother = static_cast<ListArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArrayU32* rawother =
-             dynamic_cast<ListArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArrayU32) {
+      ListArrayU32* rawother = static_cast<ListArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListArray64* rawother =
-             dynamic_cast<ListArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray64) {
+      ListArray64* rawother = static_cast<ListArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray32* rawother =
-             dynamic_cast<ListOffsetArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray32) {
+      ListOffsetArray32* rawother =
+        static_cast<ListOffsetArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArrayU32* rawother =
-             dynamic_cast<ListOffsetArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArrayU32) {
+      ListOffsetArrayU32* rawother =
+        static_cast<ListOffsetArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ListOffsetArray64* rawother =
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListOffsetArray64) {
+      ListOffsetArray64* rawother =
+        static_cast<ListOffsetArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
@@ -708,7 +738,8 @@ namespace awkward {
 
   const ContentPtr
   RegularArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -716,55 +747,27 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
-      return shallow_copy();
-    }
-    else if (IndexedArray32* rawother =
-             dynamic_cast<IndexedArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_32* rawother =
-             dynamic_cast<UnionArray8_32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
-      return rawother->reverse_merge(shallow_copy());
-    }
-
-    if (RegularArray* rawother = dynamic_cast<RegularArray*>(other.get())) {
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+        return shallow_copy();
+      case ContentKind::IndexedArray32:
+      case ContentKind::IndexedArrayU32:
+      case ContentKind::IndexedArray64:
+      case ContentKind::IndexedOptionArray32:
+      case ContentKind::IndexedOptionArray64:
+      case ContentKind::ByteMaskedArray:
+      case ContentKind::BitMaskedArray:
+      case ContentKind::UnmaskedArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return other.get()->reverse_merge(shallow_copy());
+      default:
+        break;
+    }
+
+    if (other.get()->kind() == ContentKind::RegularArray) {
+      RegularArray* rawother = static_cast<RegularArray*>(other.get());
       if (size_ == rawother->size()) {
         ContentPtr mine =
           content_.get()->getitem_range_nowrap(0, size_*length());
@@ -781,12 +784,12 @@ namespace awkward {
         return toListOffsetArray64(true).get()->merge(other);
       }
     }
-    else if (dynamic_cast<ListArray32*>(other.get())  ||
-             dynamic_cast<ListArrayU32*>(other.get())  ||
-             dynamic_cast<ListArray64*>(other.get())  ||
-             dynamic_cast<ListOffsetArray32*>(other.get())  ||
-             dynamic_cast<ListOffsetArrayU32*>(other.get())  ||
-             dynamic_cast<ListOffsetArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ListArray32  ||
+             other.get()->kind() == ContentKind::ListArrayU32  ||
+             other.get()->kind() == ContentKind::ListArray64  ||
+             other.get()->kind() == ContentKind::ListOffsetArray32  ||
+             other.get()->kind() == ContentKind::ListOffsetArrayU32  ||
+             other.get()->kind() == ContentKind::ListOffsetArray64) {
       return toListOffsetArray64(true).get()->merge(other);
     }
     else {
@@ -961,8 +964,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr = util::allocate<int64_t>(totallen);
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
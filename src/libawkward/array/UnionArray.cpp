@@ -57,6 +57,11 @@ namespace awkward {
     return contents_[(size_t)index];
   }
 
+  FormKind
+  UnionForm::kind() const {
+    return FormKind::UnionForm;
+  }
+
   const TypePtr
   UnionForm::type(const util::TypeStrs& typestrs) const {
     std::vector<TypePtr> types;
@@ -247,6 +252,32 @@ namespace awkward {
     return out;
   }
 
+  const FormPtr
+  UnionForm::getitem_field(const std::string& key) const {
+    std::vector<FormPtr> contents;
+    for (auto content : contents_) {
+      contents.push_back(content.get()->getitem_field(key));
+    }
+    return std::make_shared<UnionForm>(has_identities_,
+                                       util::Parameters(),
+                                       tags_,
+                                       index_,
+                                       contents);
+  }
+
+  const FormPtr
+  UnionForm::getitem_fields(const std::vector<std::string>& keys) const {
+    std::vector<FormPtr> contents;
+    for (auto content : contents_) {
+      contents.push_back(content.get()->getitem_fields(keys));
+    }
+    return std::make_shared<UnionForm>(has_identities_,
+                                       util::Parameters(),
+                                       tags_,
+                                       index_,
+                                       contents);
+  }
+
   bool
   UnionForm::equal(const FormPtr& other,
                    bool check_identities,
@@ -260,7 +291,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (UnionForm* t = dynamic_cast<UnionForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::UnionForm) {
+      UnionForm* t = static_cast<UnionForm*>(other.get());
       if (tags_ != t->tags()  ||  index_ != t->index()) {
         return false;
       }
@@ -686,6 +718,20 @@ namespace awkward {
     return "UnrecognizedUnionArray";
   }
 
+  template <typename T, typename I>
+  ContentKind
+  UnionArrayOf<T, I>::kind() const {
+    if (std::is_same<I, int32_t>::value) {
+      return ContentKind::UnionArray8_32;
+    }
+    else if (std::is_same<I, uint32_t>::value) {
+      return ContentKind::UnionArray8_U32;
+    }
+    else {
+      return ContentKind::UnionArray8_64;
+    }
+  }
+
   template <typename T, typename I>
   void
   UnionArrayOf<T, I>::setidentities() {
@@ -896,14 +942,39 @@ namespace awkward {
     if (include_beginendlist) {
       builder.beginlist();
     }
-    for (int64_t i = 0;  i < len;  i++) {
-      getitem_at_nowrap(i).get()->tojson_part(builder, true);
-    }
+    tojson_elements(builder, 0, len);
     if (include_beginendlist) {
       builder.endlist();
     }
   }
 
+  template <typename T, typename I>
+  void
+  UnionArrayOf<T, I>::tojson_elements(ToJson& builder,
+                                      int64_t start,
+                                      int64_t stop) const {
+    const T* tags = tags_.ptr().get() + tags_.offset();
+    const I* index = index_.ptr().get() + index_.offset();
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t tag = (int64_t)tags[i];
+      int64_t at = (int64_t)index[i];
+      if (tag < 0  ||  tag >= (int64_t)contents_.size()) {
+        util::handle_error(
+          failure("not 0 <= tag[i] < numcontents", kSliceNone, i),
+          classname(),
+          identities_.get());
+      }
+      const ContentPtr& content = contents_[(size_t)tag];
+      if (!(0 <= at  &&  at < content.get()->length())) {
+        util::handle_error(
+          failure("index[i] > len(content(tag))", kSliceNone, i),
+          classname(),
+          identities_.get());
+      }
+      content.get()->tojson_elements(builder, at, at + 1);
+    }
+  }
+
   template <typename T, typename I>
   void
   UnionArrayOf<T, I>::nbytes_part(std::map<size_t, int64_t>& largest) const {
@@ -955,6 +1026,24 @@ namespace awkward {
                                                 contents);
   }
 
+  template <typename T, typename I>
+  const ContentPtr
+  UnionArrayOf<T, I>::pack() const {
+    // Each content keeps only the items tagged for it, so the index
+    // counts up within each tag.
+    IndexOf<T> tags = tags_.deep_copy();
+    IndexOf<I> index = regular_index(tags);
+    ContentPtrVec contents;
+    for (int64_t i = 0;  i < numcontents();  i++) {
+      contents.push_back(project(i).get()->pack());
+    }
+    return std::make_shared<UnionArrayOf<T, I>>(identities_,
+                                                parameters_,
+                                                tags,
+                                                index,
+                                                contents);
+  }
+
   template <typename T, typename I>
   void
   UnionArrayOf<T, I>::check_for_iteration() const {
@@ -1086,46 +1175,29 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (dynamic_cast<SliceAt*>(head.get())  ||
-             dynamic_cast<SliceRange*>(head.get())  ||
-             dynamic_cast<SliceArray64*>(head.get())  ||
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      ContentPtrVec outcontents;
-      for (int64_t i = 0;  i < numcontents();  i++) {
-        ContentPtr projection = project(i);
-        outcontents.push_back(
-          projection.get()->getitem_next(head, tail, advanced));
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+      case SliceKind::range:
+      case SliceKind::array64:
+      case SliceKind::jagged64: {
+        ContentPtrVec outcontents;
+        for (int64_t i = 0;  i < numcontents();  i++) {
+          ContentPtr projection = project(i);
+          outcontents.push_back(
+            projection.get()->getitem_next(head, tail, advanced));
+        }
+        IndexOf<I> outindex = regular_index(tags_);
+        UnionArrayOf<T, I> out(identities_,
+                               parameters_,
+                               tags_,
+                               outindex,
+                               outcontents);
+        return out.simplify_uniontype(false);
       }
-      IndexOf<I> outindex = regular_index(tags_);
-      UnionArrayOf<T, I> out(identities_,
-                             parameters_,
-                             tags_,
-                             outindex,
-                             outcontents);
-      return out.simplify_uniontype(false);
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return Content::getitem_next(*ellipsis, tail, advanced);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return Content::getitem_next(*newaxis, tail, advanced);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      return Content::getitem_next(*field, tail, advanced);
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      return Content::getitem_next(*fields, tail, advanced);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return Content::getitem_next(*missing, tail, advanced);
-    }
-    else {
-      throw std::runtime_error("unrecognized slice type");
+      default:
+        // Ellipsis, newaxis, fields, and missing are independent of the
+        // option/union structure and are handled generically.
+        return Content::getitem_next(head, tail, advanced);
     }
   }
 
@@ -1363,7 +1435,8 @@ namespace awkward {
   bool
   UnionArrayOf<T, I>::mergeable(const ContentPtr& other,
                                 bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -1376,7 +1449,8 @@ namespace awkward {
   template <typename T, typename I>
   const ContentPtr
   UnionArrayOf<T, I>::reverse_merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return reverse_merge(raw->array());
     }
 
@@ -1460,7 +1534,8 @@ namespace awkward {
   template <typename T, typename I>
   const ContentPtr
   UnionArrayOf<T, I>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return merge(raw->array());
     }
 
@@ -1468,7 +1543,7 @@ namespace awkward {
       return merge_as_union(other);
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::EmptyArray) {
       return shallow_copy();
     }
 
@@ -1523,8 +1598,8 @@ namespace awkward {
     }
 
     ContentPtrVec contents(contents_.begin(), contents_.end());
-    if (UnionArray8_32* rawother =
-        dynamic_cast<UnionArray8_32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::UnionArray8_32) {
+      UnionArray8_32* rawother = static_cast<UnionArray8_32*>(other.get());
       ContentPtrVec other_contents = rawother->contents();
       contents.insert(contents.end(),
                       other_contents.begin(),
@@ -1551,8 +1626,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (UnionArray8_U32* rawother =
-             dynamic_cast<UnionArray8_U32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnionArray8_U32) {
+      UnionArray8_U32* rawother = static_cast<UnionArray8_U32*>(other.get());
       ContentPtrVec other_contents = rawother->contents();
       contents.insert(contents.end(),
                       other_contents.begin(),
@@ -1579,8 +1654,8 @@ namespace awkward {
                          rawother->classname(),
                          rawother->identities().get());
     }
-    else if (UnionArray8_64* rawother =
-             dynamic_cast<UnionArray8_64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnionArray8_64) {
+      UnionArray8_64* rawother = static_cast<UnionArray8_64*>(other.get());
       ContentPtrVec other_contents = rawother->contents();
       contents.insert(contents.end(),
                       other_contents.begin(),
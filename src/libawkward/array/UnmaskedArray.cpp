@@ -35,6 +35,11 @@ namespace awkward {
     return content_;
   }
 
+  FormKind
+  UnmaskedForm::kind() const {
+    return FormKind::UnmaskedForm;
+  }
+
   const TypePtr
   UnmaskedForm::type(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
@@ -118,6 +123,22 @@ namespace awkward {
     return content_.get()->keys();
   }
 
+  const FormPtr
+  UnmaskedForm::getitem_field(const std::string& key) const {
+    return std::make_shared<UnmaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      content_.get()->getitem_field(key));
+  }
+
+  const FormPtr
+  UnmaskedForm::getitem_fields(const std::vector<std::string>& keys) const {
+    return std::make_shared<UnmaskedForm>(
+      has_identities_,
+      util::Parameters(),
+      content_.get()->getitem_fields(keys));
+  }
+
   bool
   UnmaskedForm::equal(const FormPtr& other,
                       bool check_identities,
@@ -131,7 +152,8 @@ namespace awkward {
         !util::parameters_equal(parameters_, other.get()->parameters())) {
       return false;
     }
-    if (UnmaskedForm* t = dynamic_cast<UnmaskedForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::UnmaskedForm) {
+      UnmaskedForm* t = static_cast<UnmaskedForm*>(other.get());
       return (content_.get()->equal(t->content(),
                                     check_identities,
                                     check_parameters,
@@ -181,14 +203,14 @@ namespace awkward {
 
   const ContentPtr
   UnmaskedArray::simplify_optiontype() const {
-    if (dynamic_cast<IndexedArray32*>(content_.get())        ||
-        dynamic_cast<IndexedArrayU32*>(content_.get())       ||
-        dynamic_cast<IndexedArray64*>(content_.get())        ||
-        dynamic_cast<IndexedOptionArray32*>(content_.get())  ||
-        dynamic_cast<IndexedOptionArray64*>(content_.get())  ||
-        dynamic_cast<ByteMaskedArray*>(content_.get())       ||
-        dynamic_cast<BitMaskedArray*>(content_.get())        ||
-        dynamic_cast<UnmaskedArray*>(content_.get())) {
+    if (content_.get()->kind() == ContentKind::IndexedArray32        ||
+        content_.get()->kind() == ContentKind::IndexedArrayU32       ||
+        content_.get()->kind() == ContentKind::IndexedArray64        ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray32  ||
+        content_.get()->kind() == ContentKind::IndexedOptionArray64  ||
+        content_.get()->kind() == ContentKind::ByteMaskedArray       ||
+        content_.get()->kind() == ContentKind::BitMaskedArray        ||
+        content_.get()->kind() == ContentKind::UnmaskedArray) {
       return content_;
     }
     else {
@@ -214,6 +236,11 @@ namespace awkward {
     return "UnmaskedArray";
   }
 
+  ContentKind
+  UnmaskedArray::kind() const {
+    return ContentKind::UnmaskedArray;
+  }
+
   void
   UnmaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
@@ -349,6 +376,13 @@ namespace awkward {
     content_.get()->tojson_part(builder, include_beginendlist);
   }
 
+  void
+  UnmaskedArray::tojson_elements(ToJson& builder,
+                                 int64_t start,
+                                 int64_t stop) const {
+    content_.get()->tojson_elements(builder, start, stop);
+  }
+
   void
   UnmaskedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
     content_.get()->nbytes_part(largest);
@@ -378,6 +412,13 @@ namespace awkward {
     return std::make_shared<UnmaskedArray>(identities, parameters_, content);
   }
 
+  const ContentPtr
+  UnmaskedArray::pack() const {
+    return std::make_shared<UnmaskedArray>(identities_,
+                                           parameters_,
+                                           content_.get()->pack());
+  }
+
   void
   UnmaskedArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
@@ -465,37 +506,20 @@ namespace awkward {
     if (head.get() == nullptr) {
       return shallow_copy();
     }
-    else if (dynamic_cast<SliceAt*>(head.get())  ||
-             dynamic_cast<SliceRange*>(head.get())  ||
-             dynamic_cast<SliceArray64*>(head.get())  ||
-             dynamic_cast<SliceJagged64*>(head.get())) {
-      UnmaskedArray out2(identities_,
-                         parameters_,
-                         content_.get()->getitem_next(head, tail, advanced));
-      return out2.simplify_optiontype();
-    }
-    else if (SliceEllipsis* ellipsis =
-             dynamic_cast<SliceEllipsis*>(head.get())) {
-      return Content::getitem_next(*ellipsis, tail, advanced);
-    }
-    else if (SliceNewAxis* newaxis =
-             dynamic_cast<SliceNewAxis*>(head.get())) {
-      return Content::getitem_next(*newaxis, tail, advanced);
-    }
-    else if (SliceField* field =
-             dynamic_cast<SliceField*>(head.get())) {
-      return Content::getitem_next(*field, tail, advanced);
-    }
-    else if (SliceFields* fields =
-             dynamic_cast<SliceFields*>(head.get())) {
-      return Content::getitem_next(*fields, tail, advanced);
-    }
-    else if (SliceMissing64* missing =
-             dynamic_cast<SliceMissing64*>(head.get())) {
-      return Content::getitem_next(*missing, tail, advanced);
-    }
-    else {
-      throw std::runtime_error("unrecognized slice type");
+    switch (head.get()->kind()) {
+      case SliceKind::at:
+      case SliceKind::range:
+      case SliceKind::array64:
+      case SliceKind::jagged64: {
+        UnmaskedArray out2(identities_,
+                           parameters_,
+                           content_.get()->getitem_next(head, tail, advanced));
+        return out2.simplify_optiontype();
+      }
+      default:
+        // Ellipsis, newaxis, fields, and missing are independent of the
+        // option/union structure and are handled generically.
+        return Content::getitem_next(head, tail, advanced);
     }
   }
 
@@ -586,7 +610,8 @@ namespace awkward {
 
   bool
   UnmaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
+    if (other.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* raw = static_cast<VirtualArray*>(other.get());
       return mergeable(raw->array(), mergebool);
     }
 
@@ -594,43 +619,48 @@ namespace awkward {
       return false;
     }
 
-    if (dynamic_cast<EmptyArray*>(other.get())  ||
-        dynamic_cast<UnionArray8_32*>(other.get())  ||
-        dynamic_cast<UnionArray8_U32*>(other.get())  ||
-        dynamic_cast<UnionArray8_64*>(other.get())) {
-      return true;
+    switch (other.get()->kind()) {
+      case ContentKind::EmptyArray:
+      case ContentKind::UnionArray8_32:
+      case ContentKind::UnionArray8_U32:
+      case ContentKind::UnionArray8_64:
+        return true;
+      default:
+        break;
     }
 
-    if (IndexedArray32* rawother =
-        dynamic_cast<IndexedArray32*>(other.get())) {
+    if (other.get()->kind() == ContentKind::IndexedArray32) {
+      IndexedArray32* rawother = static_cast<IndexedArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArrayU32* rawother =
-             dynamic_cast<IndexedArrayU32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArrayU32) {
+      IndexedArrayU32* rawother = static_cast<IndexedArrayU32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedArray64* rawother =
-             dynamic_cast<IndexedArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedArray64) {
+      IndexedArray64* rawother = static_cast<IndexedArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray32* rawother =
-             dynamic_cast<IndexedOptionArray32*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray32) {
+      IndexedOptionArray32* rawother =
+        static_cast<IndexedOptionArray32*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (IndexedOptionArray64* rawother =
-             dynamic_cast<IndexedOptionArray64*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::IndexedOptionArray64) {
+      IndexedOptionArray64* rawother =
+        static_cast<IndexedOptionArray64*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (ByteMaskedArray* rawother =
-             dynamic_cast<ByteMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::ByteMaskedArray) {
+      ByteMaskedArray* rawother = static_cast<ByteMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (BitMaskedArray* rawother =
-             dynamic_cast<BitMaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::BitMaskedArray) {
+      BitMaskedArray* rawother = static_cast<BitMaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
-    else if (UnmaskedArray* rawother =
-             dynamic_cast<UnmaskedArray*>(other.get())) {
+    else if (other.get()->kind() == ContentKind::UnmaskedArray) {
+      UnmaskedArray* rawother = static_cast<UnmaskedArray*>(other.get());
       return content_.get()->mergeable(rawother->content(), mergebool);
     }
     else {
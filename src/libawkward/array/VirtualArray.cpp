@@ -1,14 +1,85 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 
 #include "awkward/array/RegularArray.h"
 
 #include "awkward/array/VirtualArray.h"
 
 namespace awkward {
+  namespace {
+    // One generation in progress, shared by every thread that asks for the
+    // same key of the same cache while it runs.
+    struct Flight {
+      std::mutex mutex;
+      std::condition_variable finished;
+      bool done = false;
+      ContentPtr result;
+      std::exception_ptr error;
+    };
+
+    using FlightKey = std::pair<const ArrayCache*, std::string>;
+
+    std::mutex flights_mutex;
+    std::map<FlightKey, std::shared_ptr<Flight>> flights;
+    VirtualArray::WaitWrapper wait_wrapper;
+
+    class PrefetchPool {
+    public:
+      PrefetchPool(int64_t numthreads) {
+        for (int64_t i = 0;  i < numthreads;  i++) {
+          std::thread(&PrefetchPool::run, this).detach();
+        }
+      }
+
+      void
+      submit(const std::function<void()>& task) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          tasks_.push_back(task);
+        }
+        ready_.notify_one();
+      }
+
+    private:
+      void
+      run() {
+        for (;;) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this]() -> bool { return !tasks_.empty(); });
+            task = tasks_.front();
+            tasks_.pop_front();
+          }
+          task();
+        }
+      }
+
+      std::mutex mutex_;
+      std::condition_variable ready_;
+      std::deque<std::function<void()>> tasks_;
+    };
+
+    PrefetchPool&
+    prefetch_pool() {
+      // Never destroyed, so that its detached threads never see a dead pool
+      // during static destruction.
+      static PrefetchPool* pool = new PrefetchPool(
+        std::max((int64_t)2, (int64_t)std::thread::hardware_concurrency()));
+      return *pool;
+    }
+  }
+
   ////////// VirtualForm
 
   VirtualForm::VirtualForm(bool has_identities,
@@ -34,6 +105,11 @@ namespace awkward {
     return has_length_;
   }
 
+  FormKind
+  VirtualForm::kind() const {
+    return FormKind::VirtualForm;
+  }
+
   const TypePtr
   VirtualForm::type(const util::TypeStrs& typestrs) const {
     if (form_.get() == nullptr) {
@@ -176,11 +252,46 @@ namespace awkward {
     }
   }
 
+  const FormPtr
+  VirtualForm::getitem_field(const std::string& key) const {
+    FormPtr form(nullptr);
+    if (form_.get() != nullptr) {
+      form = form_.get()->getitem_field(key);
+    }
+    return std::make_shared<VirtualForm>(false,
+                                         util::Parameters(),
+                                         form,
+                                         has_length_);
+  }
+
+  const FormPtr
+  VirtualForm::getitem_fields(const std::vector<std::string>& keys) const {
+    FormPtr form(nullptr);
+    if (form_.get() != nullptr) {
+      form = form_.get()->getitem_fields(keys);
+    }
+    return std::make_shared<VirtualForm>(false,
+                                         util::Parameters(),
+                                         form,
+                                         has_length_);
+  }
+
   bool
   VirtualForm::equal(const FormPtr& other,
                      bool check_identities,
                      bool check_parameters,
                      bool compatibility_check) const {
+    if (compatibility_check  &&
+        other.get()->kind() != FormKind::VirtualForm) {
+      // An expected Form derived from a lazy slice of a VirtualArray is a
+      // VirtualForm, but the VirtualArray may have been materialized by the
+      // time the slice is generated, so compare what it would generate.
+      return form_.get() == nullptr  ||
+             form_.get()->equal(other,
+                                check_identities,
+                                check_parameters,
+                                compatibility_check);
+    }
     if (check_identities  &&
         has_identities_ != other.get()->has_identities()) {
       return false;
@@ -190,7 +301,8 @@ namespace awkward {
       return false;
     }
 
-    if (VirtualForm* t = dynamic_cast<VirtualForm*>(other.get())) {
+    if (other.get()->kind() == FormKind::VirtualForm) {
+      VirtualForm* t = static_cast<VirtualForm*>(other.get());
       if (compatibility_check) {
         // Called by ArrayGenerator::generate_and_check; `this` is the expected
         // Form and `t` is the Form of the generated array, so `this` is allowed
@@ -271,19 +383,101 @@ namespace awkward {
 
   const ContentPtr
   VirtualArray::array() const {
-    ContentPtr out(nullptr);
-    if (cache_.get() != nullptr) {
-      out = cache_.get()->get(cache_key());
+    ContentPtr out = peek_array();
+    if (out.get() != nullptr) {
+      return out;
+    }
+
+    FlightKey key(cache_.get(), cache_key_);
+    std::shared_ptr<Flight> flight;
+    bool leader = false;
+    WaitWrapper wrapper;
+    {
+      std::lock_guard<std::mutex> lock(flights_mutex);
+      auto found = flights.find(key);
+      if (found == flights.end()) {
+        flight = std::make_shared<Flight>();
+        flights[key] = flight;
+        leader = true;
+      }
+      else {
+        flight = found->second;
+        wrapper = wait_wrapper;
+      }
     }
-    if (out.get() == nullptr) {
-      out = generator_.get()->generate_and_check();
+
+    if (!leader) {
+      std::function<void()> wait = [&flight]() -> void {
+        std::unique_lock<std::mutex> lock(flight.get()->mutex);
+        flight.get()->finished.wait(
+          lock, [&flight]() -> bool { return flight.get()->done; });
+      };
+      if (wrapper) {
+        wrapper(wait);
+      }
+      else {
+        wait();
+      }
+      if (flight.get()->error) {
+        std::rethrow_exception(flight.get()->error);
+      }
+      return flight.get()->result;
     }
-    if (cache_.get() != nullptr) {
-      cache_.get()->set(cache_key(), out);
+
+    std::exception_ptr error;
+    try {
+      // A previous leader may have filled the cache since the first look.
+      out = peek_array();
+      if (out.get() == nullptr) {
+        out = generator_.get()->generate_and_check();
+        if (cache_.get() != nullptr) {
+          cache_.get()->set(cache_key(), out);
+        }
+      }
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(flights_mutex);
+      flights.erase(key);
+    }
+    {
+      std::lock_guard<std::mutex> lock(flight.get()->mutex);
+      flight.get()->result = out;
+      flight.get()->error = error;
+      flight.get()->done = true;
+    }
+    flight.get()->finished.notify_all();
+    if (error) {
+      std::rethrow_exception(error);
     }
     return out;
   }
 
+  void
+  VirtualArray::prefetch(
+    const std::vector<std::shared_ptr<VirtualArray>>& arrays) {
+    for (auto& x : arrays) {
+      if (x.get()->cache().get() == nullptr) {
+        continue;
+      }
+      std::shared_ptr<VirtualArray> array = x;
+      prefetch_pool().submit([array]() -> void {
+        try {
+          array.get()->array();
+        }
+        catch (...) { }
+      });
+    }
+  }
+
+  void
+  VirtualArray::set_wait_wrapper(const WaitWrapper& wrapper) {
+    std::lock_guard<std::mutex> lock(flights_mutex);
+    wait_wrapper = wrapper;
+  }
+
   const std::string
   VirtualArray::cache_key() const {
     return cache_key_;
@@ -294,6 +488,11 @@ namespace awkward {
     return "VirtualArray";
   }
 
+  ContentKind
+  VirtualArray::kind() const {
+    return ContentKind::VirtualArray;
+  }
+
   void
   VirtualArray::setidentities(const IdentitiesPtr& identities) {
     throw std::runtime_error("FIXME: VirtualArray::setidentities(identities)");
@@ -367,6 +566,13 @@ namespace awkward {
     return array().get()->tojson_part(builder, include_beginendlist);
   }
 
+  void
+  VirtualArray::tojson_elements(ToJson& builder,
+                                int64_t start,
+                                int64_t stop) const {
+    array().get()->tojson_elements(builder, start, stop);
+  }
+
   void
   VirtualArray::nbytes_part(std::map<size_t, int64_t>& largest) const { }
 
@@ -395,6 +601,11 @@ namespace awkward {
     return array().get()->deep_copy(copyarrays, copyindexes, copyidentities);
   }
 
+  const ContentPtr
+  VirtualArray::pack() const {
+    return array().get()->pack();
+  }
+
   void
   VirtualArray::check_for_iteration() const { }
 
@@ -477,7 +688,10 @@ namespace awkward {
     Slice slice;
     slice.append(SliceField(key));
     slice.become_sealed();
-    FormPtr form(nullptr);
+    FormPtr form = generator_.get()->form();
+    if (form.get() != nullptr) {
+      form = form.get()->getitem_field(key);
+    }
     ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                  form, generator_.get()->length(), shallow_copy(), slice);
     ArrayCachePtr cache(nullptr);
@@ -497,7 +711,10 @@ namespace awkward {
     Slice slice;
     slice.append(SliceFields(keys));
     slice.become_sealed();
-    FormPtr form(nullptr);
+    FormPtr form = generator_.get()->form();
+    if (form.get() != nullptr) {
+      form = form.get()->getitem_fields(keys);
+    }
     ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                  form, generator_.get()->length(), shallow_copy(), slice);
     ArrayCachePtr cache(nullptr);
@@ -514,19 +731,42 @@ namespace awkward {
       return peek.get()->carry(carry);
     }
 
-    Slice slice;
-    std::vector<int64_t> shape({ carry.length() });
-    std::vector<int64_t> strides({ 1 });
-    slice.append(SliceArray64(carry, shape, strides, false));
-    slice.become_sealed();
-    FormPtr form(nullptr);
-    ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
-                 form, carry.length(), shallow_copy(), slice);
-    ArrayCachePtr cache(nullptr);
-    return std::make_shared<VirtualArray>(Identities::none(),
-                                          parameters_,
-                                          generator,
-                                          cache);
+    auto slice_of = [this](const ContentPtr& source,
+                           const Index64& nextcarry) -> ContentPtr {
+      Slice slice;
+      std::vector<int64_t> shape({ nextcarry.length() });
+      std::vector<int64_t> strides({ 1 });
+      slice.append(SliceArray64(nextcarry, shape, strides, false));
+      slice.become_sealed();
+      FormPtr form(nullptr);
+      ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
+                   form, nextcarry.length(), source, slice);
+      ArrayCachePtr cache(nullptr);
+      return std::make_shared<VirtualArray>(Identities::none(),
+                                            parameters_,
+                                            generator,
+                                            cache);
+    };
+
+    // If this array is itself an unmaterialized carry of another, compose
+    // the two carries so that the other is only gathered once.
+    if (SliceGenerator* previous =
+        dynamic_cast<SliceGenerator*>(generator_.get())) {
+      Slice previous_slice = previous->slice();
+      if (previous_slice.length() == 1) {
+        SliceItemPtr head = previous_slice.head();
+        if (head.get()->kind() == SliceKind::array64) {
+          SliceArray64* array = static_cast<SliceArray64*>(head.get());
+          if (array->ndim() == 1  &&
+              array->strides()[0] == 1  &&
+              array->index().length() == array->length()) {
+            return slice_of(previous->content(),
+                            array->index().getitem_carry_64(carry));
+          }
+        }
+      }
+    }
+    return slice_of(shallow_copy(), carry);
   }
 
   const std::string
@@ -658,8 +898,8 @@ namespace awkward {
     if (where.length() == 1) {
       SliceItemPtr head = where.head();
 
-      if (SliceRange* range =
-          dynamic_cast<SliceRange*>(head.get())) {
+      if (head.get()->kind() == SliceKind::range) {
+        SliceRange* range = static_cast<SliceRange*>(head.get());
         if (range->step() == 0) {
             throw std::invalid_argument("slice step cannot be zero");
         }
@@ -684,7 +924,11 @@ namespace awkward {
           else {
             length = 0;
           }
+          // A unit-step range keeps the Form, as in getitem_range_nowrap.
           FormPtr form(nullptr);
+          if (range->step() == 1) {
+            form = generator_.get()->form();
+          }
           ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                      form, length, shallow_copy(), where);
           ArrayCachePtr cache(nullptr);
@@ -698,8 +942,7 @@ namespace awkward {
         }
       }
 
-      else if (SliceEllipsis* ellipsis =
-               dynamic_cast<SliceEllipsis*>(head.get())) {
+      else if (head.get()->kind() == SliceKind::ellipsis) {
         FormPtr form(nullptr);
         ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                      form, generator_.get()->length(), shallow_copy(), where);
@@ -710,8 +953,7 @@ namespace awkward {
                                               cache);
       }
 
-      else if (SliceNewAxis* newaxis =
-               dynamic_cast<SliceNewAxis*>(head.get())) {
+      else if (head.get()->kind() == SliceKind::newaxis) {
         FormPtr form(nullptr);
         ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                      form, 1, shallow_copy(), where);
@@ -722,8 +964,8 @@ namespace awkward {
                                               cache);
       }
 
-      else if (SliceArray64* slicearray =
-               dynamic_cast<SliceArray64*>(head.get())) {
+      else if (head.get()->kind() == SliceKind::array64) {
+        SliceArray64* slicearray = static_cast<SliceArray64*>(head.get());
         FormPtr form(nullptr);
         ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                      form, slicearray->length(), shallow_copy(), where);
@@ -734,14 +976,12 @@ namespace awkward {
                                               cache);
       }
 
-      else if (SliceField* field =
-               dynamic_cast<SliceField*>(head.get())) {
-        return getitem_field(field->key());
+      else if (head.get()->kind() == SliceKind::field) {
+        return getitem_field(static_cast<SliceField*>(head.get())->key());
       }
 
-      else if (SliceFields* fields =
-               dynamic_cast<SliceFields*>(head.get())) {
-        return getitem_fields(fields->keys());
+      else if (head.get()->kind() == SliceKind::fields) {
+        return getitem_fields(static_cast<SliceFields*>(head.get())->keys());
       }
 
       else {
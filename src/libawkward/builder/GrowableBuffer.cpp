@@ -18,7 +18,7 @@ namespace awkward {
     if (actual < (size_t)minreserve) {
       actual = (size_t)minreserve;
     }
-    std::shared_ptr<T> ptr(new T[actual], util::array_deleter<T>());
+    std::shared_ptr<T> ptr = util::allocate<T>((int64_t)actual);
     return GrowableBuffer(options, ptr, 0, (int64_t)actual);
   }
 
@@ -43,8 +43,8 @@ namespace awkward {
     if (actual < (size_t)length) {
       actual = (size_t)length;
     }
-    T* rawptr = new T[(size_t)actual];
-    std::shared_ptr<T> ptr(rawptr, util::array_deleter<T>());
+    std::shared_ptr<T> ptr = util::allocate<T>((int64_t)actual);
+    T* rawptr = ptr.get();
     for (int64_t i = 0;  i < length;  i++) {
       rawptr[i] = (T)i;
     }
@@ -58,21 +58,36 @@ namespace awkward {
                                     int64_t reserved)
       : options_(options)
       , ptr_(ptr)
+      , offset_(0)
       , length_(length)
       , reserved_(reserved) { }
 
   template <typename T>
   GrowableBuffer<T>::GrowableBuffer(const ArrayBuilderOptions& options)
       : GrowableBuffer(options,
-                       std::shared_ptr<T>(new T[(size_t)options.initial()],
-                                          util::array_deleter<T>()),
+                       util::allocate<T>(options.initial()),
                        0,
                        options.initial()) { }
 
   template <typename T>
   const std::shared_ptr<T>
   GrowableBuffer<T>::ptr() const {
-    return ptr_;
+    if (pages_.empty()) {
+      return ptr_;
+    }
+    return concatenated();
+  }
+
+  template <typename T>
+  void
+  GrowableBuffer<T>::join() {
+    if (!pages_.empty()) {
+      ptr_ = concatenated();
+      pages_.clear();
+      pagelengths_.clear();
+      offset_ = 0;
+      reserved_ = length_;
+    }
   }
 
   template <typename T>
@@ -87,6 +102,9 @@ namespace awkward {
     if (newlength > reserved_) {
       set_reserved(newlength);
     }
+    else if (newlength < offset_) {
+      join();
+    }
     length_ = newlength;
   }
 
@@ -100,41 +118,110 @@ namespace awkward {
   void
   GrowableBuffer<T>::set_reserved(int64_t minreserved) {
     if (minreserved > reserved_) {
-      std::shared_ptr<T> ptr(new T[(size_t)minreserved],
-                             util::array_deleter<T>());
-      memcpy(ptr.get(), ptr_.get(), (size_t)(length_ * sizeof(T)));
-      ptr_ = ptr;
-      reserved_ = minreserved;
+      if (options_.paged()) {
+        add_page(minreserved);
+      }
+      else {
+        std::shared_ptr<T> ptr = util::allocate<T>(minreserved);
+        memcpy(ptr.get(), ptr_.get(), (size_t)(length_ * sizeof(T)));
+        ptr_ = ptr;
+        reserved_ = minreserved;
+      }
     }
   }
 
   template <typename T>
   void
   GrowableBuffer<T>::clear() {
+    pages_.clear();
+    pagelengths_.clear();
+    offset_ = 0;
     length_ = 0;
     reserved_ = options_.initial();
-    ptr_ = std::shared_ptr<T>(new T[(size_t)options_.initial()],
-                              util::array_deleter<T>());
+    ptr_ = util::allocate<T>(options_.initial());
   }
 
   template <typename T>
   void
   GrowableBuffer<T>::append(T datum) {
     if (length_ == reserved_) {
-      set_reserved((int64_t)ceil(reserved_ * options_.resize()));
+      if (options_.paged()) {
+        add_page(length_ + 1);
+      }
+      else {
+        set_reserved((int64_t)ceil(reserved_ * options_.resize()));
+      }
     }
-    ptr_.get()[length_] = datum;
+    ptr_.get()[length_ - offset_] = datum;
     length_++;
   }
 
   template <typename T>
   T
   GrowableBuffer<T>::getitem_at_nowrap(int64_t at) const {
+    if (at >= offset_) {
+      return ptr_.get()[at - offset_];
+    }
+    for (size_t i = 0;  i < pages_.size();  i++) {
+      if (at < pagelengths_[i]) {
+        return pages_[i].get()[at];
+      }
+      at -= pagelengths_[i];
+    }
     return ptr_.get()[at];
   }
 
+  template <typename T>
+  int64_t
+  GrowableBuffer<T>::numpages() const {
+    return (int64_t)pages_.size() + 1;
+  }
+
+  template <typename T>
+  const std::shared_ptr<T>
+  GrowableBuffer<T>::concatenated() const {
+    std::shared_ptr<T> ptr = util::allocate<T>(length_);
+    int64_t at = 0;
+    for (size_t i = 0;  i < pages_.size();  i++) {
+      memcpy(&ptr.get()[(size_t)at],
+             pages_[i].get(),
+             (size_t)(pagelengths_[i] * sizeof(T)));
+      at += pagelengths_[i];
+    }
+    memcpy(&ptr.get()[(size_t)at],
+           ptr_.get(),
+           (size_t)((length_ - offset_) * sizeof(T)));
+    return ptr;
+  }
+
+  template <typename T>
+  void
+  GrowableBuffer<T>::add_page(int64_t minreserved) {
+    int64_t pagesize = (int64_t)ceil((reserved_ - offset_) * options_.resize());
+    if (pagesize < minreserved - length_) {
+      pagesize = minreserved - length_;
+    }
+    if (length_ == offset_) {
+      // The current page is empty; replace it rather than keeping it.
+      ptr_ = util::allocate<T>(pagesize);
+    }
+    else {
+      pages_.push_back(ptr_);
+      pagelengths_.push_back(length_ - offset_);
+      ptr_ = util::allocate<T>(pagesize);
+      offset_ = length_;
+    }
+    reserved_ = offset_ + pagesize;
+  }
+
   template class EXPORT_SYMBOL GrowableBuffer<int8_t>;
-  template class EXPORT_SYMBOL GrowableBuffer<uint8_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<int16_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<int32_t>;
   template class EXPORT_SYMBOL GrowableBuffer<int64_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<uint8_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<uint16_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<uint32_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<uint64_t>;
+  template class EXPORT_SYMBOL GrowableBuffer<float>;
   template class EXPORT_SYMBOL GrowableBuffer<double>;
 }
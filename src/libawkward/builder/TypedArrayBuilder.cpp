@@ -0,0 +1,1246 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/UnmaskedArray.h"
+#include "awkward/array/VirtualArray.h"
+
+#include "awkward/builder/TypedArrayBuilder.h"
+
+namespace awkward {
+  namespace {
+    uint64_t
+    fieldhash(const char* key, int64_t length) {
+      // FNV-1a
+      uint64_t out = 14695981039346656037ULL;
+      for (int64_t i = 0;  i < length;  i++) {
+        out = (out ^ (uint64_t)(uint8_t)key[i]) * 1099511628211ULL;
+      }
+      return out;
+    }
+
+    int64_t
+    inrange(int64_t x, int64_t min, int64_t max, const char* type) {
+      if (x < min  ||  x > max) {
+        throw std::invalid_argument(
+          std::string("integer ") + std::to_string(x)
+          + std::string(" is out of range for ") + type);
+      }
+      return x;
+    }
+
+    template <typename T>
+    const ContentPtr
+    numpyarray(const GrowableBuffer<T>& buffer,
+               int64_t length,
+               const FormPtr& form) {
+      NumpyForm* raw = dynamic_cast<NumpyForm*>(form.get());
+      std::vector<ssize_t> shape = { (ssize_t)length };
+      std::vector<ssize_t> strides = { (ssize_t)raw->itemsize() };
+      return std::make_shared<NumpyArray>(Identities::none(),
+                                          form.get()->parameters(),
+                                          buffer.ptr(),
+                                          shape,
+                                          strides,
+                                          0,
+                                          raw->itemsize(),
+                                          raw->format());
+    }
+
+    // A ListForm shares its offsets between starts and stops.
+    template <typename T>
+    const ContentPtr
+    listarray(const GrowableBuffer<T>& offsets,
+              int64_t length,
+              const FormPtr& form,
+              const ContentPtr& content) {
+      std::shared_ptr<T> ptr = offsets.ptr();
+      if (dynamic_cast<ListForm*>(form.get()) != nullptr) {
+        return std::make_shared<ListArrayOf<T>>(Identities::none(),
+                                                form.get()->parameters(),
+                                                IndexOf<T>(ptr, 0, length),
+                                                IndexOf<T>(ptr, 1, length),
+                                                content);
+      }
+      else {
+        return std::make_shared<ListOffsetArrayOf<T>>(
+          Identities::none(),
+          form.get()->parameters(),
+          IndexOf<T>(ptr, 0, length + 1),
+          content);
+      }
+    }
+  }
+
+  TypedArrayBuilder::TypedArrayBuilder(const FormPtr& form,
+                                       const ArrayBuilderOptions& options)
+      : form_(form)
+      , options_(options) {
+    compile(form);
+  }
+
+  const std::string
+  TypedArrayBuilder::tostring() const {
+    util::TypeStrs typestrs;
+    typestrs["char"] = "char";
+    typestrs["string"] = "string";
+    std::stringstream out;
+    out << "<TypedArrayBuilder length=\"" << length() << "\" type=\""
+        << type(typestrs).get()->tostring() << "\"/>";
+    return out.str();
+  }
+
+  const FormPtr
+  TypedArrayBuilder::form() const {
+    return form_;
+  }
+
+  int64_t
+  TypedArrayBuilder::length() const {
+    return nodelength(0);
+  }
+
+  void
+  TypedArrayBuilder::clear() {
+    for (auto& buffer : int8s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : int16s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : int32s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : int64s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : uint8s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : uint16s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : uint32s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : uint64s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : float32s_) {
+      buffer.clear();
+    }
+    for (auto& buffer : float64s_) {
+      buffer.clear();
+    }
+    for (auto& node : nodes_) {
+      node.length = 0;
+      if (node.kind == Kind::string  ||  node.kind == Kind::list) {
+        append_integer(node.index, node.buffer, 0);
+      }
+    }
+    stack_.clear();
+  }
+
+  const TypePtr
+  TypedArrayBuilder::type(const util::TypeStrs& typestrs) const {
+    return form_.get()->type(typestrs);
+  }
+
+  const ContentPtr
+  TypedArrayBuilder::snapshot() const {
+    if (!stack_.empty()) {
+      throw std::invalid_argument(
+        "cannot take a snapshot while a list, tuple, or record is unfinished");
+    }
+    return snapshot(0);
+  }
+
+  void
+  TypedArrayBuilder::null() {
+    int64_t start = next("null");
+    int64_t n = start;
+    while (nodes_[(size_t)n].kind == Kind::unmasked) {
+      n = nodes_[(size_t)n].content;
+    }
+    Node& node = nodes_[(size_t)n];
+    switch (node.kind) {
+      case Kind::indexedoption:
+        append_integer(node.index, node.buffer, -1);
+        break;
+      case Kind::bytemasked:
+        fill_placeholder(node.content);
+        int8s_[(size_t)node.buffer].append(node.valid_when ? 0 : 1);
+        break;
+      case Kind::bitmasked:
+        fill_placeholder(node.content);
+        int8s_[(size_t)node.buffer].append(0);
+        break;
+      default:
+        mismatch("null", start);
+    }
+    node.length++;
+  }
+
+  void
+  TypedArrayBuilder::boolean(bool x) {
+    int64_t start = next("boolean");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind != Kind::boolean) {
+      mismatch("boolean", n);
+    }
+    uint8s_[(size_t)node.buffer].append(x);
+    fill_options(start);
+    node.length++;
+  }
+
+  void
+  TypedArrayBuilder::integer(int64_t x) {
+    int64_t start = next("integer");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    switch (node.kind) {
+      case Kind::int8:
+      case Kind::int16:
+      case Kind::int32:
+      case Kind::int64:
+      case Kind::uint8:
+      case Kind::uint16:
+      case Kind::uint32:
+      case Kind::uint64:
+      case Kind::float32:
+      case Kind::float64:
+        append_integer(node.kind, node.buffer, x);
+        break;
+      default:
+        mismatch("integer", n);
+    }
+    fill_options(start);
+    node.length++;
+  }
+
+  void
+  TypedArrayBuilder::real(double x) {
+    int64_t start = next("real");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind == Kind::float64) {
+      float64s_[(size_t)node.buffer].append(x);
+    }
+    else if (node.kind == Kind::float32) {
+      float32s_[(size_t)node.buffer].append((float)x);
+    }
+    else {
+      mismatch("real", n);
+    }
+    fill_options(start);
+    node.length++;
+  }
+
+  void
+  TypedArrayBuilder::bytestring(const char* x) {
+    string(x, -1, false);
+  }
+
+  void
+  TypedArrayBuilder::bytestring(const char* x, int64_t length) {
+    string(x, length, false);
+  }
+
+  void
+  TypedArrayBuilder::bytestring(const std::string& x) {
+    string(x.c_str(), (int64_t)x.length(), false);
+  }
+
+  void
+  TypedArrayBuilder::string(const char* x) {
+    string(x, -1, true);
+  }
+
+  void
+  TypedArrayBuilder::string(const char* x, int64_t length) {
+    string(x, length, true);
+  }
+
+  void
+  TypedArrayBuilder::string(const std::string& x) {
+    string(x.c_str(), (int64_t)x.length(), true);
+  }
+
+  void
+  TypedArrayBuilder::beginlist() {
+    int64_t start = next("beginlist");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind != Kind::list  &&  node.kind != Kind::regular) {
+      mismatch("beginlist", n);
+    }
+    fill_options(start);
+    stack_.push_back({ n, nodelength(node.content), -1 });
+  }
+
+  void
+  TypedArrayBuilder::endlist() {
+    if (stack_.empty()  ||
+        (nodes_[(size_t)stack_.back().node].kind != Kind::list  &&
+         nodes_[(size_t)stack_.back().node].kind != Kind::regular)) {
+      throw std::invalid_argument(
+        "called 'endlist' without 'beginlist' at the same level before it");
+    }
+    Frame& frame = stack_.back();
+    Node& node = nodes_[(size_t)frame.node];
+    int64_t contentlength = nodelength(node.content);
+    if (node.kind == Kind::list) {
+      append_integer(node.index, node.buffer, contentlength);
+    }
+    else if (contentlength - frame.start != node.size) {
+      throw std::invalid_argument(
+        std::string("regular list of size ") + std::to_string(node.size)
+        + std::string(" ended after ")
+        + std::to_string(contentlength - frame.start)
+        + std::string(" items"));
+    }
+    node.length++;
+    stack_.pop_back();
+  }
+
+  void
+  TypedArrayBuilder::begintuple(int64_t numfields) {
+    int64_t start = next("begintuple");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind != Kind::tuple  ||
+        numfields != (int64_t)node.contents.size()) {
+      mismatch("begintuple", n);
+    }
+    fill_options(start);
+    stack_.push_back({ n, 0, -1 });
+  }
+
+  void
+  TypedArrayBuilder::index(int64_t index) {
+    if (stack_.empty()  ||
+        nodes_[(size_t)stack_.back().node].kind != Kind::tuple) {
+      throw std::invalid_argument(
+        "called 'index' without 'begintuple' at the same level before it");
+    }
+    Frame& frame = stack_.back();
+    int64_t numfields =
+      (int64_t)nodes_[(size_t)frame.node].contents.size();
+    if (!(0 <= index  &&  index < numfields)) {
+      throw std::invalid_argument(
+        std::string("tuple index ") + std::to_string(index)
+        + std::string(" out of bounds for ") + std::to_string(numfields)
+        + std::string(" fields"));
+    }
+    frame.field = index;
+  }
+
+  void
+  TypedArrayBuilder::endtuple() {
+    endfields(Kind::tuple, "endtuple", "begintuple");
+  }
+
+  void
+  TypedArrayBuilder::beginrecord() {
+    beginrecord(nullptr);
+  }
+
+  void
+  TypedArrayBuilder::beginrecord(const char* name) {
+    int64_t start = next("beginrecord");
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind != Kind::record) {
+      mismatch("beginrecord", n);
+    }
+    if (name != nullptr) {
+      std::string expected = node.form.get()->parameter("__record__");
+      if (expected != std::string("null")  &&
+          expected != util::quote(name, true)) {
+        throw std::invalid_argument(
+          std::string("record named ") + util::quote(name, true)
+          + std::string(" does not match the Form's record ") + expected);
+      }
+    }
+    fill_options(start);
+    stack_.push_back({ n, 0, -1 });
+  }
+
+  void
+  TypedArrayBuilder::field(const char* key) {
+    field(key, (int64_t)std::strlen(key));
+  }
+
+  void
+  TypedArrayBuilder::field(const char* key, int64_t length) {
+    if (stack_.empty()  ||
+        nodes_[(size_t)stack_.back().node].kind != Kind::record) {
+      throw std::invalid_argument(
+        "called 'field' without 'beginrecord' at the same level before it");
+    }
+    Frame& frame = stack_.back();
+    const Node& node = nodes_[(size_t)frame.node];
+    size_t mask = node.lookup.size() - 1;
+    size_t slot = (size_t)fieldhash(key, length) & mask;
+    int64_t i;
+    while ((i = node.lookup[slot]) != -1) {
+      const std::string& candidate = node.keys[(size_t)i];
+      if ((int64_t)candidate.length() == length  &&
+          std::memcmp(candidate.data(), key, (size_t)length) == 0) {
+        frame.field = i;
+        return;
+      }
+      slot = (slot + 1) & mask;
+    }
+    throw std::invalid_argument(
+      std::string("no field ")
+      + util::quote(std::string(key, (size_t)length), true)
+      + std::string(" in the Form's record"));
+  }
+
+  void
+  TypedArrayBuilder::field(const std::string& key) {
+    field(key.c_str(), (int64_t)key.length());
+  }
+
+  void
+  TypedArrayBuilder::endrecord() {
+    endfields(Kind::record, "endrecord", "beginrecord");
+  }
+
+  int64_t
+  TypedArrayBuilder::compile(const FormPtr& form) {
+    if (VirtualForm* raw = dynamic_cast<VirtualForm*>(form.get())) {
+      if (!raw->has_form()) {
+        throw std::invalid_argument(
+          "TypedArrayBuilder needs a VirtualForm with a known Form");
+      }
+      return compile(raw->form());
+    }
+
+    int64_t out = (int64_t)nodes_.size();
+    nodes_.push_back(Node());
+    Node node;
+    node.form = form;
+    node.length = 0;
+    node.buffer = -1;
+    node.index = Kind::empty;
+    node.valid_when = true;
+    node.chars = -1;
+    node.content = -1;
+    node.size = 0;
+
+    if (NumpyForm* raw = dynamic_cast<NumpyForm*>(form.get())) {
+      std::string primitive = raw->primitive();
+      if (!raw->inner_shape().empty()) {
+        throw std::invalid_argument(
+          "TypedArrayBuilder does not support NumpyForm with inner_shape");
+      }
+      else if (primitive == std::string("bool")) {
+        node.kind = Kind::boolean;
+      }
+      else if (primitive == std::string("int8")) {
+        node.kind = Kind::int8;
+      }
+      else if (primitive == std::string("int16")) {
+        node.kind = Kind::int16;
+      }
+      else if (primitive == std::string("int32")) {
+        node.kind = Kind::int32;
+      }
+      else if (primitive == std::string("int64")) {
+        node.kind = Kind::int64;
+      }
+      else if (primitive == std::string("uint8")) {
+        node.kind = Kind::uint8;
+      }
+      else if (primitive == std::string("uint16")) {
+        node.kind = Kind::uint16;
+      }
+      else if (primitive == std::string("uint32")) {
+        node.kind = Kind::uint32;
+      }
+      else if (primitive == std::string("uint64")) {
+        node.kind = Kind::uint64;
+      }
+      else if (primitive == std::string("float32")) {
+        node.kind = Kind::float32;
+      }
+      else if (primitive == std::string("float64")) {
+        node.kind = Kind::float64;
+      }
+      else {
+        throw std::invalid_argument(
+          std::string("TypedArrayBuilder does not support primitive ")
+          + util::quote(primitive, true));
+      }
+      node.buffer = newbuffer(node.kind);
+    }
+
+    else if (dynamic_cast<ListOffsetForm*>(form.get())  ||
+             dynamic_cast<ListForm*>(form.get())) {
+      FormPtr content(nullptr);
+      Index::Form offsets;
+      if (ListOffsetForm* raw = dynamic_cast<ListOffsetForm*>(form.get())) {
+        content = raw->content();
+        offsets = raw->offsets();
+      }
+      else {
+        ListForm* listform = dynamic_cast<ListForm*>(form.get());
+        if (listform->starts() != listform->stops()) {
+          throw std::invalid_argument(
+            "TypedArrayBuilder needs a ListForm's starts and stops to have "
+            "the same type");
+        }
+        content = listform->content();
+        offsets = listform->starts();
+      }
+      switch (offsets) {
+        case Index::Form::i32:
+          node.index = Kind::int32;
+          break;
+        case Index::Form::u32:
+          node.index = Kind::uint32;
+          break;
+        case Index::Form::i64:
+          node.index = Kind::int64;
+          break;
+        default:
+          throw std::invalid_argument(
+            "TypedArrayBuilder needs list offsets to be i32, u32, or i64");
+      }
+      node.buffer = newbuffer(node.index);
+      append_integer(node.index, node.buffer, 0);
+      if (form.get()->parameter_equals("__array__", "\"string\"")  ||
+          form.get()->parameter_equals("__array__", "\"bytestring\"")) {
+        NumpyForm* chars = dynamic_cast<NumpyForm*>(content.get());
+        if (chars == nullptr  ||
+            chars->primitive() != std::string("uint8")) {
+          throw std::invalid_argument(
+            "TypedArrayBuilder needs strings to have uint8 content");
+        }
+        node.kind = Kind::string;
+        node.chars = newbuffer(Kind::uint8);
+      }
+      else {
+        node.kind = Kind::list;
+        node.content = compile(content);
+      }
+    }
+
+    else if (RegularForm* raw = dynamic_cast<RegularForm*>(form.get())) {
+      node.kind = Kind::regular;
+      node.size = raw->size();
+      node.content = compile(raw->content());
+    }
+
+    else if (RecordForm* raw = dynamic_cast<RecordForm*>(form.get())) {
+      node.kind = raw->istuple() ? Kind::tuple : Kind::record;
+      for (auto content : raw->contents()) {
+        node.contents.push_back(compile(content));
+      }
+      if (!raw->istuple()) {
+        node.keys = *raw->recordlookup().get();
+        size_t size = 2;
+        while (size < 2*node.keys.size()) {
+          size *= 2;
+        }
+        node.lookup = std::vector<int64_t>(size, -1);
+        for (size_t i = 0;  i < node.keys.size();  i++) {
+          const std::string& key = node.keys[i];
+          size_t slot = (size_t)fieldhash(key.data(), (int64_t)key.length())
+                        & (size - 1);
+          while (node.lookup[slot] != -1) {
+            slot = (slot + 1) & (size - 1);
+          }
+          node.lookup[slot] = (int64_t)i;
+        }
+      }
+    }
+
+    else if (IndexedOptionForm* raw =
+               dynamic_cast<IndexedOptionForm*>(form.get())) {
+      node.kind = Kind::indexedoption;
+      switch (raw->index()) {
+        case Index::Form::i32:
+          node.index = Kind::int32;
+          break;
+        case Index::Form::i64:
+          node.index = Kind::int64;
+          break;
+        default:
+          throw std::invalid_argument(
+            "TypedArrayBuilder needs an IndexedOptionForm's index to be i32 "
+            "or i64");
+      }
+      node.buffer = newbuffer(node.index);
+      node.content = compile(raw->content());
+    }
+    else if (ByteMaskedForm* raw =
+               dynamic_cast<ByteMaskedForm*>(form.get())) {
+      node.kind = Kind::bytemasked;
+      node.index = Kind::int8;
+      node.valid_when = raw->valid_when();
+      node.buffer = newbuffer(node.index);
+      node.content = compile(raw->content());
+    }
+    else if (BitMaskedForm* raw =
+               dynamic_cast<BitMaskedForm*>(form.get())) {
+      // One byte per item (1 if valid) until the snapshot packs them.
+      node.kind = Kind::bitmasked;
+      node.index = Kind::int8;
+      node.buffer = newbuffer(node.index);
+      node.content = compile(raw->content());
+    }
+    else if (UnmaskedForm* raw = dynamic_cast<UnmaskedForm*>(form.get())) {
+      node.kind = Kind::unmasked;
+      node.content = compile(raw->content());
+    }
+
+    else if (dynamic_cast<EmptyForm*>(form.get())) {
+      node.kind = Kind::empty;
+    }
+
+    else {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder does not support ")
+        + form.get()->tojson(false, false));
+    }
+
+    nodes_[(size_t)out] = node;
+    return out;
+  }
+
+  int64_t
+  TypedArrayBuilder::newbuffer(Kind kind) {
+    switch (kind) {
+      case Kind::int8:
+        int8s_.push_back(GrowableBuffer<int8_t>::empty(options_));
+        return (int64_t)int8s_.size() - 1;
+      case Kind::int16:
+        int16s_.push_back(GrowableBuffer<int16_t>::empty(options_));
+        return (int64_t)int16s_.size() - 1;
+      case Kind::int32:
+        int32s_.push_back(GrowableBuffer<int32_t>::empty(options_));
+        return (int64_t)int32s_.size() - 1;
+      case Kind::int64:
+        int64s_.push_back(GrowableBuffer<int64_t>::empty(options_));
+        return (int64_t)int64s_.size() - 1;
+      case Kind::boolean:
+      case Kind::uint8:
+        uint8s_.push_back(GrowableBuffer<uint8_t>::empty(options_));
+        return (int64_t)uint8s_.size() - 1;
+      case Kind::uint16:
+        uint16s_.push_back(GrowableBuffer<uint16_t>::empty(options_));
+        return (int64_t)uint16s_.size() - 1;
+      case Kind::uint32:
+        uint32s_.push_back(GrowableBuffer<uint32_t>::empty(options_));
+        return (int64_t)uint32s_.size() - 1;
+      case Kind::uint64:
+        uint64s_.push_back(GrowableBuffer<uint64_t>::empty(options_));
+        return (int64_t)uint64s_.size() - 1;
+      case Kind::float32:
+        float32s_.push_back(GrowableBuffer<float>::empty(options_));
+        return (int64_t)float32s_.size() - 1;
+      case Kind::float64:
+        float64s_.push_back(GrowableBuffer<double>::empty(options_));
+        return (int64_t)float64s_.size() - 1;
+      default:
+        throw std::runtime_error("TypedArrayBuilder node has no buffer");
+    }
+  }
+
+  void
+  TypedArrayBuilder::append_integer(Kind kind, int64_t buffer, int64_t x) {
+    size_t b = (size_t)buffer;
+    switch (kind) {
+      case Kind::boolean:
+        uint8s_[b].append((uint8_t)(x != 0));
+        break;
+      case Kind::int8:
+        int8s_[b].append((int8_t)inrange(x, INT8_MIN, INT8_MAX, "int8"));
+        break;
+      case Kind::int16:
+        int16s_[b].append(
+          (int16_t)inrange(x, INT16_MIN, INT16_MAX, "int16"));
+        break;
+      case Kind::int32:
+        int32s_[b].append(
+          (int32_t)inrange(x, INT32_MIN, INT32_MAX, "int32"));
+        break;
+      case Kind::int64:
+        int64s_[b].append(x);
+        break;
+      case Kind::uint8:
+        uint8s_[b].append((uint8_t)inrange(x, 0, UINT8_MAX, "uint8"));
+        break;
+      case Kind::uint16:
+        uint16s_[b].append((uint16_t)inrange(x, 0, UINT16_MAX, "uint16"));
+        break;
+      case Kind::uint32:
+        uint32s_[b].append((uint32_t)inrange(x, 0, UINT32_MAX, "uint32"));
+        break;
+      case Kind::uint64:
+        uint64s_[b].append((uint64_t)inrange(x, 0, INT64_MAX, "uint64"));
+        break;
+      case Kind::float32:
+        float32s_[b].append((float)x);
+        break;
+      case Kind::float64:
+        float64s_[b].append((double)x);
+        break;
+      default:
+        throw std::runtime_error("TypedArrayBuilder node is not a number");
+    }
+  }
+
+  int64_t
+  TypedArrayBuilder::next(const char* command) const {
+    if (stack_.empty()) {
+      return 0;
+    }
+    const Frame& frame = stack_.back();
+    const Node& node = nodes_[(size_t)frame.node];
+    if (node.kind == Kind::list  ||  node.kind == Kind::regular) {
+      return node.content;
+    }
+    if (frame.field == -1) {
+      throw std::invalid_argument(
+        std::string("called '") + command
+        + std::string(node.kind == Kind::tuple
+                          ? "' in a tuple without 'index'"
+                          : "' in a record without 'field'"));
+    }
+    return node.contents[(size_t)frame.field];
+  }
+
+  int64_t
+  TypedArrayBuilder::resolve(int64_t node) const {
+    while (nodes_[(size_t)node].kind == Kind::indexedoption  ||
+           nodes_[(size_t)node].kind == Kind::bytemasked  ||
+           nodes_[(size_t)node].kind == Kind::bitmasked  ||
+           nodes_[(size_t)node].kind == Kind::unmasked) {
+      node = nodes_[(size_t)node].content;
+    }
+    return node;
+  }
+
+  void
+  TypedArrayBuilder::fill_options(int64_t node) {
+    while (true) {
+      Node& current = nodes_[(size_t)node];
+      switch (current.kind) {
+        case Kind::indexedoption:
+          append_integer(current.index,
+                         current.buffer,
+                         nodelength(current.content));
+          current.length++;
+          break;
+        case Kind::bytemasked:
+          int8s_[(size_t)current.buffer].append(current.valid_when ? 1 : 0);
+          current.length++;
+          break;
+        case Kind::bitmasked:
+          int8s_[(size_t)current.buffer].append(1);
+          current.length++;
+          break;
+        case Kind::unmasked:
+          break;
+        default:
+          return;
+      }
+      node = current.content;
+    }
+  }
+
+  void
+  TypedArrayBuilder::fill_placeholder(int64_t n) {
+    Node& node = nodes_[(size_t)n];
+    switch (node.kind) {
+      case Kind::empty:
+        throw std::invalid_argument(
+          "cannot fill a missing value over an EmptyForm");
+      case Kind::string:
+        append_integer(node.index,
+                       node.buffer,
+                       uint8s_[(size_t)node.chars].length());
+        break;
+      case Kind::list:
+        append_integer(node.index, node.buffer, nodelength(node.content));
+        break;
+      case Kind::regular:
+        for (int64_t i = 0;  i < node.size;  i++) {
+          fill_placeholder(node.content);
+        }
+        break;
+      case Kind::record:
+      case Kind::tuple:
+        for (auto content : node.contents) {
+          fill_placeholder(content);
+        }
+        break;
+      case Kind::indexedoption:
+        append_integer(node.index, node.buffer, -1);
+        break;
+      case Kind::bytemasked:
+        fill_placeholder(node.content);
+        int8s_[(size_t)node.buffer].append(node.valid_when ? 0 : 1);
+        break;
+      case Kind::bitmasked:
+        fill_placeholder(node.content);
+        int8s_[(size_t)node.buffer].append(0);
+        break;
+      case Kind::unmasked:
+        fill_placeholder(node.content);
+        return;
+      default:
+        append_integer(node.kind, node.buffer, 0);
+    }
+    node.length++;
+  }
+
+  int64_t
+  TypedArrayBuilder::nodelength(int64_t node) const {
+    while (nodes_[(size_t)node].kind == Kind::unmasked) {
+      node = nodes_[(size_t)node].content;
+    }
+    return nodes_[(size_t)node].length;
+  }
+
+  void
+  TypedArrayBuilder::mismatch(const char* command, int64_t node) const {
+    throw std::invalid_argument(
+      std::string("called '") + command + std::string("' where the Form is ")
+      + nodes_[(size_t)node].form.get()->tojson(false, false));
+  }
+
+  void
+  TypedArrayBuilder::string(const char* x, int64_t length, bool utf8) {
+    const char* command = utf8 ? "string" : "bytestring";
+    int64_t start = next(command);
+    int64_t n = resolve(start);
+    Node& node = nodes_[(size_t)n];
+    if (node.kind != Kind::string  ||
+        !node.form.get()->parameter_equals(
+          "__array__", utf8 ? "\"string\"" : "\"bytestring\"")) {
+      mismatch(command, n);
+    }
+    if (length < 0) {
+      length = (int64_t)std::strlen(x);
+    }
+    GrowableBuffer<uint8_t>& chars = uint8s_[(size_t)node.chars];
+    for (int64_t i = 0;  i < length;  i++) {
+      chars.append((uint8_t)x[i]);
+    }
+    append_integer(node.index, node.buffer, chars.length());
+    fill_options(start);
+    node.length++;
+  }
+
+  void
+  TypedArrayBuilder::endfields(Kind kind,
+                               const char* command,
+                               const char* begin) {
+    if (stack_.empty()  ||  nodes_[(size_t)stack_.back().node].kind != kind) {
+      throw std::invalid_argument(
+        std::string("called '") + command + std::string("' without '")
+        + begin + std::string("' at the same level before it"));
+    }
+    Node& node = nodes_[(size_t)stack_.back().node];
+    for (size_t i = 0;  i < node.contents.size();  i++) {
+      if (nodelength(node.contents[i]) != node.length + 1) {
+        throw std::invalid_argument(
+          std::string("called '") + command + std::string("' before filling ")
+          + (kind == Kind::tuple
+                 ? std::string("tuple index ") + std::to_string(i)
+                 : std::string("field ") + util::quote(node.keys[i], true)));
+      }
+    }
+    node.length++;
+    stack_.pop_back();
+  }
+
+  const ContentPtr
+  TypedArrayBuilder::snapshot(int64_t n) const {
+    const Node& node = nodes_[(size_t)n];
+    size_t b = (size_t)node.buffer;
+    util::Parameters parameters = node.form.get()->parameters();
+    switch (node.kind) {
+      case Kind::empty:
+        return std::make_shared<EmptyArray>(Identities::none(), parameters);
+
+      case Kind::boolean:
+      case Kind::uint8:
+        return numpyarray(uint8s_[b], node.length, node.form);
+      case Kind::int8:
+        return numpyarray(int8s_[b], node.length, node.form);
+      case Kind::int16:
+        return numpyarray(int16s_[b], node.length, node.form);
+      case Kind::int32:
+        return numpyarray(int32s_[b], node.length, node.form);
+      case Kind::int64:
+        return numpyarray(int64s_[b], node.length, node.form);
+      case Kind::uint16:
+        return numpyarray(uint16s_[b], node.length, node.form);
+      case Kind::uint32:
+        return numpyarray(uint32s_[b], node.length, node.form);
+      case Kind::uint64:
+        return numpyarray(uint64s_[b], node.length, node.form);
+      case Kind::float32:
+        return numpyarray(float32s_[b], node.length, node.form);
+      case Kind::float64:
+        return numpyarray(float64s_[b], node.length, node.form);
+
+      case Kind::string:
+      case Kind::list: {
+        ContentPtr content(nullptr);
+        if (node.kind == Kind::string) {
+          const GrowableBuffer<uint8_t>& chars = uint8s_[(size_t)node.chars];
+          std::vector<ssize_t> shape = { (ssize_t)chars.length() };
+          std::vector<ssize_t> strides = { (ssize_t)sizeof(uint8_t) };
+          ListOffsetForm* raw = dynamic_cast<ListOffsetForm*>(node.form.get());
+          content = std::make_shared<NumpyArray>(
+            Identities::none(),
+            raw != nullptr
+              ? raw->content().get()->parameters()
+              : dynamic_cast<ListForm*>(node.form.get())
+                  ->content().get()->parameters(),
+            chars.ptr(),
+            shape,
+            strides,
+            0,
+            sizeof(uint8_t),
+            "B");
+        }
+        else {
+          content = snapshot(node.content);
+        }
+        switch (node.index) {
+          case Kind::int32:
+            return listarray(int32s_[b], node.length, node.form, content);
+          case Kind::uint32:
+            return listarray(uint32s_[b], node.length, node.form, content);
+          default:
+            return listarray(int64s_[b], node.length, node.form, content);
+        }
+      }
+
+      case Kind::regular:
+        return std::make_shared<RegularArray>(Identities::none(),
+                                              parameters,
+                                              snapshot(node.content),
+                                              node.size);
+
+      case Kind::record:
+      case Kind::tuple: {
+        ContentPtrVec contents;
+        for (auto content : node.contents) {
+          contents.push_back(snapshot(content));
+        }
+        util::RecordLookupPtr recordlookup(nullptr);
+        if (node.kind == Kind::record) {
+          recordlookup =
+            std::make_shared<util::RecordLookup>(node.keys);
+        }
+        return std::make_shared<RecordArray>(Identities::none(),
+                                             parameters,
+                                             contents,
+                                             recordlookup,
+                                             node.length);
+      }
+
+      case Kind::indexedoption:
+        if (node.index == Kind::int32) {
+          return std::make_shared<IndexedOptionArray32>(
+            Identities::none(),
+            parameters,
+            Index32(int32s_[b].ptr(), 0, node.length),
+            snapshot(node.content));
+        }
+        else {
+          return std::make_shared<IndexedOptionArray64>(
+            Identities::none(),
+            parameters,
+            Index64(int64s_[b].ptr(), 0, node.length),
+            snapshot(node.content));
+        }
+
+      case Kind::bytemasked:
+        return std::make_shared<ByteMaskedArray>(
+          Identities::none(),
+          parameters,
+          Index8(int8s_[b].ptr(), 0, node.length),
+          snapshot(node.content),
+          node.valid_when);
+
+      case Kind::bitmasked: {
+        BitMaskedForm* raw = dynamic_cast<BitMaskedForm*>(node.form.get());
+        bool valid_when = raw->valid_when();
+        bool lsb_order = raw->lsb_order();
+        IndexU8 mask((node.length + 7) / 8);
+        uint8_t* bits = mask.ptr().get();
+        std::memset(bits, 0, (size_t)mask.length());
+        std::shared_ptr<int8_t> valid = int8s_[b].ptr();
+        for (int64_t i = 0;  i < node.length;  i++) {
+          if ((valid.get()[i] != 0) == valid_when) {
+            bits[i / 8] |= (uint8_t)(lsb_order ? 1 << (i % 8)
+                                               : 128 >> (i % 8));
+          }
+        }
+        return std::make_shared<BitMaskedArray>(Identities::none(),
+                                                parameters,
+                                                mask,
+                                                snapshot(node.content),
+                                                valid_when,
+                                                node.length,
+                                                lsb_order);
+      }
+
+      case Kind::unmasked:
+        return std::make_shared<UnmaskedArray>(Identities::none(),
+                                               parameters,
+                                               snapshot(node.content));
+
+      default:
+        throw std::runtime_error("unrecognized TypedArrayBuilder node");
+    }
+  }
+}
+
+////////// extern C interface
+
+uint8_t awkward_TypedArrayBuilder_new(const char* form,
+                                      int64_t initial,
+                                      double resize,
+                                      void** result) {
+  try {
+    *result = new awkward::TypedArrayBuilder(
+      awkward::Form::fromjson(form),
+      awkward::ArrayBuilderOptions(initial, resize));
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_delete(void* typedarraybuilder) {
+  delete reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_length(void* typedarraybuilder,
+                                         int64_t* result) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    *result = obj->length();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_clear(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->clear();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_null(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->null();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_boolean(void* typedarraybuilder,
+                                          bool x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->boolean(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_integer(void* typedarraybuilder,
+                                          int64_t x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->integer(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_real(void* typedarraybuilder,
+                                       double x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->real(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_bytestring_length(void* typedarraybuilder,
+                                                    const char* x,
+                                                    int64_t length) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->bytestring(x, length);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_string_length(void* typedarraybuilder,
+                                                const char* x,
+                                                int64_t length) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->string(x, length);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_beginlist(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->beginlist();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endlist(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endlist();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_begintuple(void* typedarraybuilder,
+                                             int64_t numfields) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->begintuple(numfields);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_index(void* typedarraybuilder,
+                                        int64_t index) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->index(index);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endtuple(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endtuple();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_beginrecord(void* typedarraybuilder,
+                                              const char* name) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->beginrecord(name);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_field(void* typedarraybuilder,
+                                        const char* key) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->field(key);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endrecord(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endrecord();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
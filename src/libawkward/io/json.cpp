@@ -1,5 +1,12 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "rapidjson/document.h"
 #include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
@@ -7,12 +14,16 @@
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/filewritestream.h"
+#include "rapidjson/memorystream.h"
 #include "rapidjson/error/en.h"
 
 #include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/TypedArrayBuilder.h"
 #include "awkward/Content.h"
+#include "awkward/partition/IrregularlyPartitionedArray.h"
 
 #include "awkward/io/json.h"
+#include "awkward/io/json_simdjson.h"
 
 namespace rj = rapidjson;
 
@@ -267,7 +278,7 @@ namespace awkward {
   class ToJsonFile::Impl {
   public:
     Impl(FILE* destination, int64_t maxdecimals, int64_t buffersize)
-        : buffer_(new char[(size_t)buffersize], util::array_deleter<char>())
+        : buffer_(util::allocate<char>(buffersize))
         , stream_(destination,
                   buffer_.get(),
                   ((size_t)buffersize)*sizeof(char))
@@ -365,7 +376,7 @@ namespace awkward {
   class ToJsonPrettyFile::Impl {
   public:
     Impl(FILE* destination, int64_t maxdecimals, int64_t buffersize)
-        : buffer_(new char[(size_t)buffersize], util::array_deleter<char>())
+        : buffer_(util::allocate<char>(buffersize))
         , stream_(destination,
                   buffer_.get(),
                   ((size_t)buffersize)*sizeof(char))
@@ -464,15 +475,24 @@ namespace awkward {
 
   ////////// reading from JSON
 
-  class Handler: public rj::BaseReaderHandler<rj::UTF8<>, Handler> {
-  public:
-    Handler(const ArrayBuilderOptions& options)
-        : builder_(options)
-        , depth_(0) { }
+  void
+  JsonField(ArrayBuilder& builder, const char* key, int64_t length) {
+    builder.field_check(key);
+  }
 
-    const ContentPtr snapshot() const {
-      return builder_.snapshot();
-    }
+  void
+  JsonField(TypedArrayBuilder& builder, const char* key, int64_t length) {
+    builder.field(key, length);
+  }
+
+  template <typename BUILDER>
+  class Handler: public rj::BaseReaderHandler<rj::UTF8<>, Handler<BUILDER>> {
+  public:
+    // With `lines`, each top-level value is one item, rather than a
+    // top-level array being the array and a top-level object a record.
+    Handler(BUILDER& builder, bool lines = false)
+        : builder_(builder)
+        , depth_(lines ? 1 : 0) { }
 
     bool Null()               { builder_.null();              return true; }
     bool Bool(bool x)         { builder_.boolean(x);          return true; }
@@ -528,51 +548,429 @@ namespace awkward {
 
     bool
     Key(const char* str, rj::SizeType length, bool copy) {
-      builder_.field_check(str);
+      JsonField(builder_, str, (int64_t)length);
       return true;
     }
 
   private:
-    ArrayBuilder builder_;
+    BUILDER& builder_;
     int64_t depth_;
   };
 
-  const ContentPtr
-  FromJsonString(const char* source, const ArrayBuilderOptions& options) {
-    Handler handler(options);
-    rj::Reader reader;
-    rj::StringStream stream(source);
-    if (reader.Parse(stream, handler)) {
-      return handler.snapshot();
+  namespace {
+    void
+    check_parser(JsonParser parser) {
+      if (!JsonParserAvailable(parser)) {
+        throw std::invalid_argument(
+          "awkward1 was compiled without simdjson; "
+          "recompile with the simdjson submodule and BUILD_SIMDJSON=ON");
+      }
     }
-    else {
-      throw std::invalid_argument(
-        std::string("JSON error at char ")
-        + std::to_string(reader.GetErrorOffset()) + std::string(": ")
-        + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+
+    template <typename BUILDER>
+    void
+    fromjson_string(BUILDER& builder, const char* source, JsonParser parser) {
+      check_parser(parser);
+#ifdef AWKWARD_SIMDJSON
+      if (parser == JsonParser::simdjson) {
+        FromSimdjsonString(builder, source, strlen(source));
+        return;
+      }
+#endif
+      Handler<BUILDER> handler(builder);
+      rj::Reader reader;
+      rj::StringStream stream(source);
+      if (!reader.Parse(stream, handler)) {
+        throw std::invalid_argument(
+          std::string("JSON error at char ")
+          + std::to_string(reader.GetErrorOffset()) + std::string(": ")
+          + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+      }
+    }
+
+    template <typename BUILDER>
+    void
+    fromjson_file(BUILDER& builder,
+                  FILE* source,
+                  int64_t buffersize,
+                  JsonParser parser) {
+      check_parser(parser);
+#ifdef AWKWARD_SIMDJSON
+      if (parser == JsonParser::simdjson) {
+        FromSimdjsonFile(builder, source, buffersize);
+        return;
+      }
+#endif
+      std::shared_ptr<char> buffer = util::allocate<char>(buffersize);
+      Handler<BUILDER> handler(builder);
+      rj::Reader reader;
+      rj::FileReadStream stream(source,
+                                buffer.get(),
+                                ((size_t)buffersize)*sizeof(char));
+      if (!reader.Parse(stream, handler)) {
+        throw std::invalid_argument(
+          std::string("JSON error at char ")
+          + std::to_string(reader.GetErrorOffset()) + std::string(": ")
+          + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+      }
     }
   }
 
+  bool
+  JsonParserAvailable(JsonParser parser) {
+#ifdef AWKWARD_SIMDJSON
+    return true;
+#else
+    return parser == JsonParser::rapidjson;
+#endif
+  }
+
+  const ContentPtr
+  FromJsonString(const char* source,
+                 const ArrayBuilderOptions& options,
+                 JsonParser parser) {
+    ArrayBuilder builder(options);
+    fromjson_string(builder, source, parser);
+    return builder.snapshot();
+  }
+
+  const ContentPtr
+  FromJsonString(const char* source,
+                 const FormPtr& form,
+                 const ArrayBuilderOptions& options,
+                 JsonParser parser) {
+    TypedArrayBuilder builder(form, options);
+    fromjson_string(builder, source, parser);
+    return builder.snapshot();
+  }
+
+  const ContentPtr
+  FromJsonFile(FILE* source,
+               const ArrayBuilderOptions& options,
+               int64_t buffersize,
+               JsonParser parser) {
+    ArrayBuilder builder(options);
+    fromjson_file(builder, source, buffersize, parser);
+    return builder.snapshot();
+  }
+
   const ContentPtr
   FromJsonFile(FILE* source,
+               const FormPtr& form,
                const ArrayBuilderOptions& options,
-               int64_t buffersize) {
-    Handler handler(options);
-    rj::Reader reader;
-    std::shared_ptr<char> buffer(new char[(size_t)buffersize],
-                                 util::array_deleter<char>());
-    rj::FileReadStream stream(source,
-                              buffer.get(),
-                              ((size_t)buffersize)*sizeof(char));
-    if (reader.Parse(stream, handler)) {
-      return handler.snapshot();
+               int64_t buffersize,
+               JsonParser parser) {
+    TypedArrayBuilder builder(form, options);
+    fromjson_file(builder, source, buffersize, parser);
+    return builder.snapshot();
+  }
+
+  ////////// reading JSON Lines in parallel
+
+  namespace {
+    // Parses one chunk of whole lines into one partition. `offset` is the
+    // chunk's position in the whole input, for error messages.
+    const ContentPtr
+    fromjsonlines_chunk(const char* data,
+                        size_t length,
+                        int64_t offset,
+                        const ArrayBuilderOptions& options,
+                        JsonParser parser) {
+#ifdef AWKWARD_SIMDJSON
+      if (parser == JsonParser::simdjson) {
+        ArrayBuilder builder(options);
+        FromSimdjsonLines(builder, data, length, offset);
+        return builder.snapshot();
+      }
+#endif
+      ArrayBuilder builder(options);
+      Handler<ArrayBuilder> handler(builder, true);
+      rj::Reader reader;
+      rj::MemoryStream stream(data, length);
+      rj::SkipWhitespace(stream);
+      while (stream.Peek() != '\0') {
+        if (!reader.Parse<rj::kParseStopWhenDoneFlag>(stream, handler)) {
+          throw std::invalid_argument(
+            std::string("JSON error at char ")
+            + std::to_string(offset + (int64_t)reader.GetErrorOffset())
+            + std::string(": ")
+            + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+        }
+        rj::SkipWhitespace(stream);
+      }
+      return builder.snapshot();
     }
-    else {
-      throw std::invalid_argument(
-        std::string("JSON error at char ")
-        + std::to_string(reader.GetErrorOffset()) + std::string(": ")
-        + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+
+    // The caller's thread hands out chunks (reading them from a file, if
+    // need be) and `numthreads` workers parse them, each chunk with its
+    // own ArrayBuilder. At most 2*numthreads chunks wait to be parsed.
+    class JsonLinesReader {
+    public:
+      JsonLinesReader(const ArrayBuilderOptions& options,
+                      int64_t numthreads,
+                      JsonParser parser)
+          : options_(options)
+          , parser_(parser)
+          , maxqueued_(2*numthreads)
+          , done_(false)
+          , error_(nullptr) {
+        for (int64_t i = 0;  i < numthreads;  i++) {
+          workers_.push_back(std::thread(&JsonLinesReader::work, this));
+        }
+      }
+
+      ~JsonLinesReader() {
+        finish();
+      }
+
+      // `storage` keeps the chunk's data alive if it is not in the caller's
+      // string. Returns false if a chunk has failed and reading can stop.
+      bool
+      push(const char* data,
+           size_t length,
+           int64_t offset,
+           const std::shared_ptr<std::string>& storage) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this]() -> bool {
+          return (int64_t)queue_.size() < maxqueued_  ||  error_ != nullptr;
+        });
+        if (error_ != nullptr) {
+          return false;
+        }
+        queue_.push_back({ (int64_t)partitions_.size(),
+                           data,
+                           length,
+                           offset,
+                           storage });
+        partitions_.push_back(ContentPtr(nullptr));
+        lock.unlock();
+        waiting_.notify_one();
+        return true;
+      }
+
+      const PartitionedArrayPtr
+      snapshot() {
+        finish();
+        if (error_ != nullptr) {
+          std::rethrow_exception(error_);
+        }
+        if (partitions_.empty()) {
+          ArrayBuilder builder(options_);
+          partitions_.push_back(builder.snapshot());
+        }
+
+        std::vector<int64_t> stops;
+        int64_t stop = 0;
+        bool sameform = true;
+        FormPtr form = partitions_[0].get()->form(true);
+        for (auto partition : partitions_) {
+          stop += partition.get()->length();
+          stops.push_back(stop);
+          sameform = sameform  &&
+                     form.get()->equal(partition.get()->form(true),
+                                       true,
+                                       true,
+                                       false);
+        }
+        if (sameform) {
+          return std::make_shared<IrregularlyPartitionedArray>(partitions_,
+                                                               stops);
+        }
+
+        // Chunks that saw different types are merged into one array (with a
+        // union where the types can't be merged, as a single ArrayBuilder
+        // would make), which is then cut back into the same partitions
+        // (as views).
+        ContentPtrVec rest(partitions_.begin() + 1, partitions_.end());
+        ContentPtr merged = partitions_[0].get()->merge_many(rest, false);
+        ContentPtrVec partitions;
+        int64_t start = 0;
+        for (auto stop : stops) {
+          partitions.push_back(
+            merged.get()->getitem_range_nowrap(start, stop));
+          start = stop;
+        }
+        return std::make_shared<IrregularlyPartitionedArray>(partitions,
+                                                             stops);
+      }
+
+    private:
+      struct Chunk {
+        int64_t index;
+        const char* data;
+        size_t length;
+        int64_t offset;
+        std::shared_ptr<std::string> storage;
+      };
+
+      void
+      finish() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          done_ = true;
+        }
+        waiting_.notify_all();
+        for (auto& worker : workers_) {
+          worker.join();
+        }
+        workers_.clear();
+      }
+
+      void
+      work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+          waiting_.wait(lock, [this]() -> bool {
+            return !queue_.empty()  ||  done_;
+          });
+          if (queue_.empty()  ||  error_ != nullptr) {
+            return;
+          }
+          Chunk chunk = queue_.front();
+          queue_.pop_front();
+          lock.unlock();
+          ready_.notify_one();
+
+          ContentPtr out(nullptr);
+          std::exception_ptr error(nullptr);
+          try {
+            out = fromjsonlines_chunk(chunk.data,
+                                      chunk.length,
+                                      chunk.offset,
+                                      options_,
+                                      parser_);
+          }
+          catch (...) {
+            error = std::current_exception();
+          }
+          chunk.storage.reset();
+
+          lock.lock();
+          if (error != nullptr) {
+            if (error_ == nullptr) {
+              error_ = error;
+            }
+            ready_.notify_all();
+            return;
+          }
+          partitions_[(size_t)chunk.index] = out;
+        }
+      }
+
+      const ArrayBuilderOptions options_;
+      const JsonParser parser_;
+      const int64_t maxqueued_;
+      std::vector<std::thread> workers_;
+      std::mutex mutex_;
+      std::condition_variable waiting_;
+      std::condition_variable ready_;
+      std::deque<Chunk> queue_;
+      ContentPtrVec partitions_;
+      bool done_;
+      std::exception_ptr error_;
+    };
+
+    void
+    check_fromjsonlines(int64_t chunksize, int64_t& numthreads) {
+      if (chunksize <= 0) {
+        throw std::invalid_argument("chunksize must be positive");
+      }
+      if (numthreads < 0) {
+        throw std::invalid_argument("numthreads must be non-negative");
+      }
+      if (numthreads == 0) {
+        numthreads = (int64_t)std::thread::hardware_concurrency();
+        if (numthreads == 0) {
+          numthreads = 1;
+        }
+      }
+    }
+  }
+
+  const PartitionedArrayPtr
+  FromJsonLines(const char* source,
+                const ArrayBuilderOptions& options,
+                int64_t chunksize,
+                int64_t numthreads,
+                JsonParser parser) {
+    check_parser(parser);
+    check_fromjsonlines(chunksize, numthreads);
+    JsonLinesReader reader(options, numthreads, parser);
+    size_t length = strlen(source);
+    size_t start = 0;
+    while (start < length) {
+      // Each chunk ends just after the first newline at or past chunksize.
+      size_t stop = start + (size_t)chunksize;
+      if (stop >= length) {
+        stop = length;
+      }
+      else {
+        const char* newline = reinterpret_cast<const char*>(
+          memchr(source + stop - 1, '\n', length - stop + 1));
+        stop = newline == nullptr ? length : (size_t)(newline - source) + 1;
+      }
+      if (!reader.push(source + start,
+                       stop - start,
+                       (int64_t)start,
+                       std::shared_ptr<std::string>(nullptr))) {
+        break;
+      }
+      start = stop;
+    }
+    return reader.snapshot();
+  }
+
+  const PartitionedArrayPtr
+  FromJsonLinesFile(FILE* source,
+                    const ArrayBuilderOptions& options,
+                    int64_t chunksize,
+                    int64_t numthreads,
+                    JsonParser parser) {
+    check_parser(parser);
+    check_fromjsonlines(chunksize, numthreads);
+    JsonLinesReader reader(options, numthreads, parser);
+    std::shared_ptr<char> buffer = util::allocate<char>(chunksize);
+    std::string pending;
+    int64_t offset = 0;
+    while (true) {
+      size_t numread = fread(buffer.get(),
+                             sizeof(char),
+                             (size_t)chunksize,
+                             source);
+      if (numread == 0) {
+        if (ferror(source)) {
+          throw std::invalid_argument("JSON Lines file could not be read");
+        }
+        break;
+      }
+      pending.append(buffer.get(), numread);
+      if ((int64_t)pending.length() < chunksize) {
+        continue;
+      }
+      // Cut after the last complete line; a line longer than chunksize
+      // keeps accumulating until its newline has been read.
+      size_t newline = pending.rfind('\n');
+      if (newline == std::string::npos) {
+        continue;
+      }
+      std::shared_ptr<std::string> chunk =
+        std::make_shared<std::string>(pending, 0, newline + 1);
+      pending.erase(0, newline + 1);
+      int64_t chunkoffset = offset;
+      offset += (int64_t)chunk.get()->length();
+      if (!reader.push(chunk.get()->data(),
+                       chunk.get()->length(),
+                       chunkoffset,
+                       chunk)) {
+        pending.clear();
+        break;
+      }
+    }
+    if (!pending.empty()) {
+      std::shared_ptr<std::string> chunk =
+        std::make_shared<std::string>(std::move(pending));
+      reader.push(chunk.get()->data(), chunk.get()->length(), offset, chunk);
     }
-    return handler.snapshot();
+    return reader.snapshot();
   }
 }
@@ -0,0 +1,202 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "simdjson.h"
+
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/TypedArrayBuilder.h"
+
+#include "awkward/io/json_simdjson.h"
+
+namespace awkward {
+  namespace {
+    template <typename BUILDER>
+    void
+    fill_tape(BUILDER& builder, const simdjson::dom::element& element) {
+      switch (element.type()) {
+        case simdjson::dom::element_type::ARRAY:
+          builder.beginlist();
+          for (auto item : element.get_array().value_unsafe()) {
+            fill_tape(builder, item);
+          }
+          builder.endlist();
+          break;
+        case simdjson::dom::element_type::OBJECT: {
+          simdjson::dom::object object = element.get_object().value_unsafe();
+          builder.beginrecord();
+          for (auto it = object.begin();  it != object.end();  ++it) {
+            JsonField(builder, it.key_c_str(), (int64_t)it.key_length());
+            fill_tape(builder, it.value());
+          }
+          builder.endrecord();
+          break;
+        }
+        case simdjson::dom::element_type::INT64:
+          builder.integer(element.get_int64().value_unsafe());
+          break;
+        case simdjson::dom::element_type::UINT64:
+          builder.integer((int64_t)element.get_uint64().value_unsafe());
+          break;
+        case simdjson::dom::element_type::DOUBLE:
+          builder.real(element.get_double().value_unsafe());
+          break;
+        case simdjson::dom::element_type::STRING: {
+          std::string_view x = element.get_string().value_unsafe();
+          builder.string(x.data(), (int64_t)x.length());
+          break;
+        }
+        case simdjson::dom::element_type::BOOL:
+          builder.boolean(element.get_bool().value_unsafe());
+          break;
+        case simdjson::dom::element_type::NULL_VALUE:
+          builder.null();
+          break;
+      }
+    }
+
+    void
+    check_simdjson(simdjson::error_code error) {
+      if (error != simdjson::SUCCESS) {
+        throw std::invalid_argument(
+          std::string("JSON error: ") + simdjson::error_message(error));
+      }
+    }
+
+    // Same top-level conventions as Handler: the items of a top-level array
+    // become the array, and a top-level object becomes a single record.
+    template <typename BUILDER>
+    void
+    fill_document(BUILDER& builder, simdjson::dom::element document) {
+      if (document.type() == simdjson::dom::element_type::ARRAY) {
+        for (auto item : document.get_array().value_unsafe()) {
+          fill_tape(builder, item);
+        }
+      }
+      else if (document.type() == simdjson::dom::element_type::OBJECT) {
+        builder.beginlist();
+        fill_tape(builder, document);
+        builder.endlist();
+      }
+      else {
+        fill_tape(builder, document);
+      }
+    }
+
+    template <typename BUILDER>
+    void
+    fill_string(BUILDER& builder, const char* source, size_t length) {
+      simdjson::dom::parser parser;
+      simdjson::dom::element document;
+      check_simdjson(parser.parse(source, length).get(document));
+      fill_document(builder, document);
+    }
+
+    // Reads the rest of a file straight into simdjson's padded buffer, so
+    // that the parser doesn't copy it again. A regular file is read in one
+    // go; a pipe, whose size isn't known, is read into a growing buffer.
+    template <typename BUILDER>
+    void
+    fill_file(BUILDER& builder, FILE* source, int64_t buffersize) {
+      size_t capacity = (size_t)buffersize;
+      long start = ftell(source);
+      if (start >= 0  &&  fseek(source, 0, SEEK_END) == 0) {
+        long end = ftell(source);
+        if (end >= start  &&  fseek(source, start, SEEK_SET) == 0) {
+          capacity = (size_t)(end - start);
+        }
+      }
+      simdjson::padded_string contents(capacity);
+      size_t length = 0;
+      while (true) {
+        if (length == capacity) {
+          int next = fgetc(source);
+          if (next == EOF) {
+            break;
+          }
+          capacity = 2*capacity + (size_t)buffersize;
+          simdjson::padded_string larger(capacity);
+          std::memcpy(larger.data(), contents.data(), length);
+          larger.data()[length++] = (char)next;
+          contents = std::move(larger);
+        }
+        size_t numread = fread(contents.data() + length,
+                               sizeof(char),
+                               capacity - length,
+                               source);
+        if (numread == 0) {
+          break;
+        }
+        length += numread;
+      }
+      if (ferror(source)) {
+        throw std::invalid_argument("JSON file could not be read");
+      }
+      // The buffer has at least SIMDJSON_PADDING bytes past length.
+      simdjson::dom::parser parser;
+      simdjson::dom::element document;
+      check_simdjson(parser.parse(contents.data(), length, false)
+                           .get(document));
+      fill_document(builder, document);
+    }
+  }
+
+  void
+  FromSimdjsonString(ArrayBuilder& builder,
+                     const char* source,
+                     size_t length) {
+    fill_string(builder, source, length);
+  }
+
+  void
+  FromSimdjsonString(TypedArrayBuilder& builder,
+                     const char* source,
+                     size_t length) {
+    fill_string(builder, source, length);
+  }
+
+  void
+  FromSimdjsonFile(ArrayBuilder& builder,
+                   FILE* source,
+                   int64_t buffersize) {
+    fill_file(builder, source, buffersize);
+  }
+
+  void
+  FromSimdjsonFile(TypedArrayBuilder& builder,
+                   FILE* source,
+                   int64_t buffersize) {
+    fill_file(builder, source, buffersize);
+  }
+
+  void
+  FromSimdjsonLines(ArrayBuilder& builder,
+                    const char* data,
+                    size_t length,
+                    int64_t offset) {
+    simdjson::padded_string padded(data, length);
+    simdjson::dom::parser parser;
+    simdjson::dom::document_stream stream;
+    simdjson::error_code error = parser.parse_many(
+      padded,
+      length < simdjson::dom::DEFAULT_BATCH_SIZE
+          ? simdjson::dom::DEFAULT_BATCH_SIZE : length).get(stream);
+    if (error == simdjson::SUCCESS) {
+      for (auto document : stream) {
+        simdjson::dom::element element;
+        if ((error = document.get(element)) != simdjson::SUCCESS) {
+          break;
+        }
+        fill_tape(builder, element);
+      }
+    }
+    if (error != simdjson::SUCCESS) {
+      throw std::invalid_argument(
+        std::string("JSON error in the lines starting at char ")
+        + std::to_string(offset) + std::string(": ")
+        + simdjson::error_message(error));
+    }
+  }
+}
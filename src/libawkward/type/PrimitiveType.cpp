@@ -94,7 +94,7 @@ namespace awkward {
 
   const ContentPtr
   PrimitiveType::empty() const {
-    std::shared_ptr<void> ptr(new uint8_t[0], util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr = util::allocate<uint8_t>(0);
     std::vector<ssize_t> shape({ 0 });
     std::vector<ssize_t> strides({ 0 });
     ssize_t itemsize;
@@ -41,6 +41,189 @@ namespace awkward {
       }
     }
 
+    namespace {
+      dtype
+      signed_of_size(int64_t itemsize) {
+        switch (itemsize) {
+          case 1: return dtype::int8;
+          case 2: return dtype::int16;
+          case 4: return dtype::int32;
+          case 8: return dtype::int64;
+          default: return dtype::NOT_PRIMITIVE;
+        }
+      }
+
+      dtype
+      unsigned_of_size(int64_t itemsize) {
+        switch (itemsize) {
+          case 1: return dtype::uint8;
+          case 2: return dtype::uint16;
+          case 4: return dtype::uint32;
+          case 8: return dtype::uint64;
+          default: return dtype::NOT_PRIMITIVE;
+        }
+      }
+
+      bool
+      is_little_endian() {
+        uint16_t x = 1;
+        return *reinterpret_cast<uint8_t*>(&x) == 1;
+      }
+    }
+
+    dtype
+    format_to_dtype(const std::string& format, int64_t itemsize) {
+      std::string f = format;
+      if (f.length() == 2) {
+        char prefix = f[0];
+        if (prefix == '@'  ||  prefix == '='  ||
+            (prefix == '<'  &&  is_little_endian())  ||
+            (prefix == '>'  &&  !is_little_endian())) {
+          f = f.substr(1);
+        }
+      }
+      if (f.length() != 1) {
+        return dtype::NOT_PRIMITIVE;
+      }
+      switch (f[0]) {
+        case '?':
+          return dtype::boolean;
+        case 'f':
+          return dtype::float32;
+        case 'd':
+          return dtype::float64;
+        case 'c':
+          return dtype::uint8;
+        case 'b':
+          return signed_of_size(itemsize > 0 ? itemsize : 1);
+        case 'B':
+          return unsigned_of_size(itemsize > 0 ? itemsize : 1);
+        case 'h':
+          return signed_of_size(itemsize > 0 ? itemsize : sizeof(short));
+        case 'H':
+          return unsigned_of_size(itemsize > 0 ? itemsize
+                                               : sizeof(unsigned short));
+        case 'i':
+          return signed_of_size(itemsize > 0 ? itemsize : sizeof(int));
+        case 'I':
+          return unsigned_of_size(itemsize > 0 ? itemsize
+                                               : sizeof(unsigned int));
+        case 'l':
+          return signed_of_size(itemsize > 0 ? itemsize : sizeof(long));
+        case 'L':
+          return unsigned_of_size(itemsize > 0 ? itemsize
+                                               : sizeof(unsigned long));
+        case 'q':
+          return signed_of_size(itemsize > 0 ? itemsize : sizeof(long long));
+        case 'Q':
+          return unsigned_of_size(itemsize > 0 ? itemsize
+                                               : sizeof(unsigned long long));
+        case 'n':
+          return signed_of_size(itemsize > 0 ? itemsize : sizeof(ssize_t));
+        case 'N':
+          return unsigned_of_size(itemsize > 0 ? itemsize : sizeof(size_t));
+        default:
+          return dtype::NOT_PRIMITIVE;
+      }
+    }
+
+    const std::string
+    dtype_to_format(dtype dt) {
+      // Systems with a 32-bit long (Windows and 32-bit Linux) name 32-bit
+      // integers "l/L" and 64-bit integers "q/Q"; all others use "i/I" and
+      // "l/L". This is the only place that convention is spelled out.
+      bool longis32 = (sizeof(long) == 4);
+      switch (dt) {
+        case dtype::boolean:
+          return "?";
+        case dtype::int8:
+          return "b";
+        case dtype::int16:
+          return "h";
+        case dtype::int32:
+          return longis32 ? "l" : "i";
+        case dtype::int64:
+          return longis32 ? "q" : "l";
+        case dtype::uint8:
+          return "B";
+        case dtype::uint16:
+          return "H";
+        case dtype::uint32:
+          return longis32 ? "L" : "I";
+        case dtype::uint64:
+          return longis32 ? "Q" : "L";
+        case dtype::float32:
+          return "f";
+        case dtype::float64:
+          return "d";
+        default:
+          return "";
+      }
+    }
+
+    int64_t
+    dtype_to_itemsize(dtype dt) {
+      switch (dt) {
+        case dtype::boolean:
+        case dtype::int8:
+        case dtype::uint8:
+          return 1;
+        case dtype::int16:
+        case dtype::uint16:
+          return 2;
+        case dtype::int32:
+        case dtype::uint32:
+        case dtype::float32:
+          return 4;
+        case dtype::int64:
+        case dtype::uint64:
+        case dtype::float64:
+          return 8;
+        default:
+          return 0;
+      }
+    }
+
+    const std::string
+    dtype_to_name(dtype dt) {
+      switch (dt) {
+        case dtype::boolean:
+          return "bool";
+        case dtype::int8:
+          return "int8";
+        case dtype::int16:
+          return "int16";
+        case dtype::int32:
+          return "int32";
+        case dtype::int64:
+          return "int64";
+        case dtype::uint8:
+          return "uint8";
+        case dtype::uint16:
+          return "uint16";
+        case dtype::uint32:
+          return "uint32";
+        case dtype::uint64:
+          return "uint64";
+        case dtype::float32:
+          return "float32";
+        case dtype::float64:
+          return "float64";
+        default:
+          return "unknown";
+      }
+    }
+
+    bool
+    is_integer(dtype dt) {
+      return (dtype::int8 <= dt  &&  dt <= dtype::uint64);
+    }
+
+    bool
+    is_real(dtype dt) {
+      return (dt == dtype::float32  ||  dt == dtype::float64);
+    }
+
     template <typename T>
     IndexOf<T> make_starts(const IndexOf<T>& offsets) {
       return IndexOf<T>(offsets.ptr(),
@@ -4012,6 +4195,293 @@ namespace awkward {
         length);
     }
 
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<int32_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<uint32_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<int64_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64<int32_t>(
+      int64_t* maxcount,
+      int64_t* offsetscopy,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_nonlocal_maxcount_offsetscopy_64(
+        maxcount,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64<uint32_t>(
+      int64_t* maxcount,
+      int64_t* offsetscopy,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_nonlocal_maxcount_offsetscopy_64(
+        maxcount,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64<int64_t>(
+      int64_t* maxcount,
+      int64_t* offsetscopy,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+        maxcount,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_preparenext_64<int32_t>(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t nextlen,
+      int64_t* maxnextparents,
+      int64_t* distincts,
+      int64_t distinctslen,
+      int64_t* offsetscopy,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t maxcount) {
+      return awkward_listoffsetarray32_reduce_nonlocal_preparenext_64(
+        nextcarry,
+        nextparents,
+        nextlen,
+        maxnextparents,
+        distincts,
+        distinctslen,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        maxcount);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_preparenext_64<uint32_t>(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t nextlen,
+      int64_t* maxnextparents,
+      int64_t* distincts,
+      int64_t distinctslen,
+      int64_t* offsetscopy,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t maxcount) {
+      return awkward_listoffsetarrayU32_reduce_nonlocal_preparenext_64(
+        nextcarry,
+        nextparents,
+        nextlen,
+        maxnextparents,
+        distincts,
+        distinctslen,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        maxcount);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_preparenext_64<int64_t>(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t nextlen,
+      int64_t* maxnextparents,
+      int64_t* distincts,
+      int64_t distinctslen,
+      int64_t* offsetscopy,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t maxcount) {
+      return ::awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+        nextcarry,
+        nextparents,
+        nextlen,
+        maxnextparents,
+        distincts,
+        distinctslen,
+        offsetscopy,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        maxcount);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<int32_t>(
+      int64_t* nextparents,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<uint32_t>(
+      int64_t* nextparents,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<int64_t>(
+      int64_t* nextparents,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_starts_64<int32_t>(
+      int64_t* starts,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_local_starts_64(
+        starts,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_starts_64<uint32_t>(
+      int64_t* starts,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_local_starts_64(
+        starts,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_starts_64<int64_t>(
+      int64_t* starts,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_local_starts_64(
+        starts,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+
+    template <>
+    Error awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64<int32_t>(
+      int8_t* toptr,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength) {
+      return awkward_numpyarray_reduce_mask_bytemaskedarray_offsets32_64(
+        toptr,
+        offsets,
+        offsetsoffset,
+        outlength);
+    }
+    template <>
+    Error awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64<uint32_t>(
+      int8_t* toptr,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength) {
+      return awkward_numpyarray_reduce_mask_bytemaskedarray_offsetsU32_64(
+        toptr,
+        offsets,
+        offsetsoffset,
+        outlength);
+    }
+    template <>
+    Error awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64<int64_t>(
+      int8_t* toptr,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t outlength) {
+      return ::awkward_numpyarray_reduce_mask_bytemaskedarray_offsets_64(
+        toptr,
+        offsets,
+        offsetsoffset,
+        outlength);
+    }
+
     template <>
     int8_t awkward_index_getitem_at_nowrap<int8_t>(
       const int8_t* ptr,
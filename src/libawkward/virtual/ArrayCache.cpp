@@ -1,6 +1,9 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
 #include <atomic>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 
 #include "awkward/virtual/ArrayCache.h"
 
@@ -17,4 +20,136 @@ namespace awkward {
   // Note: if you're creating a pure C++ cache (and it's not ridiculously
   // large), define it in
   // include/awkward/virtual/ArrayCache.h and implement it in this file.
+
+  ////////// LRUArrayCache
+
+  LRUArrayCache::LRUArrayCache(int64_t maxbytes,
+                               const EvictionCallback& on_evict)
+      : maxbytes_(maxbytes)
+      , nbytes_(0)
+      , on_evict_(on_evict) {
+    if (maxbytes < 0) {
+      throw std::invalid_argument("LRUArrayCache maxbytes must be >= 0");
+    }
+  }
+
+  int64_t
+  LRUArrayCache::maxbytes() const {
+    return maxbytes_;
+  }
+
+  int64_t
+  LRUArrayCache::nbytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nbytes_;
+  }
+
+  int64_t
+  LRUArrayCache::length() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int64_t)lookup_.size();
+  }
+
+  bool
+  LRUArrayCache::has(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookup_.find(key) != lookup_.end();
+  }
+
+  const std::vector<std::string>
+  LRUArrayCache::keys() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> out;
+    for (auto& x : entries_) {
+      out.push_back(x.key);
+    }
+    return out;
+  }
+
+  void
+  LRUArrayCache::set_on_evict(const EvictionCallback& on_evict) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_evict_ = on_evict;
+  }
+
+  ContentPtr
+  LRUArrayCache::get(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = lookup_.find(key);
+    if (found == lookup_.end()) {
+      return ContentPtr(nullptr);
+    }
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return found->second->value;
+  }
+
+  void
+  LRUArrayCache::set(const std::string& key, const ContentPtr& value) {
+    int64_t nbytes = value.get()->nbytes();
+    EntryList evicted;
+    EvictionCallback on_evict;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto found = lookup_.find(key);
+      if (found != lookup_.end()) {
+        nbytes_ -= found->second->nbytes;
+        entries_.erase(found->second);
+        lookup_.erase(found);
+      }
+      if (nbytes > maxbytes_) {
+        // Making room for it would only empty the cache.
+        evicted.push_back(Entry({ key, value, nbytes }));
+      }
+      else {
+        entries_.push_front(Entry({ key, value, nbytes }));
+        lookup_[key] = entries_.begin();
+        nbytes_ += nbytes;
+      }
+      while (nbytes_ > maxbytes_) {
+        auto last = std::prev(entries_.end());
+        nbytes_ -= last->nbytes;
+        lookup_.erase(last->key);
+        evicted.splice(evicted.end(), entries_, last);
+      }
+      on_evict = on_evict_;
+    }
+    if (on_evict) {
+      for (auto& x : evicted) {
+        on_evict(x.key, x.value);
+      }
+    }
+  }
+
+  bool
+  LRUArrayCache::erase(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = lookup_.find(key);
+    if (found == lookup_.end()) {
+      return false;
+    }
+    nbytes_ -= found->second->nbytes;
+    entries_.erase(found->second);
+    lookup_.erase(found);
+    return true;
+  }
+
+  void
+  LRUArrayCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lookup_.clear();
+    entries_.clear();
+    nbytes_ = 0;
+  }
+
+  const std::string
+  LRUArrayCache::tostring_part(const std::string& indent,
+                               const std::string& pre,
+                               const std::string& post) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::stringstream out;
+    out << indent << pre << "<LRUArrayCache length=\"" << lookup_.size()
+        << "\" nbytes=\"" << nbytes_ << "\" maxbytes=\"" << maxbytes_
+        << "\"/>" << post;
+    return out.str();
+  }
 }
@@ -2,11 +2,43 @@
 
 #include "sstream"
 
+#include "awkward/cpu-kernels/getitem.h"
 #include "awkward/array/VirtualArray.h"
 
 #include "awkward/virtual/ArrayGenerator.h"
 
 namespace awkward {
+  namespace {
+    // The fields `keys` of `content`, pushed down to its generator if it is
+    // an unmaterialized VirtualArray; `nullptr` if that isn't possible.
+    const ContentPtr
+    pushdown_fields(const ContentPtr& content,
+                    const std::vector<std::string>& keys) {
+      if (content.get()->kind() == ContentKind::VirtualArray) {
+        VirtualArray* raw = static_cast<VirtualArray*>(content.get());
+        if (raw->peek_array().get() == nullptr) {
+          ContentPtr out = raw->generator().get()->generate_fields(keys);
+          if (out.get() != nullptr) {
+            return out.get()->getitem_fields(keys);
+          }
+        }
+      }
+      return ContentPtr(nullptr);
+    }
+
+    // The same for a range, which must already be regularized.
+    const ContentPtr
+    pushdown_range(const ContentPtr& content, int64_t start, int64_t stop) {
+      if (content.get()->kind() == ContentKind::VirtualArray) {
+        VirtualArray* raw = static_cast<VirtualArray*>(content.get());
+        if (raw->peek_array().get() == nullptr) {
+          return raw->generator().get()->generate_range(start, stop);
+        }
+      }
+      return ContentPtr(nullptr);
+    }
+  }
+
   ArrayGenerator::ArrayGenerator(const FormPtr& form, int64_t length)
       : form_(form)
       , length_(length) { }
@@ -42,6 +74,16 @@ namespace awkward {
     return out;
   }
 
+  const ContentPtr
+  ArrayGenerator::generate_fields(const std::vector<std::string>& keys) const {
+    return ContentPtr(nullptr);
+  }
+
+  const ContentPtr
+  ArrayGenerator::generate_range(int64_t start, int64_t stop) const {
+    return ContentPtr(nullptr);
+  }
+
   SliceGenerator::SliceGenerator(const FormPtr& form,
                                  int64_t length,
                                  const ContentPtr& content,
@@ -60,11 +102,65 @@ namespace awkward {
     return slice_;
   }
 
+  bool
+  SliceGenerator::unit_range(int64_t& start, int64_t& stop) const {
+    if (slice_.length() != 1  ||
+        slice_.head().get()->kind() != SliceKind::range) {
+      return false;
+    }
+    SliceRange* raw = static_cast<SliceRange*>(slice_.head().get());
+    if (raw->step() != 1) {
+      return false;
+    }
+    int64_t length;
+    if (content_.get()->kind() == ContentKind::VirtualArray) {
+      VirtualArray* a = static_cast<VirtualArray*>(content_.get());
+      length = a->generator().get()->length();
+      if (length < 0) {
+        return false;
+      }
+    }
+    else {
+      length = content_.get()->length();
+    }
+    start = raw->start();
+    stop = raw->stop();
+    awkward_regularize_rangeslice(&start, &stop, true,
+      raw->start() != Slice::none(), raw->stop() != Slice::none(), length);
+    return true;
+  }
+
   const ContentPtr
   SliceGenerator::generate() const {
+    ContentPtr out(nullptr);
+    int64_t start;
+    int64_t stop;
+    if (unit_range(start, stop)) {
+      out = pushdown_range(content_, start, stop);
+    }
+    else if (slice_.length() == 1) {
+      SliceItemPtr head = slice_.head();
+      if (head.get()->kind() == SliceKind::field) {
+        SliceField* raw = static_cast<SliceField*>(head.get());
+        out = pushdown_fields(content_,
+                              std::vector<std::string>({ raw->key() }));
+        if (out.get() != nullptr) {
+          out = out.get()->getitem_field(raw->key());
+        }
+      }
+      else if (head.get()->kind() == SliceKind::fields) {
+        SliceFields* raw = static_cast<SliceFields*>(head.get());
+        out = pushdown_fields(content_, raw->keys());
+      }
+    }
+    if (out.get() != nullptr) {
+      return out;
+    }
+
     if (slice_.length() == 1) {
       SliceItemPtr head = slice_.head();
-      if (SliceRange* raw = dynamic_cast<SliceRange*>(head.get())) {
+      if (head.get()->kind() == SliceKind::range) {
+        SliceRange* raw = static_cast<SliceRange*>(head.get());
         if (raw->step() == 1) {
           if (VirtualArray* a = dynamic_cast<VirtualArray*>(content_.get())) {
             return a->array().get()->getitem_range(raw->start(), raw->stop());
@@ -83,6 +179,47 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  SliceGenerator::generate_fields(const std::vector<std::string>& keys) const {
+    // Fields and ranges commute, so a range of fields is fields of a range.
+    int64_t start;
+    int64_t stop;
+    if (unit_range(start, stop)) {
+      ContentPtr out = pushdown_fields(content_, keys);
+      if (out.get() != nullptr) {
+        return out.get()->getitem_range_nowrap(start, stop);
+      }
+    }
+    return ContentPtr(nullptr);
+  }
+
+  const ContentPtr
+  SliceGenerator::generate_range(int64_t start, int64_t stop) const {
+    int64_t outerstart;
+    int64_t outerstop;
+    if (unit_range(outerstart, outerstop)) {
+      return pushdown_range(content_, outerstart + start, outerstart + stop);
+    }
+    else if (slice_.length() == 1) {
+      SliceItemPtr head = slice_.head();
+      if (head.get()->kind() == SliceKind::field) {
+        SliceField* raw = static_cast<SliceField*>(head.get());
+        ContentPtr out = pushdown_range(content_, start, stop);
+        if (out.get() != nullptr) {
+          return out.get()->getitem_field(raw->key());
+        }
+      }
+      else if (head.get()->kind() == SliceKind::fields) {
+        SliceFields* raw = static_cast<SliceFields*>(head.get());
+        ContentPtr out = pushdown_range(content_, start, stop);
+        if (out.get() != nullptr) {
+          return out.get()->getitem_fields(raw->keys());
+        }
+      }
+    }
+    return ContentPtr(nullptr);
+  }
+
   const std::string
   SliceGenerator::tostring_part(const std::string& indent,
                                 const std::string& pre,
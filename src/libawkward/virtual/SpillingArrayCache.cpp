@@ -0,0 +1,798 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+  #include <process.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/array/UnmaskedArray.h"
+
+#include "awkward/virtual/SpillingArrayCache.h"
+
+namespace awkward {
+  namespace {
+    std::atomic<int64_t> numcaches{0};
+
+    /// Collects the buffers of an array, to be written one after another,
+    /// and the numbers needed to find them again.
+    class SpillWriter {
+    public:
+      struct Piece {
+        const void* ptr;
+        int64_t position;
+        int64_t nbytes;
+      };
+
+      SpillWriter(): nbytes_(0) { }
+
+      void
+      number(int64_t x) {
+        layout_.push_back(x);
+      }
+
+      void
+      buffer(const void* ptr, int64_t nbytes) {
+        // Every buffer starts on an 8-byte boundary of the mapped file.
+        nbytes_ = (nbytes_ + 7) & ~((int64_t)7);
+        number(nbytes_);
+        pieces_.push_back(Piece({ ptr, nbytes_, nbytes }));
+        nbytes_ += nbytes;
+      }
+
+      template <typename T>
+      void
+      index(const IndexOf<T>& index) {
+        buffer(index.ptr().get() + index.offset(),
+               (int64_t)sizeof(T) * index.length());
+        number(index.length());
+      }
+
+      const std::vector<Piece>&
+      pieces() const {
+        return pieces_;
+      }
+
+      const std::vector<int64_t>&
+      layout() const {
+        return layout_;
+      }
+
+      int64_t
+      nbytes() const {
+        return nbytes_;
+      }
+
+    private:
+      std::vector<Piece> pieces_;
+      std::vector<int64_t> layout_;
+      int64_t nbytes_;
+    };
+
+    /// Reads the numbers written by a SpillWriter back in the same order,
+    /// wrapping buffers in the mapped `region` without copying them.
+    class SpillReader {
+    public:
+      SpillReader(const std::shared_ptr<char>& region,
+                  const std::vector<int64_t>& layout)
+          : region_(region)
+          , layout_(layout)
+          , position_(0) { }
+
+      int64_t
+      number() {
+        return layout_[position_++];
+      }
+
+      template <typename T>
+      std::shared_ptr<T>
+      buffer() {
+        int64_t offset = number();
+        return std::shared_ptr<T>(region_,
+                                  reinterpret_cast<T*>(region_.get() + offset));
+      }
+
+      template <typename T>
+      IndexOf<T>
+      index() {
+        std::shared_ptr<T> ptr = buffer<T>();
+        int64_t length = number();
+        return IndexOf<T>(ptr, 0, length);
+      }
+
+    private:
+      const std::shared_ptr<char> region_;
+      const std::vector<int64_t>& layout_;
+      size_t position_;
+    };
+
+    void
+    spill_content(const ContentPtr& content, SpillWriter& out);
+
+    template <typename T>
+    void
+    spill_list(const ListArrayOf<T>* raw, SpillWriter& out) {
+      out.index(raw->starts());
+      out.index(raw->stops());
+      spill_content(raw->content(), out);
+    }
+
+    template <typename T>
+    void
+    spill_listoffset(const ListOffsetArrayOf<T>* raw, SpillWriter& out) {
+      out.index(raw->offsets());
+      spill_content(raw->content(), out);
+    }
+
+    template <typename T, bool ISOPTION>
+    void
+    spill_indexed(const IndexedArrayOf<T, ISOPTION>* raw, SpillWriter& out) {
+      out.index(raw->index());
+      spill_content(raw->content(), out);
+    }
+
+    template <typename T, typename I>
+    void
+    spill_union(const UnionArrayOf<T, I>* raw, SpillWriter& out) {
+      out.index(raw->tags());
+      out.index(raw->index());
+      for (auto& x : raw->contents()) {
+        spill_content(x, out);
+      }
+    }
+
+    /// Walks a packed array in the same order as unspill_content walks its
+    /// Form. Raises std::invalid_argument for arrays that can't be spilled.
+    void
+    spill_content(const ContentPtr& content, SpillWriter& out) {
+      if (content.get()->identities().get() != nullptr) {
+        throw std::invalid_argument(
+          "cannot spill an array with Identities");
+      }
+      Content* ptr = content.get();
+      switch (ptr->kind()) {
+        case ContentKind::BitMaskedArray: {
+          BitMaskedArray* raw = static_cast<BitMaskedArray*>(ptr);
+          out.index(raw->mask());
+          out.number(raw->length());
+          spill_content(raw->content(), out);
+          break;
+        }
+        case ContentKind::ByteMaskedArray: {
+          ByteMaskedArray* raw = static_cast<ByteMaskedArray*>(ptr);
+          out.index(raw->mask());
+          spill_content(raw->content(), out);
+          break;
+        }
+        case ContentKind::EmptyArray:
+          break;
+        case ContentKind::IndexedArray32:
+          spill_indexed(static_cast<IndexedArray32*>(ptr), out);
+          break;
+        case ContentKind::IndexedArrayU32:
+          spill_indexed(static_cast<IndexedArrayU32*>(ptr), out);
+          break;
+        case ContentKind::IndexedArray64:
+          spill_indexed(static_cast<IndexedArray64*>(ptr), out);
+          break;
+        case ContentKind::IndexedOptionArray32:
+          spill_indexed(static_cast<IndexedOptionArray32*>(ptr), out);
+          break;
+        case ContentKind::IndexedOptionArray64:
+          spill_indexed(static_cast<IndexedOptionArray64*>(ptr), out);
+          break;
+        case ContentKind::ListArray32:
+          spill_list(static_cast<ListArray32*>(ptr), out);
+          break;
+        case ContentKind::ListArrayU32:
+          spill_list(static_cast<ListArrayU32*>(ptr), out);
+          break;
+        case ContentKind::ListArray64:
+          spill_list(static_cast<ListArray64*>(ptr), out);
+          break;
+        case ContentKind::ListOffsetArray32:
+          spill_listoffset(static_cast<ListOffsetArray32*>(ptr), out);
+          break;
+        case ContentKind::ListOffsetArrayU32:
+          spill_listoffset(static_cast<ListOffsetArrayU32*>(ptr), out);
+          break;
+        case ContentKind::ListOffsetArray64:
+          spill_listoffset(static_cast<ListOffsetArray64*>(ptr), out);
+          break;
+        case ContentKind::NumpyArray: {
+          NumpyArray* raw = static_cast<NumpyArray*>(ptr);
+          if (!raw->iscontiguous()) {
+            throw std::invalid_argument(
+              "cannot spill a non-contiguous NumpyArray");
+          }
+          int64_t nbytes = raw->itemsize();
+          for (auto& x : raw->shape()) {
+            nbytes *= x;
+          }
+          out.number(raw->length());
+          out.buffer(raw->byteptr(), nbytes);
+          break;
+        }
+        case ContentKind::RecordArray: {
+          RecordArray* raw = static_cast<RecordArray*>(ptr);
+          out.number(raw->length());
+          for (auto& x : raw->contents()) {
+            spill_content(x, out);
+          }
+          break;
+        }
+        case ContentKind::RegularArray:
+          spill_content(static_cast<RegularArray*>(ptr)->content(), out);
+          break;
+        case ContentKind::UnionArray8_32:
+          spill_union(static_cast<UnionArray8_32*>(ptr), out);
+          break;
+        case ContentKind::UnionArray8_U32:
+          spill_union(static_cast<UnionArray8_U32*>(ptr), out);
+          break;
+        case ContentKind::UnionArray8_64:
+          spill_union(static_cast<UnionArray8_64*>(ptr), out);
+          break;
+        case ContentKind::UnmaskedArray:
+          spill_content(static_cast<UnmaskedArray*>(ptr)->content(), out);
+          break;
+        default:
+          throw std::invalid_argument(
+            std::string("cannot spill ") + ptr->classname());
+      }
+    }
+
+    const ContentPtr
+    unspill_content(const FormPtr& form, SpillReader& in);
+
+    const std::invalid_argument
+    unknown_index(Index::Form index, const std::string& classname) {
+      return std::invalid_argument(
+        std::string("cannot unspill a ") + classname + std::string(" with a ")
+        + Index::form2str(index) + std::string(" index"));
+    }
+
+    template <typename T>
+    const ContentPtr
+    unspill_list(const ListForm* form, SpillReader& in) {
+      IndexOf<T> starts = in.index<T>();
+      IndexOf<T> stops = in.index<T>();
+      ContentPtr content = unspill_content(form->content(), in);
+      return std::make_shared<ListArrayOf<T>>(Identities::none(),
+                                              form->parameters(),
+                                              starts,
+                                              stops,
+                                              content);
+    }
+
+    template <typename T>
+    const ContentPtr
+    unspill_listoffset(const ListOffsetForm* form, SpillReader& in) {
+      IndexOf<T> offsets = in.index<T>();
+      ContentPtr content = unspill_content(form->content(), in);
+      return std::make_shared<ListOffsetArrayOf<T>>(Identities::none(),
+                                                    form->parameters(),
+                                                    offsets,
+                                                    content);
+    }
+
+    template <typename T, bool ISOPTION, typename FORM>
+    const ContentPtr
+    unspill_indexed(const FORM* form, SpillReader& in) {
+      IndexOf<T> index = in.index<T>();
+      ContentPtr content = unspill_content(form->content(), in);
+      return std::make_shared<IndexedArrayOf<T, ISOPTION>>(Identities::none(),
+                                                           form->parameters(),
+                                                           index,
+                                                           content);
+    }
+
+    template <typename I>
+    const ContentPtr
+    unspill_union(const UnionForm* form, SpillReader& in) {
+      Index8 tags = in.index<int8_t>();
+      IndexOf<I> index = in.index<I>();
+      ContentPtrVec contents;
+      for (auto& x : form->contents()) {
+        contents.push_back(unspill_content(x, in));
+      }
+      return std::make_shared<UnionArrayOf<int8_t, I>>(Identities::none(),
+                                                       form->parameters(),
+                                                       tags,
+                                                       index,
+                                                       contents);
+    }
+
+    /// Rebuilds the array that spill_content walked, given its Form.
+    const ContentPtr
+    unspill_content(const FormPtr& form, SpillReader& in) {
+      Form* ptr = form.get();
+      switch (ptr->kind()) {
+        case FormKind::BitMaskedForm: {
+          BitMaskedForm* raw = static_cast<BitMaskedForm*>(ptr);
+          IndexU8 mask = in.index<uint8_t>();
+          int64_t length = in.number();
+          ContentPtr content = unspill_content(raw->content(), in);
+          return std::make_shared<BitMaskedArray>(Identities::none(),
+                                                  raw->parameters(),
+                                                  mask,
+                                                  content,
+                                                  raw->valid_when(),
+                                                  length,
+                                                  raw->lsb_order());
+        }
+        case FormKind::ByteMaskedForm: {
+          ByteMaskedForm* raw = static_cast<ByteMaskedForm*>(ptr);
+          Index8 mask = in.index<int8_t>();
+          ContentPtr content = unspill_content(raw->content(), in);
+          return std::make_shared<ByteMaskedArray>(Identities::none(),
+                                                   raw->parameters(),
+                                                   mask,
+                                                   content,
+                                                   raw->valid_when());
+        }
+        case FormKind::EmptyForm:
+          return std::make_shared<EmptyArray>(Identities::none(),
+                                              ptr->parameters());
+        case FormKind::IndexedForm: {
+          IndexedForm* raw = static_cast<IndexedForm*>(ptr);
+          switch (raw->index()) {
+            case Index::Form::i32:
+              return unspill_indexed<int32_t, false>(raw, in);
+            case Index::Form::u32:
+              return unspill_indexed<uint32_t, false>(raw, in);
+            case Index::Form::i64:
+              return unspill_indexed<int64_t, false>(raw, in);
+            default:
+              throw unknown_index(raw->index(), "IndexedArray");
+          }
+        }
+        case FormKind::IndexedOptionForm: {
+          IndexedOptionForm* raw = static_cast<IndexedOptionForm*>(ptr);
+          switch (raw->index()) {
+            case Index::Form::i32:
+              return unspill_indexed<int32_t, true>(raw, in);
+            case Index::Form::i64:
+              return unspill_indexed<int64_t, true>(raw, in);
+            default:
+              throw unknown_index(raw->index(), "IndexedOptionArray");
+          }
+        }
+        case FormKind::ListForm: {
+          ListForm* raw = static_cast<ListForm*>(ptr);
+          switch (raw->starts()) {
+            case Index::Form::i32:
+              return unspill_list<int32_t>(raw, in);
+            case Index::Form::u32:
+              return unspill_list<uint32_t>(raw, in);
+            case Index::Form::i64:
+              return unspill_list<int64_t>(raw, in);
+            default:
+              throw unknown_index(raw->starts(), "ListArray");
+          }
+        }
+        case FormKind::ListOffsetForm: {
+          ListOffsetForm* raw = static_cast<ListOffsetForm*>(ptr);
+          switch (raw->offsets()) {
+            case Index::Form::i32:
+              return unspill_listoffset<int32_t>(raw, in);
+            case Index::Form::u32:
+              return unspill_listoffset<uint32_t>(raw, in);
+            case Index::Form::i64:
+              return unspill_listoffset<int64_t>(raw, in);
+            default:
+              throw unknown_index(raw->offsets(), "ListOffsetArray");
+          }
+        }
+        case FormKind::NumpyForm: {
+          NumpyForm* raw = static_cast<NumpyForm*>(ptr);
+          int64_t length = in.number();
+          std::shared_ptr<void> data = in.buffer<char>();
+          std::vector<ssize_t> shape({ (ssize_t)length });
+          for (auto& x : raw->inner_shape()) {
+            shape.push_back((ssize_t)x);
+          }
+          std::vector<ssize_t> strides(shape.size(), 0);
+          ssize_t stride = (ssize_t)raw->itemsize();
+          for (int64_t i = (int64_t)shape.size() - 1;  i >= 0;  i--) {
+            strides[(size_t)i] = stride;
+            stride *= shape[(size_t)i];
+          }
+          return std::make_shared<NumpyArray>(Identities::none(),
+                                              raw->parameters(),
+                                              data,
+                                              shape,
+                                              strides,
+                                              0,
+                                              (ssize_t)raw->itemsize(),
+                                              raw->format());
+        }
+        case FormKind::RecordForm: {
+          RecordForm* raw = static_cast<RecordForm*>(ptr);
+          int64_t length = in.number();
+          ContentPtrVec contents;
+          for (auto& x : raw->contents()) {
+            contents.push_back(unspill_content(x, in));
+          }
+          return std::make_shared<RecordArray>(Identities::none(),
+                                               raw->parameters(),
+                                               contents,
+                                               raw->recordlookup(),
+                                               length);
+        }
+        case FormKind::RegularForm: {
+          RegularForm* raw = static_cast<RegularForm*>(ptr);
+          ContentPtr content = unspill_content(raw->content(), in);
+          return std::make_shared<RegularArray>(Identities::none(),
+                                                raw->parameters(),
+                                                content,
+                                                raw->size());
+        }
+        case FormKind::UnionForm: {
+          UnionForm* raw = static_cast<UnionForm*>(ptr);
+          switch (raw->index()) {
+            case Index::Form::i32:
+              return unspill_union<int32_t>(raw, in);
+            case Index::Form::u32:
+              return unspill_union<uint32_t>(raw, in);
+            case Index::Form::i64:
+              return unspill_union<int64_t>(raw, in);
+            default:
+              throw unknown_index(raw->index(), "UnionArray");
+          }
+        }
+        case FormKind::UnmaskedForm: {
+          UnmaskedForm* raw = static_cast<UnmaskedForm*>(ptr);
+          ContentPtr content = unspill_content(raw->content(), in);
+          return std::make_shared<UnmaskedArray>(Identities::none(),
+                                                 raw->parameters(),
+                                                 content);
+        }
+        default:
+          throw std::invalid_argument(
+            std::string("cannot unspill a ") + ptr->tostring());
+      }
+    }
+
+    void
+    write_file(const std::string& path, const SpillWriter& spilled) {
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      int64_t position = 0;
+      const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      for (auto& x : spilled.pieces()) {
+        file.write(zeros, (std::streamsize)(x.position - position));
+        file.write(reinterpret_cast<const char*>(x.ptr),
+                   (std::streamsize)x.nbytes);
+        position = x.position + x.nbytes;
+      }
+      file.close();
+      if (!file) {
+        std::remove(path.c_str());
+        throw std::runtime_error(
+          std::string("SpillingArrayCache could not write ") + path);
+      }
+    }
+
+    /// Maps a whole file copy-on-write, so that the arrays on it can be
+    /// modified in memory as freely as any other arrays.
+    const std::shared_ptr<char>
+    map_file(const std::string& path, int64_t nbytes) {
+      if (nbytes == 0) {
+        // Only empty buffers are on it, which need no memory at all.
+        return std::shared_ptr<char>(nullptr);
+      }
+#ifdef _MSC_VER
+      std::shared_ptr<char> out = util::allocate<char>(nbytes);
+      std::ifstream file(path, std::ios::binary);
+      file.read(out.get(), (std::streamsize)nbytes);
+      if (!file) {
+        throw std::runtime_error(
+          std::string("SpillingArrayCache could not read ") + path);
+      }
+      return out;
+#else
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        throw std::runtime_error(
+          std::string("SpillingArrayCache could not open ") + path);
+      }
+      void* data = ::mmap(nullptr,
+                          (size_t)nbytes,
+                          PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE,
+                          fd,
+                          0);
+      ::close(fd);
+      if (data == MAP_FAILED) {
+        throw std::runtime_error(
+          std::string("SpillingArrayCache could not map ") + path);
+      }
+      return std::shared_ptr<char>(reinterpret_cast<char*>(data),
+                                   [nbytes](char* ptr) -> void {
+                                     ::munmap(ptr, (size_t)nbytes);
+                                   });
+#endif
+    }
+
+    int64_t
+    process_id() {
+#ifdef _MSC_VER
+      return (int64_t)_getpid();
+#else
+      return (int64_t)getpid();
+#endif
+    }
+  }
+
+  ////////// SpillingArrayCache
+
+  SpillingArrayCache::SpillingArrayCache(int64_t maxbytes,
+                                         const std::string& directory,
+                                         int64_t maxdiskbytes)
+      : memory_(maxbytes,
+                [this](const std::string& key,
+                       const ContentPtr& value) -> void {
+                  spill(key, value);
+                })
+      , directory_(directory)
+      , maxdiskbytes_(maxdiskbytes)
+      , prefix_(std::string("awkward-") + std::to_string(process_id())
+                + std::string("-") + std::to_string(numcaches++)
+                + std::string("-"))
+      , diskbytes_(0)
+      , numfiles_(0) {
+    if (maxdiskbytes < 0) {
+      throw std::invalid_argument(
+        "SpillingArrayCache maxdiskbytes must be >= 0");
+    }
+  }
+
+  SpillingArrayCache::~SpillingArrayCache() {
+    for (auto& x : spilled_) {
+      std::remove(x.path.c_str());
+    }
+  }
+
+  int64_t
+  SpillingArrayCache::maxbytes() const {
+    return memory_.maxbytes();
+  }
+
+  int64_t
+  SpillingArrayCache::nbytes() const {
+    return memory_.nbytes();
+  }
+
+  const std::string
+  SpillingArrayCache::directory() const {
+    return directory_;
+  }
+
+  int64_t
+  SpillingArrayCache::maxdiskbytes() const {
+    return maxdiskbytes_;
+  }
+
+  int64_t
+  SpillingArrayCache::diskbytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return diskbytes_;
+  }
+
+  bool
+  SpillingArrayCache::in_memory(const std::string& key) const {
+    return memory_.has(key);
+  }
+
+  bool
+  SpillingArrayCache::on_disk(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookup_.find(key) != lookup_.end();
+  }
+
+  bool
+  SpillingArrayCache::has(const std::string& key) const {
+    return in_memory(key)  ||  on_disk(key);
+  }
+
+  ContentPtr
+  SpillingArrayCache::get(const std::string& key) const {
+    ContentPtr out = memory_.get(key);
+    if (out.get() != nullptr) {
+      return out;
+    }
+
+    Spilled found;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = lookup_.find(key);
+      if (it == lookup_.end()) {
+        return ContentPtr(nullptr);
+      }
+      spilled_.splice(spilled_.begin(), spilled_, it->second);
+      found = *it->second;
+    }
+
+    try {
+      SpillReader in(map_file(found.path, found.nbytes), found.layout);
+      out = unspill_content(found.form, in);
+    }
+    catch (std::exception&) {
+      // The file has been removed from under us or can't be read; treat it
+      // as a miss so that the array is regenerated.
+      return ContentPtr(nullptr);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = lookup_.find(key);
+      if (it != lookup_.end()  &&  it->second->path == found.path) {
+        it->second->mapped = out;
+      }
+    }
+    memory_.set(key, out);
+    return out;
+  }
+
+  void
+  SpillingArrayCache::set(const std::string& key, const ContentPtr& value) {
+    std::string path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      path = forget(key);
+    }
+    if (!path.empty()) {
+      std::remove(path.c_str());
+    }
+    memory_.set(key, value);
+  }
+
+  bool
+  SpillingArrayCache::erase(const std::string& key) {
+    bool out = memory_.erase(key);
+    std::string path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      path = forget(key);
+    }
+    if (!path.empty()) {
+      std::remove(path.c_str());
+      out = true;
+    }
+    return out;
+  }
+
+  void
+  SpillingArrayCache::clear() {
+    memory_.clear();
+    SpilledList removed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      removed.swap(spilled_);
+      lookup_.clear();
+      diskbytes_ = 0;
+    }
+    for (auto& x : removed) {
+      std::remove(x.path.c_str());
+    }
+  }
+
+  const std::string
+  SpillingArrayCache::tostring_part(const std::string& indent,
+                                    const std::string& pre,
+                                    const std::string& post) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::stringstream out;
+    out << indent << pre << "<SpillingArrayCache length=\""
+        << memory_.length() << "\" nbytes=\"" << memory_.nbytes()
+        << "\" maxbytes=\"" << memory_.maxbytes() << "\" disklength=\""
+        << lookup_.size() << "\" diskbytes=\"" << diskbytes_
+        << "\" maxdiskbytes=\"" << maxdiskbytes_ << "\" directory=\""
+        << directory_ << "\"/>" << post;
+    return out.str();
+  }
+
+  void
+  SpillingArrayCache::spill(const std::string& key, const ContentPtr& value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = lookup_.find(key);
+      if (it != lookup_.end()  &&
+          it->second->mapped.lock().get() == value.get()) {
+        // It was read back from this file and is still the same array.
+        return;
+      }
+    }
+
+    FormPtr form(nullptr);
+    SpillWriter out;
+    std::string written;
+    try {
+      ContentPtr packed = value.get()->pack();
+      form = packed.get()->form(true);
+      spill_content(packed, out);
+      if (out.nbytes() > maxdiskbytes_) {
+        return;
+      }
+      std::string path;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        path = directory_ + std::string("/") + prefix_
+               + std::to_string(numfiles_++) + std::string(".spill");
+      }
+      write_file(path, out);
+      written = path;
+
+      std::vector<std::string> removed;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (memory_.has(key)) {
+          // A newer array was set at this key while we were writing.
+          removed.push_back(path);
+        }
+        else {
+          std::string old = forget(key);
+          if (!old.empty()) {
+            removed.push_back(old);
+          }
+          spilled_.push_front(Spilled({ key,
+                                        path,
+                                        form,
+                                        out.layout(),
+                                        out.nbytes(),
+                                        std::weak_ptr<Content>() }));
+          lookup_[key] = spilled_.begin();
+          written.clear();
+          diskbytes_ += out.nbytes();
+          while (diskbytes_ > maxdiskbytes_) {
+            auto last = std::prev(spilled_.end());
+            removed.push_back(forget(last->key));
+          }
+        }
+      }
+      for (auto& x : removed) {
+        std::remove(x.c_str());
+      }
+    }
+    catch (std::exception&) {
+      // Arrays that can't be spilled, for whatever reason, are dropped, as
+      // from an LRUArrayCache.
+      if (!written.empty()) {
+        std::remove(written.c_str());
+      }
+    }
+  }
+
+  const std::string
+  SpillingArrayCache::forget(const std::string& key) {
+    auto it = lookup_.find(key);
+    if (it == lookup_.end()) {
+      return std::string();
+    }
+    std::string path = it->second->path;
+    diskbytes_ -= it->second->nbytes;
+    spilled_.erase(it->second);
+    lookup_.erase(it);
+    return path;
+  }
+}
@@ -112,10 +112,14 @@ PYBIND11_MODULE(_ext, m) {
   make_PyArrayGenerator(m, "ArrayGenerator");
   make_SliceGenerator(m, "SliceGenerator");
   make_PyArrayCache(m, "ArrayCache");
+  make_LRUArrayCache(m, "LRUArrayCache");
+  make_SpillingArrayCache(m, "SpillingArrayCache");
+  release_gil_while_waiting();
 
   ////////// io.h
 
   make_fromjson(m, "fromjson");
+  make_fromjsonlines(m, "fromjsonlines");
   make_fromroot_nestedvector(m, "fromroot_nestedvector");
 
   ////////// partition.h
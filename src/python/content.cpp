@@ -775,9 +775,15 @@ builder_fromiter(ak::ArrayBuilder& self, const py::handle& obj) {
 py::class_<ak::ArrayBuilder>
 make_ArrayBuilder(const py::handle& m, const std::string& name) {
   return (py::class_<ak::ArrayBuilder>(m, name.c_str())
-      .def(py::init([](int64_t initial, double resize) -> ak::ArrayBuilder {
-        return ak::ArrayBuilder(ak::ArrayBuilderOptions(initial, resize));
-      }), py::arg("initial") = 1024, py::arg("resize") = 1.5)
+      .def(py::init([](int64_t initial,
+                       double resize,
+                       bool paged) -> ak::ArrayBuilder {
+        return ak::ArrayBuilder(ak::ArrayBuilderOptions(initial,
+                                                        resize,
+                                                        paged));
+      }), py::arg("initial") = 1024,
+          py::arg("resize") = 1.5,
+          py::arg("paged") = false)
       .def_property_readonly("_ptr",
                              [](const ak::ArrayBuilder* self) -> size_t {
         return reinterpret_cast<size_t>(self);
@@ -1086,6 +1092,9 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
                py::arg("copyarrays") = true,
                py::arg("copyindexes") = true,
                py::arg("copyidentities") = true)
+          .def("pack", [](const T& self) -> py::object {
+            return box(self.pack());
+          })
           .def_property_readonly("identity", &identity<T>)
           .def_property_readonly("numfields", &T::numfields)
           .def("fieldindex", &T::fieldindex)
@@ -1159,6 +1168,16 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
                [](const T& self, const py::object& other) -> py::object {
             return box(self.merge(unbox_content(other)));
           })
+          .def("merge_many",
+               [](const T& self,
+                  const py::iterable& others,
+                  bool mergebool) -> py::object {
+            std::vector<std::shared_ptr<ak::Content>> contents;
+            for (auto x : others) {
+              contents.push_back(unbox_content(x));
+            }
+            return box(self.merge_many(contents, mergebool));
+          }, py::arg("others"), py::arg("mergebool") = false)
           .def("merge_as_union",
                [](const T& self, const py::object& other) -> py::object {
             return box(self.merge_as_union(unbox_content(other)));
@@ -2055,14 +2074,26 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
                 "SliceGenerator");
           }
         }
-        std::shared_ptr<PyArrayCache> cppcache(nullptr);
+        std::shared_ptr<ak::ArrayCache> cppcache(nullptr);
         if (!cache.is(py::none())) {
           try {
             cppcache = cache.cast<std::shared_ptr<PyArrayCache>>();
           }
           catch (py::cast_error err) {
-            throw std::invalid_argument(
-                "VirtualArray 'cache' must be an ArrayCache or None");
+            try {
+              cppcache = cache.cast<std::shared_ptr<ak::LRUArrayCache>>();
+            }
+            catch (py::cast_error err) {
+              try {
+                cppcache =
+                  cache.cast<std::shared_ptr<ak::SpillingArrayCache>>();
+              }
+              catch (py::cast_error err) {
+                throw std::invalid_argument(
+                    "VirtualArray 'cache' must be an ArrayCache, an "
+                    "LRUArrayCache, a SpillingArrayCache, or None");
+              }
+            }
           }
         }
         if (!cache_key.is(py::none())) {
@@ -2119,9 +2150,18 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
                std::dynamic_pointer_cast<PyArrayCache>(cache)) {
           return py::cast(ptr);
         }
+        else if (std::shared_ptr<ak::LRUArrayCache> ptr =
+               std::dynamic_pointer_cast<ak::LRUArrayCache>(cache)) {
+          return py::cast(ptr);
+        }
+        else if (std::shared_ptr<ak::SpillingArrayCache> ptr =
+               std::dynamic_pointer_cast<ak::SpillingArrayCache>(cache)) {
+          return py::cast(ptr);
+        }
         else {
           throw std::invalid_argument(
-                  "VirtualArray's cache is not a Python MutableMapping");
+                  "VirtualArray's cache is not an ArrayCache, LRUArrayCache, "
+                  "or SpillingArrayCache");
         }
       })
       .def_property_readonly("peek_array", [](const ak::VirtualArray& self)
@@ -2139,5 +2179,19 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
         return box(self.array());
       })
       .def_property_readonly("cache_key", &ak::VirtualArray::cache_key)
+      .def_static("prefetch", [](const py::iterable& arrays) -> void {
+        std::vector<std::shared_ptr<ak::VirtualArray>> cpparrays;
+        for (auto x : arrays) {
+          try {
+            cpparrays.push_back(
+              x.cast<std::shared_ptr<ak::VirtualArray>>());
+          }
+          catch (py::cast_error err) {
+            throw std::invalid_argument(
+                "VirtualArray.prefetch arguments must be VirtualArrays");
+          }
+        }
+        ak::VirtualArray::prefetch(cpparrays);
+      }, py::arg("arrays"))
   );
 }
@@ -8,6 +8,7 @@
 #include "awkward/builder/ArrayBuilderOptions.h"
 #include "awkward/io/json.h"
 #include "awkward/io/root.h"
+#include "awkward/partition/PartitionedArray.h"
 
 #include "awkward/python/io.h"
 
@@ -15,13 +16,32 @@ namespace ak = awkward;
 
 ////////// fromjson
 
+ak::JsonParser
+tojsonparser(const std::string& parser) {
+  if (parser == std::string("rapidjson")) {
+    return ak::JsonParser::rapidjson;
+  }
+  else if (parser == std::string("simdjson")) {
+    return ak::JsonParser::simdjson;
+  }
+  else {
+    throw std::invalid_argument(
+      std::string("unrecognized JSON parser \"") + parser
+      + std::string("\"; must be \"rapidjson\" or \"simdjson\""));
+  }
+}
+
 void
 make_fromjson(py::module& m, const std::string& name) {
   m.def(name.c_str(),
         [](const std::string& source,
            int64_t initial,
            double resize,
-           int64_t buffersize) -> std::shared_ptr<ak::Content> {
+           int64_t buffersize,
+           bool paged,
+           const std::string& parser,
+           const ak::FormPtr& form) -> std::shared_ptr<ak::Content> {
+    ak::JsonParser jsonparser = tojsonparser(parser);
     bool isarray = false;
     for (char const &x: source) {
       if (x != 9  &&  x != 10  &&  x != 13  &&  x != 32) {  // whitespace
@@ -32,8 +52,17 @@ make_fromjson(py::module& m, const std::string& name) {
       }
     }
     if (isarray) {
+      if (form.get() != nullptr) {
+        return ak::FromJsonString(
+          source.c_str(),
+          form,
+          ak::ArrayBuilderOptions(initial, resize, paged),
+          jsonparser);
+      }
       return ak::FromJsonString(
-        source.c_str(), ak::ArrayBuilderOptions(initial, resize));
+        source.c_str(),
+        ak::ArrayBuilderOptions(initial, resize, paged),
+        jsonparser);
     }
     else {
 #ifdef _MSC_VER
@@ -49,9 +78,19 @@ make_fromjson(py::module& m, const std::string& name) {
       }
       std::shared_ptr<ak::Content> out(nullptr);
       try {
-        out = FromJsonFile(file,
-                           ak::ArrayBuilderOptions(initial, resize),
-                           buffersize);
+        if (form.get() != nullptr) {
+          out = FromJsonFile(file,
+                             form,
+                             ak::ArrayBuilderOptions(initial, resize, paged),
+                             buffersize,
+                             jsonparser);
+        }
+        else {
+          out = FromJsonFile(file,
+                             ak::ArrayBuilderOptions(initial, resize, paged),
+                             buffersize,
+                             jsonparser);
+        }
       }
       catch (...) {
         fclose(file);
@@ -63,7 +102,57 @@ make_fromjson(py::module& m, const std::string& name) {
   }, py::arg("source"),
       py::arg("initial") = 1024,
       py::arg("resize") = 1.5,
-      py::arg("buffersize") = 65536);
+      py::arg("buffersize") = 65536,
+      py::arg("paged") = false,
+      py::arg("parser") = "rapidjson",
+      py::arg("form") = py::none());
+}
+
+void
+make_fromjsonlines(py::module& m, const std::string& name) {
+  m.def(name.c_str(),
+        [](const std::string& source,
+           int64_t initial,
+           double resize,
+           int64_t chunksize,
+           int64_t numthreads,
+           bool paged,
+           const std::string& parser)
+        -> std::shared_ptr<ak::PartitionedArray> {
+    ak::JsonParser jsonparser = tojsonparser(parser);
+#ifdef _MSC_VER
+    FILE* file;
+    if (fopen_s(&file, source.c_str(), "rb") != 0) {
+#else
+    FILE* file = fopen(source.c_str(), "rb");
+    if (file == nullptr) {
+#endif
+      throw std::invalid_argument(
+        std::string("file \"") + source
+        + std::string("\" could not be opened for reading"));
+    }
+    std::shared_ptr<ak::PartitionedArray> out(nullptr);
+    try {
+      out = ak::FromJsonLinesFile(
+        file,
+        ak::ArrayBuilderOptions(initial, resize, paged),
+        chunksize,
+        numthreads,
+        jsonparser);
+    }
+    catch (...) {
+      fclose(file);
+      throw;
+    }
+    fclose(file);
+    return out;
+  }, py::arg("source"),
+      py::arg("initial") = 1024,
+      py::arg("resize") = 1.5,
+      py::arg("chunksize") = 16777216,
+      py::arg("numthreads") = 0,
+      py::arg("paged") = false,
+      py::arg("parser") = "rapidjson");
 }
 
 ////////// fromroot
@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include "awkward/python/content.h"
 
@@ -14,11 +15,24 @@ PyArrayGenerator::PyArrayGenerator(const ak::FormPtr& form,
                                    int64_t length,
                                    const py::object& callable,
                                    const py::tuple& args,
-                                   const py::dict& kwargs)
+                                   const py::dict& kwargs,
+                                   const py::object& fields_callable,
+                                   const py::object& range_callable)
     : ArrayGenerator(form, length)
     , callable_(callable)
     , args_(args)
-    , kwargs_(kwargs) { }
+    , kwargs_(kwargs)
+    , fields_callable_(fields_callable)
+    , range_callable_(range_callable) { }
+
+PyArrayGenerator::~PyArrayGenerator() {
+  py::gil_scoped_acquire gil;
+  callable_.release().dec_ref();
+  args_.release().dec_ref();
+  kwargs_.release().dec_ref();
+  fields_callable_.release().dec_ref();
+  range_callable_.release().dec_ref();
+}
 
 const py::object
 PyArrayGenerator::callable() const {
@@ -35,14 +49,55 @@ PyArrayGenerator::kwargs() const {
   return kwargs_;
 }
 
+const py::object
+PyArrayGenerator::fields_callable() const {
+  return fields_callable_;
+}
+
+const py::object
+PyArrayGenerator::range_callable() const {
+  return range_callable_;
+}
+
 const ak::ContentPtr
 PyArrayGenerator::generate() const {
+  py::gil_scoped_acquire gil;
   py::object out = callable_(*args_, **kwargs_);
   py::object layout = py::module::import("awkward1").attr("to_layout")(
                                         out, py::cast(false), py::cast(false));
   return unbox_content(layout);
 }
 
+const ak::ContentPtr
+PyArrayGenerator::generate_fields(const std::vector<std::string>& keys) const {
+  py::gil_scoped_acquire gil;
+  if (fields_callable_.is(py::none())) {
+    return ak::ContentPtr(nullptr);
+  }
+  py::object out = fields_callable_(py::cast(keys), *args_, **kwargs_);
+  if (out.is(py::none())) {
+    return ak::ContentPtr(nullptr);
+  }
+  py::object layout = py::module::import("awkward1").attr("to_layout")(
+                                        out, py::cast(false), py::cast(false));
+  return unbox_content(layout);
+}
+
+const ak::ContentPtr
+PyArrayGenerator::generate_range(int64_t start, int64_t stop) const {
+  py::gil_scoped_acquire gil;
+  if (range_callable_.is(py::none())) {
+    return ak::ContentPtr(nullptr);
+  }
+  py::object out = range_callable_(start, stop, *args_, **kwargs_);
+  if (out.is(py::none())) {
+    return ak::ContentPtr(nullptr);
+  }
+  py::object layout = py::module::import("awkward1").attr("to_layout")(
+                                        out, py::cast(false), py::cast(false));
+  return unbox_content(layout);
+}
+
 const std::string
 PyArrayGenerator::tostring_part(const std::string& indent,
                                 const std::string& pre,
@@ -89,7 +144,9 @@ PyArrayGenerator::shallow_copy() const {
                                             length_,
                                             callable_,
                                             args_,
-                                            kwargs_);
+                                            kwargs_,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 const std::shared_ptr<ak::ArrayGenerator>
@@ -98,7 +155,9 @@ PyArrayGenerator::with_form(const std::shared_ptr<ak::Form>& form) const {
                                             length_,
                                             callable_,
                                             args_,
-                                            kwargs_);
+                                            kwargs_,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 const std::shared_ptr<ak::ArrayGenerator>
@@ -107,7 +166,9 @@ PyArrayGenerator::with_length(int64_t length) const {
                                             length,
                                             callable_,
                                             args_,
-                                            kwargs_);
+                                            kwargs_,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 
@@ -117,7 +178,9 @@ PyArrayGenerator::with_callable(const py::object& callable) const {
                                             length_,
                                             callable,
                                             args_,
-                                            kwargs_);
+                                            kwargs_,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 const std::shared_ptr<ak::ArrayGenerator>
@@ -126,7 +189,9 @@ PyArrayGenerator::with_args(const py::tuple& args) const {
                                             length_,
                                             callable_,
                                             args,
-                                            kwargs_);
+                                            kwargs_,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 const std::shared_ptr<ak::ArrayGenerator>
@@ -135,7 +200,9 @@ PyArrayGenerator::with_kwargs(const py::dict& kwargs) const {
                                             length_,
                                             callable_,
                                             args_,
-                                            kwargs);
+                                            kwargs,
+                                            fields_callable_,
+                                            range_callable_);
 }
 
 py::class_<PyArrayGenerator, std::shared_ptr<PyArrayGenerator>>
@@ -146,7 +213,10 @@ make_PyArrayGenerator(const py::handle& m, const std::string& name) {
                        const py::tuple& args,
                        const py::dict& kwargs,
                        const py::object& form,
-                       const py::object& length) -> PyArrayGenerator {
+                       const py::object& length,
+                       const py::object& generate_fields,
+                       const py::object& generate_range)
+                    -> PyArrayGenerator {
         ak::FormPtr cppform(nullptr);
         if (!form.is(py::none())) {
           try {
@@ -167,15 +237,27 @@ make_PyArrayGenerator(const py::handle& m, const std::string& name) {
                 "ArrayGenerator 'length' must be an int or None");
           }
         }
-        return PyArrayGenerator(cppform, cpplength, callable, args, kwargs);
+        return PyArrayGenerator(cppform,
+                                cpplength,
+                                callable,
+                                args,
+                                kwargs,
+                                generate_fields,
+                                generate_range);
       }), py::arg("callable")
         , py::arg("args") = py::tuple(0)
         , py::arg("kwargs") = py::dict()
         , py::arg("form") = py::none()
-        , py::arg("length") = py::none())
+        , py::arg("length") = py::none()
+        , py::arg("generate_fields") = py::none()
+        , py::arg("generate_range") = py::none())
       .def_property_readonly("callable", &PyArrayGenerator::callable)
       .def_property_readonly("args", &PyArrayGenerator::args)
       .def_property_readonly("kwargs", &PyArrayGenerator::kwargs)
+      .def_property_readonly("generate_fields",
+                             &PyArrayGenerator::fields_callable)
+      .def_property_readonly("generate_range",
+                             &PyArrayGenerator::range_callable)
       .def_property_readonly("form", [](const PyArrayGenerator& self)
                                      -> py::object {
         ak::FormPtr form = self.form();
@@ -314,6 +396,11 @@ make_SliceGenerator(const py::handle& m, const std::string& name) {
 PyArrayCache::PyArrayCache(const py::object& mutablemapping)
     : mutablemapping_(mutablemapping) { }
 
+PyArrayCache::~PyArrayCache() {
+  py::gil_scoped_acquire gil;
+  mutablemapping_.release().dec_ref();
+}
+
 const py::object
 PyArrayCache::mutablemapping() const {
   return mutablemapping_;
@@ -321,6 +408,7 @@ PyArrayCache::mutablemapping() const {
 
 ak::ContentPtr
 PyArrayCache::get(const std::string& key) const {
+  py::gil_scoped_acquire gil;
   py::str pykey(PyUnicode_DecodeUTF8(key.data(),
                                      key.length(),
                                      "surrogateescape"));
@@ -336,6 +424,7 @@ PyArrayCache::get(const std::string& key) const {
 
 void
 PyArrayCache::set(const std::string& key, const ak::ContentPtr& value) {
+  py::gil_scoped_acquire gil;
   py::str pykey(PyUnicode_DecodeUTF8(key.data(),
                                      key.length(),
                                      "surrogateescape"));
@@ -390,3 +479,146 @@ make_PyArrayCache(const py::handle& m, const std::string& name) {
 
   );
 }
+
+////////// LRUArrayCache
+
+/// @brief Wraps a Python callable as an eviction callback.
+///
+/// The callable is shared, rather than copied, so that copies of the
+/// callback never touch Python reference counts without the GIL.
+ak::LRUArrayCache::EvictionCallback
+pyevictioncallback(const py::object& on_evict) {
+  if (on_evict.is(py::none())) {
+    return ak::LRUArrayCache::EvictionCallback();
+  }
+  std::shared_ptr<py::object> callable(
+    new py::object(on_evict),
+    [](py::object* ptr) -> void {
+      py::gil_scoped_acquire gil;
+      delete ptr;
+    });
+  return [callable](const std::string& key,
+                    const ak::ContentPtr& value) -> void {
+    py::gil_scoped_acquire gil;
+    py::str pykey(PyUnicode_DecodeUTF8(key.data(),
+                                       key.length(),
+                                       "surrogateescape"));
+    (*callable)(pykey, box(value));
+  };
+}
+
+py::class_<ak::LRUArrayCache, std::shared_ptr<ak::LRUArrayCache>>
+make_LRUArrayCache(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::LRUArrayCache,
+                     std::shared_ptr<ak::LRUArrayCache>>(m, name.c_str())
+      .def(py::init([](int64_t maxbytes, const py::object& on_evict)
+                    -> std::shared_ptr<ak::LRUArrayCache> {
+        return std::make_shared<ak::LRUArrayCache>(
+          maxbytes, pyevictioncallback(on_evict));
+      }), py::arg("maxbytes"), py::arg("on_evict") = py::none())
+      .def_property_readonly("maxbytes", &ak::LRUArrayCache::maxbytes)
+      .def_property_readonly("nbytes", &ak::LRUArrayCache::nbytes)
+      .def("set_on_evict", [](ak::LRUArrayCache& self,
+                              const py::object& on_evict) -> void {
+        self.set_on_evict(pyevictioncallback(on_evict));
+      })
+      .def("__repr__", [](const ak::LRUArrayCache& self) -> std::string {
+        return self.tostring_part("", "", "");
+      })
+      .def("__getitem__", [](const ak::LRUArrayCache& self,
+                             const std::string& key) -> py::object {
+        ak::ContentPtr out = self.get(key);
+        if (out.get() == nullptr) {
+          throw py::key_error(key);
+        }
+        return box(out);
+      })
+      .def("__setitem__", [](ak::LRUArrayCache& self,
+                             const std::string& key,
+                             const py::object& value) -> void {
+        self.set(key, unbox_content(value));
+      })
+      .def("__delitem__", [](ak::LRUArrayCache& self,
+                             const std::string& key) -> void {
+        if (!self.erase(key)) {
+          throw py::key_error(key);
+        }
+      })
+      .def("__contains__", &ak::LRUArrayCache::has)
+      .def("__iter__", [](const ak::LRUArrayCache& self) -> py::object {
+        return py::iter(py::cast(self.keys()));
+      })
+      .def("__len__", &ak::LRUArrayCache::length)
+      .def("keys", &ak::LRUArrayCache::keys)
+      .def("clear", &ak::LRUArrayCache::clear)
+  );
+}
+
+////////// SpillingArrayCache
+
+py::class_<ak::SpillingArrayCache, std::shared_ptr<ak::SpillingArrayCache>>
+make_SpillingArrayCache(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::SpillingArrayCache,
+                     std::shared_ptr<ak::SpillingArrayCache>>(m, name.c_str())
+      .def(py::init([](int64_t maxbytes,
+                       const std::string& directory,
+                       int64_t maxdiskbytes)
+                    -> std::shared_ptr<ak::SpillingArrayCache> {
+        return std::make_shared<ak::SpillingArrayCache>(
+          maxbytes, directory, maxdiskbytes);
+      }), py::arg("maxbytes"),
+          py::arg("directory"),
+          py::arg("maxdiskbytes"))
+      .def_property_readonly("maxbytes", &ak::SpillingArrayCache::maxbytes)
+      .def_property_readonly("nbytes", &ak::SpillingArrayCache::nbytes)
+      .def_property_readonly("directory",
+                             &ak::SpillingArrayCache::directory)
+      .def_property_readonly("maxdiskbytes",
+                             &ak::SpillingArrayCache::maxdiskbytes)
+      .def_property_readonly("diskbytes",
+                             &ak::SpillingArrayCache::diskbytes)
+      .def("in_memory", &ak::SpillingArrayCache::in_memory)
+      .def("on_disk", &ak::SpillingArrayCache::on_disk)
+      .def("__repr__", [](const ak::SpillingArrayCache& self)
+                       -> std::string {
+        return self.tostring_part("", "", "");
+      })
+      .def("__getitem__", [](const ak::SpillingArrayCache& self,
+                             const std::string& key) -> py::object {
+        ak::ContentPtr out = self.get(key);
+        if (out.get() == nullptr) {
+          throw py::key_error(key);
+        }
+        return box(out);
+      })
+      .def("__setitem__", [](ak::SpillingArrayCache& self,
+                             const std::string& key,
+                             const py::object& value) -> void {
+        self.set(key, unbox_content(value));
+      })
+      .def("__delitem__", [](ak::SpillingArrayCache& self,
+                             const std::string& key) -> void {
+        if (!self.erase(key)) {
+          throw py::key_error(key);
+        }
+      })
+      .def("__contains__", &ak::SpillingArrayCache::has)
+      .def("clear", &ak::SpillingArrayCache::clear)
+  );
+}
+
+////////// VirtualArray waits
+
+void
+release_gil_while_waiting() {
+  ak::VirtualArray::set_wait_wrapper(
+    [](const std::function<void()>& wait) -> void {
+      if (PyGILState_Check()) {
+        py::gil_scoped_release nogil;
+        wait();
+      }
+      else {
+        wait();
+      }
+    });
+}
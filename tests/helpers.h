@@ -0,0 +1,64 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_TESTS_HELPERS_H_
+#define AWKWARD_TESTS_HELPERS_H_
+
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+// Arrays for the C++ tests to start from.
+
+/// @brief An int64 array of the integers from `0` to `length - 1`.
+inline awkward::ContentPtr
+numbers(int64_t length) {
+  awkward::Index64 index(length);
+  for (int64_t i = 0;  i < length;  i++) {
+    index.setitem_at_nowrap(i, i);
+  }
+  return std::make_shared<awkward::NumpyArray>(index);
+}
+
+/// @brief An int64 array of the given values.
+inline awkward::ContentPtr
+numbers(const std::vector<int64_t>& values) {
+  awkward::Index64 index((int64_t)values.size());
+  for (size_t i = 0;  i < values.size();  i++) {
+    index.setitem_at_nowrap((int64_t)i, values[i]);
+  }
+  return std::make_shared<awkward::NumpyArray>(index);
+}
+
+/// @brief A one-dimensional array of the given values with the given
+/// `format` (as in Python's buffer protocol).
+template <typename T>
+awkward::ContentPtr
+numpy(const std::vector<T>& values, const std::string& format) {
+  std::shared_ptr<T> ptr = awkward::util::allocate<T>((int64_t)values.size());
+  for (size_t i = 0;  i < values.size();  i++) {
+    ptr.get()[i] = values[i];
+  }
+  return std::make_shared<awkward::NumpyArray>(
+    awkward::Identities::none(),
+    awkward::util::Parameters(),
+    ptr,
+    std::vector<ssize_t>({ (ssize_t)values.size() }),
+    std::vector<ssize_t>({ (ssize_t)sizeof(T) }),
+    0,
+    (ssize_t)sizeof(T),
+    format);
+}
+
+/// @brief The array that an ArrayBuilder makes from a JSON string.
+inline awkward::ContentPtr
+fromjson(const std::string& source) {
+  return awkward::FromJsonString(source.c_str(),
+                                 awkward::ArrayBuilderOptions(8, 1.5));
+}
+
+#endif // AWKWARD_TESTS_HELPERS_H_
@@ -0,0 +1,53 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_contiguous_content():
+    content = awkward1.layout.NumpyArray(numpy.array([1, 2, 3, 0, 4, 5, -1, 6, 7, 8, 9], dtype=numpy.int64))
+    offsets = awkward1.layout.Index64(numpy.array([1, 4, 4, 7, 11], dtype=numpy.int64))
+    array = awkward1.Array(awkward1.layout.ListOffsetArray64(offsets, content))
+
+    assert awkward1.to_list(awkward1.count(array, axis=-1)) == [3, 0, 3, 4]
+    assert awkward1.to_list(awkward1.count_nonzero(array, axis=-1)) == [2, 0, 3, 4]
+    assert awkward1.to_list(awkward1.sum(array, axis=-1)) == [5, 0, 8, 30]
+    assert awkward1.to_list(awkward1.prod(array, axis=-1)) == [0, 1, -20, 3024]
+    assert awkward1.to_list(awkward1.any(array, axis=-1)) == [True, False, True, True]
+    assert awkward1.to_list(awkward1.all(array, axis=-1)) == [False, True, True, True]
+    assert awkward1.to_list(awkward1.min(array, axis=-1)) == [0, None, -1, 6]
+    assert awkward1.to_list(awkward1.max(array, axis=-1)) == [3, None, 5, 9]
+    assert awkward1.to_list(awkward1.argmin(array, axis=-1)) == [2, None, 2, 0]
+    assert awkward1.to_list(awkward1.argmax(array, axis=-1)) == [1, None, 1, 3]
+    assert awkward1.to_list(awkward1.sum(array, axis=-1, keepdims=True)) == [[5], [0], [8], [30]]
+    assert awkward1.to_list(awkward1.min(array, axis=-1, mask_identity=False)) == [0, 9223372036854775807, -1, 6]
+
+def test_same_as_noncontiguous_content():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 0.0, 4.4, 5.5, -1.0, 6.6, 7.7, 8.8, 9.9]))
+    index = awkward1.layout.Index64(numpy.arange(len(content), dtype=numpy.int64))
+    indexed = awkward1.layout.IndexedArray64(index, content)
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 7, 11], dtype=numpy.int64))
+    fast = awkward1.Array(awkward1.layout.ListOffsetArray64(offsets, content))
+    slow = awkward1.Array(awkward1.layout.ListOffsetArray64(offsets, indexed))
+
+    for reducer in [awkward1.count, awkward1.count_nonzero, awkward1.sum, awkward1.prod, awkward1.any, awkward1.all, awkward1.min, awkward1.max, awkward1.argmin, awkward1.argmax]:
+        assert awkward1.to_list(reducer(fast, axis=-1)) == awkward1.to_list(reducer(slow, axis=-1))
+
+def test_noncontiguous_content_offset():
+    content = awkward1.layout.NumpyArray(numpy.array([1, 2, 3, 0, 4, 5, -1, 6, 7, 8, 9], dtype=numpy.int64))
+    index = awkward1.layout.Index64(numpy.arange(len(content), dtype=numpy.int64))
+    indexed = awkward1.layout.IndexedArray64(index, content)
+    strided = awkward1.layout.NumpyArray(numpy.array([1, 2, 3, 0, 4, 5, -1, 6, 7, 8, 9], dtype=numpy.int64).repeat(2)[::2])
+    offsets = awkward1.layout.Index64(numpy.array([1, 4, 4, 7, 11], dtype=numpy.int64))
+
+    for inner in [indexed, strided]:
+        array = awkward1.Array(awkward1.layout.ListOffsetArray64(offsets, inner))
+        assert awkward1.to_list(awkward1.sum(array, axis=-1)) == [5, 0, 8, 30]
+        assert awkward1.to_list(awkward1.min(array, axis=-1)) == [0, None, -1, 6]
+        assert awkward1.to_list(awkward1.argmin(array, axis=-1)) == [2, None, 2, 0]
+        assert awkward1.to_list(awkward1.argmax(array, axis=-1)) == [1, None, 1, 3]
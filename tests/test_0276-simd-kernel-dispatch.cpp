@@ -0,0 +1,109 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "awkward/cpu-kernels/simd.h"
+#include "awkward/Content.h"
+#include "awkward/Reducer.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+using namespace awkward;
+
+// CMakeLists.txt runs this test once per AWKWARD_SIMD_LEVEL, so each run
+// checks the kernels of one level against a plain loop.
+
+std::string reduce_all(const ContentPtr& array) {
+  std::stringstream out;
+  out << array.get()->reduce(ReducerCount(), -1, false, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerSum(), -1, false, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerProd(), -1, false, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerMin(), -1, true, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerMax(), -1, true, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerArgmin(), -1, true, false).get()->tojson(false, 1) << " ";
+  out << array.get()->reduce(ReducerArgmax(), -1, true, false).get()->tojson(false, 1);
+  return out.str();
+}
+
+std::string reduce_loops(const std::vector<std::vector<int64_t>>& lists) {
+  std::stringstream out[7];
+  for (size_t i = 0;  i < lists.size();  i++) {
+    const std::vector<int64_t>& list = lists[i];
+    uint64_t sum = 0;
+    uint64_t prod = 1;
+    size_t argmin = 0;
+    size_t argmax = 0;
+    for (size_t j = 0;  j < list.size();  j++) {
+      sum += (uint64_t)list[j];
+      prod *= (uint64_t)list[j];
+      if (list[j] < list[argmin]) {
+        argmin = j;
+      }
+      if (list[j] > list[argmax]) {
+        argmax = j;
+      }
+    }
+    const char* comma = (i == 0 ? "" : ",");
+    out[0] << comma << list.size();
+    out[1] << comma << (int64_t)sum;
+    out[2] << comma << (int64_t)prod;
+    if (list.empty()) {
+      for (int k = 3;  k < 7;  k++) {
+        out[k] << comma << "null";
+      }
+    }
+    else {
+      out[3] << comma << list[argmin];
+      out[4] << comma << list[argmax];
+      out[5] << comma << argmin;
+      out[6] << comma << argmax;
+    }
+  }
+  std::string result;
+  for (int k = 0;  k < 7;  k++) {
+    result += (k == 0 ? "[" : " [") + out[k].str() + "]";
+  }
+  return result;
+}
+
+int main(int, char**) {
+  std::vector<std::vector<int64_t>> lists;
+  std::stringstream source;
+  source << "[";
+  for (int64_t i = 0;  i < 1000;  i++) {
+    lists.push_back(std::vector<int64_t>());
+    if (i != 0) source << ", ";
+    source << "[";
+    for (int64_t j = 0;  j < i % 37;  j++) {
+      lists.back().push_back(((i * 7 + j * 13) % 101) - 50);
+      if (j != 0) source << ", ";
+      source << lists.back().back();
+    }
+    source << "]";
+  }
+  source << "]";
+  ContentPtr array = FromJsonString(source.str().c_str(),
+                                    ArrayBuilderOptions(1024, 2.0));
+
+  int64_t level = awkward_cpu_kernels_simd_level();
+  int64_t supported = awkward_cpu_kernels_simd_supported();
+  if (level < kSimdBaseline  ||  level > supported) {
+    return -1;
+  }
+  const char* env = std::getenv("AWKWARD_SIMD_LEVEL");
+  if (env != nullptr) {
+    int64_t requested = std::atoi(env);
+    if (level != (requested < supported ? requested : supported)) {
+      return -1;
+    }
+  }
+
+  if (reduce_all(array) != reduce_loops(lists)) {
+    return -1;
+  }
+  return 0;
+}
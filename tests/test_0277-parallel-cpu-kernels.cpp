@@ -0,0 +1,123 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <vector>
+
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/reducers.h"
+#include "awkward/cpu-kernels/parallel.h"
+
+int check(int64_t num_threads) {
+  if (awkward_cpu_kernels_set_num_threads(num_threads).str != nullptr) {
+    return -1;
+  }
+  const int64_t length = 100003;
+
+  std::vector<int64_t> carry((size_t)length);
+  for (int64_t i = 0;  i < length;  i++) {
+    carry[(size_t)i] = (i * 7919) % length;
+  }
+  std::vector<int64_t> fromindex((size_t)length);
+  if (awkward_carry_arange_64(fromindex.data(), length).str != nullptr) {
+    return -1;
+  }
+  std::vector<int64_t> toindex((size_t)length);
+  if (awkward_index64_carry_64(toindex.data(),
+                               fromindex.data(),
+                               carry.data(),
+                               0,
+                               length,
+                               length).str != nullptr) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < length;  i++) {
+    if (toindex[(size_t)i] != carry[(size_t)i]) {
+      return -1;
+    }
+  }
+
+  std::vector<int32_t> from32((size_t)length);
+  for (int64_t i = 0;  i < length;  i++) {
+    from32[(size_t)i] = (int32_t)(i % 1000 - 500);
+  }
+  std::vector<double> todouble((size_t)length + 3);
+  if (awkward_numpyarray_fill_todouble_from32(todouble.data(),
+                                              3,
+                                              from32.data(),
+                                              0,
+                                              length).str != nullptr) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < length;  i++) {
+    if (todouble[(size_t)(i + 3)] != (double)from32[(size_t)i]) {
+      return -1;
+    }
+  }
+
+  std::vector<int64_t> offsets;
+  for (int64_t i = 0, start = 0;  start <= length;  start += i % 5, i++) {
+    offsets.push_back(start);
+  }
+  int64_t outlength = (int64_t)offsets.size() - 1;
+  std::vector<int64_t> sums((size_t)outlength);
+  if (awkward_reduce_sum_int64_int32_offsets_64(sums.data(),
+                                                from32.data(),
+                                                0,
+                                                offsets.data(),
+                                                0,
+                                                outlength).str != nullptr) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < outlength;  i++) {
+    int64_t expect = 0;
+    for (int64_t j = offsets[(size_t)i];  j < offsets[(size_t)i + 1];  j++) {
+      expect += from32[(size_t)j];
+    }
+    if (sums[(size_t)i] != expect) {
+      return -1;
+    }
+  }
+
+  // The first bad index is reported, no matter which thread finds it.
+  carry[(size_t)(length / 2)] = length + 10;
+  carry[(size_t)(length - 1)] = length + 20;
+  struct Error err = awkward_index64_carry_64(toindex.data(),
+                                              fromindex.data(),
+                                              carry.data(),
+                                              0,
+                                              length,
+                                              length);
+  if (err.str == nullptr  ||  err.attempt != length + 10) {
+    return -1;
+  }
+
+  return 0;
+}
+
+int main(int, char**) {
+  if (awkward_cpu_kernels_num_threads() < 1) {
+    return -1;
+  }
+  if (awkward_cpu_kernels_set_num_threads(-1).str == nullptr) {
+    return -1;
+  }
+  if (awkward_cpu_kernels_set_parallel_threshold(0).str == nullptr) {
+    return -1;
+  }
+  if (awkward_cpu_kernels_set_parallel_threshold(1000).str != nullptr) {
+    return -1;
+  }
+  if (awkward_cpu_kernels_parallel_threshold() != 1000) {
+    return -1;
+  }
+  for (int64_t num_threads = 1;  num_threads <= 8;  num_threads *= 2) {
+    if (check(num_threads) != 0) {
+      return -1;
+    }
+  }
+  if (awkward_cpu_kernels_set_num_threads(1).str != nullptr  ||
+      awkward_cpu_kernels_set_parallel_threshold(kParallelThreshold).str != nullptr) {
+    return -1;
+  }
+  return 0;
+}
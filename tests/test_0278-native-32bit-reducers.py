@@ -0,0 +1,34 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+reducers = [awkward1.count, awkward1.count_nonzero, awkward1.sum, awkward1.prod, awkward1.any, awkward1.all, awkward1.min, awkward1.max, awkward1.argmin, awkward1.argmax]
+
+def test_listoffsetarray32_and_U32():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 0.0, 4.4, 5.5, -1.0, 6.6, 7.7, 8.8, 9.9]))
+    offsets = numpy.array([1, 4, 4, 7, 11])
+    array64 = awkward1.Array(awkward1.layout.ListOffsetArray64(awkward1.layout.Index64(offsets.astype(numpy.int64)), content))
+    array32 = awkward1.Array(awkward1.layout.ListOffsetArray32(awkward1.layout.Index32(offsets.astype(numpy.int32)), content))
+    arrayU32 = awkward1.Array(awkward1.layout.ListOffsetArrayU32(awkward1.layout.IndexU32(offsets.astype(numpy.uint32)), content))
+
+    for reducer in reducers:
+        for keepdims in [False, True]:
+            expected = awkward1.to_list(reducer(array64, axis=-1, keepdims=keepdims))
+            assert awkward1.to_list(reducer(array32, axis=-1, keepdims=keepdims)) == expected
+            assert awkward1.to_list(reducer(arrayU32, axis=-1, keepdims=keepdims)) == expected
+
+def test_nested_listoffsetarray32():
+    content = awkward1.layout.NumpyArray(numpy.array([1, 2, 3, 0, 4, 5, -1, 6, 7, 8, 9], dtype=numpy.int64))
+    inner = awkward1.layout.ListOffsetArray32(awkward1.layout.Index32(numpy.array([1, 4, 4, 7, 11], dtype=numpy.int32)), content)
+    array = awkward1.Array(awkward1.layout.ListOffsetArray32(awkward1.layout.Index32(numpy.array([0, 2, 4], dtype=numpy.int32)), inner))
+
+    assert awkward1.to_list(awkward1.sum(array, axis=-1)) == [[5, 0], [8, 30]]
+    assert awkward1.to_list(awkward1.max(array, axis=-2)) == [[2, 3, 0], [6, 7, 8, 9]]
+    assert awkward1.to_list(awkward1.sum(array, axis=0)) == [[6, 8, -1], [6, 7, 8, 9]]
@@ -0,0 +1,122 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "awkward/Allocator.h"
+#include "awkward/Index.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+using namespace awkward;
+
+class CountingAllocator: public HeapAllocator {
+public:
+  CountingAllocator(): outstanding(0), allocations(0) { }
+
+  const std::string
+    classname() const override {
+    return "CountingAllocator";
+  }
+
+  void*
+    allocate(int64_t bytes) override {
+    outstanding++;
+    allocations++;
+    return HeapAllocator::allocate(bytes);
+  }
+
+  void
+    deallocate(void* ptr, int64_t bytes) override {
+    outstanding--;
+    HeapAllocator::deallocate(ptr, bytes);
+  }
+
+  std::atomic<int64_t> outstanding;
+  std::atomic<int64_t> allocations;
+};
+
+bool aligned(const void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % Allocator::kAlignment == 0;
+}
+
+int main(int, char**) {
+  if (Allocator::current().get()->classname() != "PoolAllocator") {
+    return -1;
+  }
+
+  // Every buffer is aligned, whatever its size.
+  for (int64_t length = 0;  length < 3000000;  length = length*3 + 1) {
+    Index64 index(length);
+    if (length != 0  &&  !aligned(index.ptr().get())) {
+      return -1;
+    }
+    std::shared_ptr<uint8_t> bytes = util::allocate<uint8_t>(length);
+    if (bytes.get() == nullptr  ||  !aligned(bytes.get())) {
+      return -1;
+    }
+  }
+
+  // A freed buffer is reused by the next request of the same size class.
+  void* first;
+  {
+    Index64 index(1000);
+    first = index.ptr().get();
+  }
+  {
+    Index32 index(1500);
+    if (index.ptr().get() != first) {
+      return -1;
+    }
+  }
+
+  // Buffers can be freed on a different thread than they were made on.
+  std::vector<std::shared_ptr<int64_t>> buffers;
+  for (int64_t i = 0;  i < 1000;  i++) {
+    buffers.push_back(util::allocate<int64_t>(i));
+  }
+  std::thread([&buffers]() -> void { buffers.clear(); }).join();
+  std::thread([]() -> void {
+    for (int64_t i = 0;  i < 1000;  i++) {
+      util::allocate<int64_t>(i).get()[0] = i;
+    }
+  }).join();
+
+  // Embedders can substitute their own Allocator.
+  std::shared_ptr<CountingAllocator> counting =
+    std::make_shared<CountingAllocator>();
+  Allocator::set_current(counting);
+  {
+    Index64 index(10);
+    GrowableBuffer<double> buffer = GrowableBuffer<double>::empty(
+      ArrayBuilderOptions(8, 1.5));
+    for (int64_t i = 0;  i < 100;  i++) {
+      buffer.append((double)i);
+    }
+    if (counting.get()->allocations < 2  ||
+        counting.get()->outstanding != 2) {
+      return -1;
+    }
+
+    // Buffers go back to the Allocator that made them.
+    Allocator::set_current(nullptr);
+    if (Allocator::current().get()->classname() != "PoolAllocator") {
+      return -1;
+    }
+    buffer.clear();
+    if (counting.get()->outstanding != 1) {
+      return -1;
+    }
+  }
+  if (counting.get()->outstanding != 0) {
+    return -1;
+  }
+
+  std::shared_ptr<PoolAllocator> pool = std::make_shared<PoolAllocator>();
+  pool.get()->release();
+  if (pool.get()->cached_bytes() != 0) {
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,103 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+using namespace awkward;
+
+int check_buffer() {
+  ArrayBuilderOptions options(4, 2.0, true);
+  GrowableBuffer<int64_t> buffer = GrowableBuffer<int64_t>::empty(options);
+  for (int64_t i = 0;  i < 4;  i++) {
+    buffer.append(i);
+  }
+  // One page: the snapshot shares it.
+  int64_t* first = buffer.ptr().get();
+  if (buffer.numpages() != 1) {
+    return -1;
+  }
+
+  for (int64_t i = 4;  i < 1000;  i++) {
+    buffer.append(i);
+  }
+  // The first page was kept, not copied.
+  if (buffer.numpages() < 3  ||  buffer.getitem_at_nowrap(0) != 0) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < 1000;  i++) {
+    if (buffer.getitem_at_nowrap(i) != i) {
+      return -1;
+    }
+  }
+  if (first[3] != 3) {
+    return -1;
+  }
+
+  // A snapshot of several pages is a concatenated copy; the pages stay.
+  int64_t numpages = buffer.numpages();
+  std::shared_ptr<int64_t> ptr = buffer.ptr();
+  if (buffer.numpages() != numpages) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < 1000;  i++) {
+    if (ptr.get()[i] != i) {
+      return -1;
+    }
+  }
+
+  // join concatenates them in place.
+  buffer.join();
+  if (buffer.numpages() != 1  ||
+      buffer.length() != 1000  ||
+      buffer.reserved() != 1000  ||
+      buffer.ptr().get()[999] != 999) {
+    return -1;
+  }
+
+  // Appending after a snapshot leaves the snapshot's buffer alone.
+  buffer.append(1000);
+  if (buffer.numpages() != 2  ||
+      buffer.getitem_at_nowrap(1000) != 1000  ||
+      buffer.ptr().get()[999] != 999) {
+    return -1;
+  }
+
+  buffer.set_length(5000);
+  if (buffer.length() != 5000  ||  buffer.reserved() < 5000) {
+    return -1;
+  }
+
+  buffer.clear();
+  if (buffer.length() != 0  ||  buffer.numpages() != 1) {
+    return -1;
+  }
+  return 0;
+}
+
+std::string build(const ArrayBuilderOptions& options) {
+  ArrayBuilder builder(options);
+  for (int64_t i = 0;  i < 3000;  i++) {
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 7;  j++) {
+      builder.real(0.5 * (double)j);
+    }
+    builder.integer(i);
+    builder.endlist();
+  }
+  return builder.snapshot().get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  if (check_buffer() != 0) {
+    return -1;
+  }
+  if (build(ArrayBuilderOptions(8, 1.5, true)) !=
+      build(ArrayBuilderOptions(8, 1.5))) {
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,99 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/TypedArrayBuilder.h"
+
+using namespace awkward;
+
+void field(ArrayBuilder& builder, const char* key) {
+  builder.field_check(key);
+}
+
+void field(TypedArrayBuilder& builder, const char* key) {
+  builder.field(key);
+}
+
+template <typename BUILDER>
+void fill(BUILDER& builder) {
+  for (int64_t i = 0;  i < 100;  i++) {
+    builder.beginrecord();
+    field(builder, "x");
+    builder.real(1.5 * (double)i);
+    field(builder, "y");
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 4;  j++) {
+      builder.integer(j);
+    }
+    builder.endlist();
+    field(builder, "z");
+    if (i % 3 == 0) {
+      builder.null();
+    }
+    else {
+      builder.string(std::to_string(i));
+    }
+    builder.endrecord();
+  }
+}
+
+bool throws(void (*function)(TypedArrayBuilder&)) {
+  TypedArrayBuilder builder(
+    Form::fromjson("{\"class\": \"ListOffsetArray64\", \"offsets\": \"i64\", "
+                   "\"content\": \"float64\"}"),
+    ArrayBuilderOptions(8, 1.5));
+  try {
+    function(builder);
+  }
+  catch (std::invalid_argument&) {
+    return true;
+  }
+  return false;
+}
+
+int main(int, char**) {
+  ArrayBuilder expected(ArrayBuilderOptions(8, 1.5));
+  fill(expected);
+  ContentPtr discovered = expected.snapshot();
+
+  TypedArrayBuilder builder(discovered.get()->form(true),
+                            ArrayBuilderOptions(8, 1.5));
+  fill(builder);
+  if (builder.length() != 100) {
+    return -1;
+  }
+  ContentPtr typed = builder.snapshot();
+  if (typed.get()->tojson(false, 1) != discovered.get()->tojson(false, 1)) {
+    return -1;
+  }
+  if (!typed.get()->form(true).get()->equal(discovered.get()->form(true),
+                                            true, true, false)) {
+    return -1;
+  }
+
+  builder.clear();
+  fill(builder);
+  if (builder.snapshot().get()->tojson(false, 1) !=
+      discovered.get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // Anything that does not fit the Form is an error, not a new type.
+  if (!throws([](TypedArrayBuilder& b) -> void { b.real(1.1); })  ||
+      !throws([](TypedArrayBuilder& b) -> void {
+        b.beginlist();  b.boolean(true);
+      })  ||
+      !throws([](TypedArrayBuilder& b) -> void { b.beginlist();  b.null(); })
+      ||
+      !throws([](TypedArrayBuilder& b) -> void { b.endlist(); })  ||
+      !throws([](TypedArrayBuilder& b) -> void {
+        b.beginlist();  b.snapshot();
+      })) {
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+using namespace awkward;
+
+const char* documents[] = {
+  "[1, 2, 3.5, null, true, \"four\"]",
+  "[[1, 2], [], [3, [4, 5]], null]",
+  "[{\"x\": 1, \"y\": [1.1]}, {\"y\": [], \"x\": 2}, {\"x\": 3, \"z\": \"s\"}]",
+  "{\"one\": 1, \"two\": [2, 2], \"three\": {\"a\": null}}",
+  "18446744073709551615",
+  "[\"\\u00e9t\\u00e9\", \"\\\"quoted\\\"\", \"\"]",
+  "[]"
+};
+
+std::string
+fromstring(const char* source, JsonParser parser) {
+  return FromJsonString(source, ArrayBuilderOptions(8, 1.5), parser)
+           .get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  if (!JsonParserAvailable(JsonParser::simdjson)) {
+    // Asking for a parser that was not compiled in is a clear error.
+    try {
+      fromstring("[1, 2, 3]", JsonParser::simdjson);
+    }
+    catch (std::invalid_argument&) {
+      return 0;
+    }
+    return -1;
+  }
+
+  for (auto source : documents) {
+    if (fromstring(source, JsonParser::simdjson) !=
+        fromstring(source, JsonParser::rapidjson)) {
+      return -1;
+    }
+  }
+
+  try {
+    fromstring("[1, 2", JsonParser::simdjson);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  FILE* file = tmpfile();
+  if (file == nullptr) {
+    return -1;
+  }
+  std::string big("[");
+  for (int64_t i = 0;  i < 10000;  i++) {
+    big += (i == 0 ? "" : ", ") + std::string("{\"x\": ") + std::to_string(i)
+           + std::string(", \"y\": [") + std::to_string(0.5 * (double)i)
+           + std::string("]}");
+  }
+  big += "]";
+  fputs(big.c_str(), file);
+  rewind(file);
+  std::string fromfile = FromJsonFile(file,
+                                      ArrayBuilderOptions(8, 1.5),
+                                      1000,
+                                      JsonParser::simdjson)
+                           .get()->tojson(false, 1);
+  fclose(file);
+  if (fromfile != fromstring(big.c_str(), JsonParser::rapidjson)) {
+    return -1;
+  }
+  return 0;
+}
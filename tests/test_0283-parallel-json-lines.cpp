@@ -0,0 +1,126 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+#include "awkward/partition/IrregularlyPartitionedArray.h"
+
+using namespace awkward;
+
+std::string
+tojson(const PartitionedArrayPtr& array) {
+  std::string out;
+  for (auto partition : array.get()->partitions()) {
+    std::string json = partition.get()->tojson(false, 1);
+    if (json.length() > 2) {
+      out += (out.empty() ? "" : ",") + json.substr(1, json.length() - 2);
+    }
+  }
+  return "[" + out + "]";
+}
+
+bool
+check(const std::string& lines, int64_t chunksize, JsonParser parser) {
+  std::string expected = "[";
+  size_t start = 0;
+  while (start < lines.length()) {
+    size_t stop = lines.find('\n', start);
+    std::string line = lines.substr(start, stop - start);
+    if (!line.empty()) {
+      expected += (expected.length() == 1 ? "" : ",") + line;
+    }
+    start = stop + 1;
+  }
+  expected += "]";
+  std::string reference = FromJsonString(expected.c_str(),
+                                         ArrayBuilderOptions(8, 1.5))
+                            .get()->tojson(false, 1);
+
+  ArrayBuilderOptions options(8, 1.5);
+  PartitionedArrayPtr fromstring =
+    FromJsonLines(lines.c_str(), options, chunksize, 4, parser);
+  if (tojson(fromstring) != reference) {
+    return false;
+  }
+  // Every partition has the same Form.
+  ContentPtrVec partitions = fromstring.get()->partitions();
+  for (auto partition : partitions) {
+    if (!partition.get()->form(true).get()->equal(
+           partitions[0].get()->form(true), true, true, false)) {
+      return false;
+    }
+  }
+
+  FILE* file = tmpfile();
+  if (file == nullptr) {
+    return false;
+  }
+  fputs(lines.c_str(), file);
+  rewind(file);
+  PartitionedArrayPtr fromfile =
+    FromJsonLinesFile(file, options, chunksize, 3, parser);
+  fclose(file);
+  return tojson(fromfile) == reference  &&
+         fromfile.get()->length() == fromstring.get()->length();
+}
+
+int main(int, char**) {
+  std::string same;
+  for (int64_t i = 0;  i < 5000;  i++) {
+    same += "{\"x\": " + std::to_string(i) + ", \"y\": [";
+    for (int64_t j = 0;  j < i % 5;  j++) {
+      same += (j == 0 ? "" : ", ") + std::to_string(j);
+    }
+    same += "]}\n";
+  }
+
+  // Early chunks see only integers, later ones reals, and the last a null:
+  // the partitions are merged into a common Form.
+  std::string different;
+  for (int64_t i = 0;  i < 2000;  i++) {
+    different += "[" + std::to_string(i)
+                 + (i < 1000 ? "" : ".5") + "]\n";
+  }
+  different += "\n\n[null]\n";
+
+  // Chunks whose types can't be merged are combined in a union.
+  std::string unmergeable = "1\n2\n[1,2]\n[3]\n";
+
+  for (int64_t chunksize : { 1, 100, 10000, 100000000 }) {
+    if (!check(same, chunksize, JsonParser::rapidjson)  ||
+        !check(different, chunksize, JsonParser::rapidjson)  ||
+        !check(unmergeable, chunksize, JsonParser::rapidjson)) {
+      return -1;
+    }
+    if (JsonParserAvailable(JsonParser::simdjson)  &&
+        (!check(same, chunksize, JsonParser::simdjson)  ||
+         !check(different, chunksize, JsonParser::simdjson)  ||
+         !check(unmergeable, chunksize, JsonParser::simdjson))) {
+      return -1;
+    }
+  }
+
+  PartitionedArrayPtr unioned =
+    FromJsonLines(unmergeable.c_str(), ArrayBuilderOptions(8, 1.5), 4, 2);
+  if (tojson(unioned) != "[1,2,[1,2],[3]]"  ||
+      unioned.get()->numpartitions() != 3) {
+    return -1;
+  }
+
+  PartitionedArrayPtr empty =
+    FromJsonLines("", ArrayBuilderOptions(8, 1.5), 100, 2);
+  if (empty.get()->length() != 0  ||  empty.get()->numpartitions() != 1) {
+    return -1;
+  }
+
+  try {
+    FromJsonLines("[1]\n[2\n[3]\n", ArrayBuilderOptions(8, 1.5), 4, 2);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+  return 0;
+}
@@ -0,0 +1,108 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+using namespace awkward;
+
+const char* formjson =
+  "{\"class\": \"RecordArray\", \"contents\": {"
+  "\"x\": \"int32\", "
+  "\"y\": {\"class\": \"ListOffsetArray32\", \"offsets\": \"i32\", "
+          "\"content\": \"float32\"}, "
+  "\"s\": {\"class\": \"ListOffsetArray64\", \"offsets\": \"i64\", "
+          "\"content\": {\"class\": \"NumpyArray\", \"itemsize\": 1, "
+                        "\"format\": \"B\", \"primitive\": \"uint8\", "
+                        "\"parameters\": {\"__array__\": \"char\"}}, "
+          "\"parameters\": {\"__array__\": \"string\"}}, "
+  "\"o\": {\"class\": \"ByteMaskedArray\", \"mask\": \"i8\", "
+          "\"content\": \"int16\", \"valid_when\": false}, "
+  "\"b\": {\"class\": \"BitMaskedArray\", \"mask\": \"u8\", "
+          "\"content\": {\"class\": \"ListArray32\", \"starts\": \"i32\", "
+                       "\"stops\": \"i32\", \"content\": \"float64\"}, "
+          "\"valid_when\": true, \"lsb_order\": false}, "
+  "\"i\": {\"class\": \"IndexedOptionArray32\", \"index\": \"i32\", "
+          "\"content\": \"bool\"}, "
+  "\"t\": {\"class\": \"RegularArray\", \"content\": \"uint8\", "
+          "\"size\": 2}, "
+  "\"u\": \"uint64\"}}";
+
+const ContentPtr
+parse(const std::string& source, JsonParser parser) {
+  return FromJsonString(source.c_str(),
+                        Form::fromjson(formjson),
+                        ArrayBuilderOptions(8, 1.5),
+                        parser);
+}
+
+bool
+throws(const std::string& source) {
+  try {
+    parse(source, JsonParser::rapidjson);
+  }
+  catch (std::invalid_argument&) {
+    return true;
+  }
+  return false;
+}
+
+int main(int, char**) {
+  std::string source = "[";
+  for (int64_t i = 0;  i < 100;  i++) {
+    std::string x = "\"x\": " + std::to_string(i - 50);
+    std::string y = "\"y\": [";
+    for (int64_t j = 0;  j < i % 3;  j++) {
+      y += (j == 0 ? "" : ", ") + std::to_string(0.25 * (double)j);
+    }
+    y += "]";
+    std::string s = "\"s\": \"item " + std::to_string(i) + "\"";
+    std::string o = "\"o\": " + (i % 4 == 0 ? std::string("null")
+                                            : std::to_string(-i * 100));
+    std::string b = "\"b\": " + (i % 5 == 0 ? std::string("null")
+                                            : std::string("[1.5, 2]"));
+    std::string ii = "\"i\": " + std::string(i % 2 == 0 ? "true" : "null");
+    std::string t = "\"t\": [" + std::to_string(i) + ", 255], \"u\": "
+                    + std::to_string(i * 1000);
+    // Fields come in a different order in different records.
+    source += (i == 0 ? "{" : ", {")
+              + (i % 2 == 0 ? x + ", " + y + ", " + s
+                            : s + ", " + y + ", " + x)
+              + ", " + o + ", " + b + ", " + ii + ", " + t + "}";
+  }
+  source += "]";
+
+  ContentPtr discovered = FromJsonString(source.c_str(),
+                                         ArrayBuilderOptions(8, 1.5));
+  FormPtr form = Form::fromjson(formjson);
+  for (auto parser : { JsonParser::rapidjson, JsonParser::simdjson }) {
+    if (!JsonParserAvailable(parser)) {
+      continue;
+    }
+    ContentPtr typed = parse(source, parser);
+    // Exactly the Form that was asked for, with the same data.
+    if (!typed.get()->form(false).get()->equal(form, true, true, false)) {
+      return -1;
+    }
+    if (typed.get()->tojson(false, 1) != discovered.get()->tojson(false, 1)) {
+      return -1;
+    }
+  }
+
+  std::string item = "\"y\": [], \"s\": \"\", \"o\": 1, \"b\": [], "
+                     "\"i\": null, \"t\": [1, 2], \"u\": 3";
+  if (!throws("[{\"x\": 3000000000, " + item + "}]")  ||
+      !throws("[{\"x\": 1.5, " + item + "}]")  ||
+      !throws("[{\"x\": 1, \"z\": 1, " + item + "}]")  ||
+      !throws("[{" + item + "}]")  ||
+      !throws("[{\"x\": 1, \"y\": [], \"s\": \"\", \"o\": 1, \"b\": [], "
+              "\"i\": null, \"t\": [1, 2, 3], \"u\": 3}]")  ||
+      !throws("[{\"x\": 1, \"y\": [], \"s\": \"\", \"o\": 1, \"b\": [], "
+              "\"i\": null, \"t\": [1, 256], \"u\": 3}]")) {
+    return -1;
+  }
+  return 0;
+}
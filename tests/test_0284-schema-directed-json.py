@@ -0,0 +1,47 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import json
+
+import pytest
+import numpy
+
+import awkward1
+
+form = {
+    "class": "RecordArray",
+    "contents": {
+        "x": "int32",
+        "y": {"class": "ListOffsetArray32", "offsets": "i32", "content": "float32"},
+        "o": {"class": "ByteMaskedArray", "mask": "i8", "content": "int16", "valid_when": False},
+        "t": {"class": "RegularArray", "content": "uint8", "size": 2},
+    },
+}
+
+source = json.dumps([
+    {"x": 1, "y": [1.5, 2], "o": None, "t": [1, 255]},
+    {"t": [2, 0], "o": -3, "y": [], "x": -2},
+    {"x": 3, "y": [0.25], "o": 300, "t": [3, 3]},
+])
+
+def test_form():
+    expected = awkward1.forms.Form.fromjson(json.dumps(form))
+    for given in [form, json.dumps(form), expected]:
+        typed = awkward1.from_json(source, form=given, highlevel=False)
+        assert json.loads(typed.form.tojson()) == json.loads(expected.tojson())
+        assert awkward1.to_list(typed) == awkward1.to_list(awkward1.from_json(source))
+
+def test_mismatch():
+    item = '"y": [], "o": 1, "t": [1, 2]'
+    for bad in [
+        '[{"x": 3000000000, ' + item + '}]',
+        '[{"x": 1.5, ' + item + '}]',
+        '[{"x": 1, "z": 1, ' + item + '}]',
+        '[{' + item + '}]',
+        '[{"x": 1, "y": [], "o": 1, "t": [1, 2, 3]}]',
+        '[{"x": 1, "y": [], "o": 1, "t": [1, 256]}]',
+    ]:
+        with pytest.raises(ValueError):
+            awkward1.from_json(bad, form=form)
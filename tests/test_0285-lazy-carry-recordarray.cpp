@@ -0,0 +1,147 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+using namespace awkward;
+
+// What RecordArray::carry used to do: gather every field right away.
+const ContentPtr
+eager(const ContentPtr& array, const Index64& carry) {
+  RecordArray* raw = dynamic_cast<RecordArray*>(array.get());
+  ContentPtrVec contents;
+  for (auto content : raw->contents()) {
+    contents.push_back(content.get()->carry(carry));
+  }
+  return std::make_shared<RecordArray>(Identities::none(),
+                                       raw->parameters(),
+                                       contents,
+                                       raw->recordlookup(),
+                                       carry.length());
+}
+
+Index64
+every(int64_t step, int64_t length) {
+  Index64 out((length + step - 1) / step);
+  for (int64_t i = 0;  i < out.length();  i++) {
+    out.setitem_at_nowrap(i, (length - 1) - i * step);
+  }
+  return out;
+}
+
+int main(int, char**) {
+  std::string source = "[";
+  for (int64_t i = 0;  i < 100;  i++) {
+    source += (i == 0 ? "{" : ", {") + std::string("\"x\": ")
+              + std::to_string(i) + ", \"y\": [" + std::to_string(i)
+              + ", " + std::to_string(-i) + "], \"z\": \"" + std::to_string(i)
+              + "\"}";
+  }
+  source += "]";
+  ContentPtr array = FromJsonString(source.c_str(),
+                                    ArrayBuilderOptions(8, 1.5));
+
+  Index64 first = every(3, 100);
+  ContentPtr lazy = array.get()->carry(first);
+  RecordArray* raw = dynamic_cast<RecordArray*>(lazy.get());
+  if (raw == nullptr  ||  !raw->has_lazycarry()  ||
+      lazy.get()->length() != 34) {
+    return -1;
+  }
+  ContentPtr expected = eager(array, first);
+  if (lazy.get()->tojson(false, 1) != expected.get()->tojson(false, 1)) {
+    return -1;
+  }
+  // Each field is carried once and then reused.
+  if (raw->field("y").get() != raw->field("y").get()) {
+    return -1;
+  }
+  if (!lazy.get()->type(util::TypeStrs()).get()->equal(
+        expected.get()->type(util::TypeStrs()), true)) {
+    return -1;
+  }
+
+  // The Form is that of the carried fields, without carrying them.
+  ContentPtr unseen = array.get()->carry(first);
+  if (!unseen.get()->form(true).get()->equal(
+        expected.get()->form(true), true, true, false)) {
+    return -1;
+  }
+
+  // Carries compose, so no field is carried twice.
+  Index64 second = every(2, 34);
+  ContentPtr twice = lazy.get()->carry(second);
+  if (!dynamic_cast<RecordArray*>(twice.get())->has_lazycarry()  ||
+      twice.get()->tojson(false, 1) !=
+      eager(expected, second).get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // Ranges and field selections stay lazy.
+  ContentPtr range = lazy.get()->getitem_range_nowrap(5, 20);
+  if (!dynamic_cast<RecordArray*>(range.get())->has_lazycarry()  ||
+      range.get()->tojson(false, 1) !=
+      expected.get()->getitem_range_nowrap(5, 20).get()->tojson(false, 1)) {
+    return -1;
+  }
+  ContentPtr fields = lazy.get()->getitem_fields({ "z", "x" });
+  if (!dynamic_cast<RecordArray*>(fields.get())->has_lazycarry()  ||
+      fields.get()->tojson(false, 1) !=
+      expected.get()->getitem_fields({ "z", "x" }).get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // A new field is already carried, so setting one carries the others;
+  // the result serializes and carries like the eager array.
+  ContentPtr what = raw->field("x");
+  ContentPtr added = raw->setitem_field("w", what);
+  RecordArray* rawexpected = dynamic_cast<RecordArray*>(expected.get());
+  ContentPtr expected_added = rawexpected->setitem_field("w", what);
+  if (dynamic_cast<RecordArray*>(added.get())->has_lazycarry()  ||
+      added.get()->tojson(false, 1) !=
+      expected_added.get()->tojson(false, 1)  ||
+      added.get()->carry(second).get()->tojson(false, 1) !=
+      eager(expected_added, second).get()->tojson(false, 1)) {
+    return -1;
+  }
+  ContentPtr inserted = raw->setitem_field(1, what);
+  if (dynamic_cast<RecordArray*>(inserted.get())->has_lazycarry()  ||
+      inserted.get()->tojson(false, 1) !=
+      rawexpected->setitem_field(1, what).get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // A bad carry is still an error when the carries are composed.
+  Index64 bad(1);
+  bad.setitem_at_nowrap(0, 34);
+  try {
+    lazy.get()->carry(bad);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  // ...and when it is first made lazy, before any field is accessed.
+  bad.setitem_at_nowrap(0, 100);
+  try {
+    array.get()->carry(bad);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+  bad.setitem_at_nowrap(0, -1);
+  try {
+    std::make_shared<RecordArray>(Identities::none(),
+                                  util::Parameters(),
+                                  raw->contents(),
+                                  raw->recordlookup(),
+                                  bad);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+  return 0;
+}
@@ -0,0 +1,112 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/virtual/ArrayGenerator.h"
+
+using namespace awkward;
+
+Index64
+range(int64_t start, int64_t stop) {
+  Index64 out(stop - start);
+  for (int64_t i = start;  i < stop;  i++) {
+    out.setitem_at_nowrap(i - start, i);
+  }
+  return out;
+}
+
+// Like a cut: keeps every item except every `step`th.
+Index64
+cut(int64_t step, int64_t length) {
+  Index64 out(length - (length + step - 1) / step);
+  int64_t j = 0;
+  for (int64_t i = 0;  i < length;  i++) {
+    if (i % step != 0) {
+      out.setitem_at_nowrap(j, i);
+      j++;
+    }
+  }
+  return out;
+}
+
+int main(int, char**) {
+  // Index composition respects offsets on both sides and checks bounds.
+  Index64 index = range(100, 200).getitem_range_nowrap(10, 50);
+  Index64 carry = range(0, 40).getitem_range_nowrap(30, 40);
+  Index64 composed = index.getitem_carry_64(carry);
+  if (composed.length() != 10  ||  composed.getitem_at_nowrap(0) != 140  ||
+      composed.getitem_at_nowrap(9) != 149) {
+    return -1;
+  }
+  try {
+    index.getitem_carry_64(range(40, 41));
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  ContentPtr data = std::make_shared<NumpyArray>(range(0, 1000));
+
+  // A chain of cuts on an IndexedArray only ever composes its index.
+  ContentPtr indexed = std::make_shared<IndexedArray64>(Identities::none(),
+                                                        util::Parameters(),
+                                                        range(0, 1000),
+                                                        data);
+  ContentPtr expected = data;
+  ContentPtr record = std::make_shared<RecordArray>(
+    Identities::none(), util::Parameters(), ContentPtrVec({ data, data }),
+    util::RecordLookupPtr(nullptr));
+  Slice full;
+  full.append(SliceArray64(range(0, 1000), { 1000 }, { 1 }, false));
+  full.become_sealed();
+  ContentPtr original = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<SliceGenerator>(FormPtr(nullptr), 1000, data, full),
+    ArrayCachePtr(nullptr));
+  ContentPtr virtual_ = original;
+
+  for (int64_t step = 2;  step < 17;  step++) {
+    Index64 carry = cut(step, expected.get()->length());
+    expected = expected.get()->carry(carry);
+    indexed = indexed.get()->carry(carry);
+    record = record.get()->carry(carry);
+    virtual_ = virtual_.get()->carry(carry);
+  }
+  std::string json = expected.get()->tojson(false, 1);
+
+  IndexedArray64* rawindexed = dynamic_cast<IndexedArray64*>(indexed.get());
+  if (rawindexed->content().get() != data.get()  ||
+      indexed.get()->tojson(false, 1) != json) {
+    return -1;
+  }
+
+  RecordArray* rawrecord = dynamic_cast<RecordArray*>(record.get());
+  if (!rawrecord->has_lazycarry()  ||
+      rawrecord->field(1).get()->tojson(false, 1) != json) {
+    return -1;
+  }
+  // A range of a lazy carry that has not been applied to any field yet.
+  ContentPtr some = record.get()->getitem_range_nowrap(5, 10);
+  if (dynamic_cast<RecordArray*>(some.get())->field(0).get()->tojson(false, 1)
+      != expected.get()->getitem_range_nowrap(5, 10).get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // A chain of carries on a VirtualArray slices the original source once.
+  VirtualArray* rawvirtual = dynamic_cast<VirtualArray*>(virtual_.get());
+  SliceGenerator* generator =
+    dynamic_cast<SliceGenerator*>(rawvirtual->generator().get());
+  if (generator == nullptr  ||  generator->content().get() != data.get()  ||
+      virtual_.get()->tojson(false, 1) != json) {
+    return -1;
+  }
+  return 0;
+}
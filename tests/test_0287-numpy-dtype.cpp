@@ -0,0 +1,163 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Reducer.h"
+#include "awkward/Slice.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+util::dtype
+dtype_of(const ContentPtr& array) {
+  return dynamic_cast<NumpyArray*>(array.get())->dtype();
+}
+
+ContentPtr
+reduce(const Reducer& reducer, const ContentPtr& content) {
+  Index64 offsets(3);
+  offsets.setitem_at_nowrap(0, 0);
+  offsets.setitem_at_nowrap(1, 2);
+  offsets.setitem_at_nowrap(2, content.get()->length());
+  ContentPtr list = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                        util::Parameters(),
+                                                        offsets,
+                                                        content);
+  return list.get()->reduce(reducer, -1, false, false);
+}
+
+int main(int, char**) {
+  // Formats resolve by itemsize, so the same code works for any platform's
+  // spelling of 32-bit and 64-bit integers.
+  if (util::format_to_dtype("l", 8) != util::dtype::int64  ||
+      util::format_to_dtype("l", 4) != util::dtype::int32  ||
+      util::format_to_dtype("q", 8) != util::dtype::int64  ||
+      util::format_to_dtype("<i", 4) != util::dtype::int32  ||
+      util::format_to_dtype("=Q", 8) != util::dtype::uint64  ||
+      util::format_to_dtype("c", 1) != util::dtype::uint8  ||
+      util::format_to_dtype("?", 1) != util::dtype::boolean  ||
+      util::format_to_dtype("d", 8) != util::dtype::float64  ||
+      util::format_to_dtype("3s", 3) != util::dtype::NOT_PRIMITIVE  ||
+      util::format_to_dtype("T{i:x:}", 4) != util::dtype::NOT_PRIMITIVE) {
+    return -1;
+  }
+  for (size_t i = 0;  i < (size_t)util::dtype::size;  i++) {
+    util::dtype dt = (util::dtype)i;
+    if (util::format_to_dtype(util::dtype_to_format(dt), 0) != dt  ||
+        util::format_to_dtype(util::dtype_to_format(dt),
+                              util::dtype_to_itemsize(dt)) != dt) {
+      return -1;
+    }
+  }
+
+  // The dtype is computed once, in the constructor.
+  if (NumpyArray(Index32(3)).dtype() != util::dtype::int32  ||
+      NumpyArray(IndexU8(3)).dtype() != util::dtype::uint8  ||
+      NumpyArray(Index64(3)).dtype() != util::dtype::int64) {
+    return -1;
+  }
+  ContentPtr longlong = numpy<int64_t>({ 1, 2, 3 }, "q");
+  if (longlong.get()->form(true).get()->type(util::TypeStrs()).get()
+        ->tostring() != "int64") {
+    return -1;
+  }
+  ContentPtr strings = numpy<char>({ 'a', 'b', 'c' }, "3s");
+  if (dtype_of(strings) != util::dtype::NOT_PRIMITIVE) {
+    return -1;
+  }
+  try {
+    strings.get()->form(true).get()->type(util::TypeStrs());
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  // Merging promotes through the fill tables.
+  ContentPtr i32 = numpy<int32_t>({ -1, 2, 3 }, util::dtype_to_format(
+                                                  util::dtype::int32));
+  ContentPtr u8 = numpy<uint8_t>({ 9, 5 }, "B");
+  ContentPtr f32 = numpy<float>({ 1.5f }, "f");
+  ContentPtr u64 = numpy<uint64_t>({ 10 }, util::dtype_to_format(
+                                             util::dtype::uint64));
+  ContentPtr b = numpy<bool>({ true, false }, "?");
+
+  ContentPtr merged = i32.get()->merge(u8);
+  if (dtype_of(merged) != util::dtype::int64  ||
+      merged.get()->tojson(false, 1) != "[-1,2,3,9,5]") {
+    return -1;
+  }
+  merged = u8.get()->merge(f32);
+  if (dtype_of(merged) != util::dtype::float64  ||
+      merged.get()->tojson(false, 1) != "[9.0,5.0,1.5]") {
+    return -1;
+  }
+  merged = u64.get()->merge(u64);
+  if (dtype_of(merged) != util::dtype::uint64  ||
+      merged.get()->tojson(false, 1) != "[10,10]") {
+    return -1;
+  }
+  merged = b.get()->merge(b);
+  if (dtype_of(merged) != util::dtype::boolean  ||
+      merged.get()->tojson(false, 1) != "[true,false,true,false]") {
+    return -1;
+  }
+  merged = b.get()->merge(i32);
+  if (dtype_of(merged) != util::dtype::int64  ||
+      merged.get()->tojson(false, 1) != "[1,0,-1,2,3]") {
+    return -1;
+  }
+  if (i32.get()->mergeable(strings, true)) {
+    return -1;
+  }
+  if (b.get()->mergeable(i32, false)  ||  !b.get()->mergeable(i32, true)) {
+    return -1;
+  }
+
+  // Reducers name their output dtype and are selected by the input's.
+  ContentPtr i16 = numpy<int16_t>({ 3, -4, 5, 6, 7 }, "h");
+  ContentPtr sum = reduce(ReducerSum(), i16);
+  if (!util::is_integer(dtype_of(sum))  ||
+      sum.get()->tojson(false, 1) != "[-1,18]") {
+    return -1;
+  }
+  ContentPtr count = reduce(ReducerCount(), i16);
+  if (dtype_of(count) != util::dtype::int64  ||
+      count.get()->tojson(false, 1) != "[2,3]") {
+    return -1;
+  }
+  ContentPtr any = reduce(ReducerAny(), i16);
+  if (dtype_of(any) != util::dtype::boolean) {
+    return -1;
+  }
+  ContentPtr min = reduce(ReducerMin(), i16);
+  if (dtype_of(min) != util::dtype::int16  ||
+      min.get()->tojson(false, 1) != "[-4,5]") {
+    return -1;
+  }
+  ContentPtr maxf = reduce(ReducerMax(), numpy<float>({ 1, 2, 3 }, "f"));
+  if (dtype_of(maxf) != util::dtype::float32  ||
+      maxf.get()->tojson(false, 1) != "[2.0,3.0]") {
+    return -1;
+  }
+  try {
+    reduce(ReducerSum(), strings);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  // Any integer array can be a slice.
+  SliceItemPtr item = dynamic_cast<NumpyArray*>(u8.get())->asslice();
+  SliceArray64* array = dynamic_cast<SliceArray64*>(item.get());
+  if (array == nullptr  ||  array->index().getitem_at_nowrap(0) != 9  ||
+      array->index().getitem_at_nowrap(1) != 5) {
+    return -1;
+  }
+
+  return 0;
+}
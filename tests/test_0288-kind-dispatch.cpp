@@ -0,0 +1,132 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/array/UnmaskedArray.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+int main(int, char**) {
+  ContentPtr x = numbers({ 1, 2, 3 });
+  ContentPtr y = numbers({ 4, 5 });
+
+  Index64 offsets(3);
+  offsets.setitem_at_nowrap(0, 0);
+  offsets.setitem_at_nowrap(1, 2);
+  offsets.setitem_at_nowrap(2, 3);
+  ContentPtr list = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                        util::Parameters(),
+                                                        offsets,
+                                                        x);
+  Index8 mask(2);
+  mask.setitem_at_nowrap(0, 0);
+  mask.setitem_at_nowrap(1, 1);
+  ContentPtr masked = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                                        util::Parameters(),
+                                                        mask,
+                                                        y,
+                                                        false);
+  Index64 index(2);
+  index.setitem_at_nowrap(0, 1);
+  index.setitem_at_nowrap(1, -1);
+  ContentPtr indexed = std::make_shared<IndexedOptionArray64>(
+    Identities::none(), util::Parameters(), index, y);
+  ContentPtr unmasked = std::make_shared<UnmaskedArray>(Identities::none(),
+                                                        util::Parameters(),
+                                                        y);
+  ContentPtr empty = std::make_shared<EmptyArray>(Identities::none(),
+                                                  util::Parameters());
+  ContentPtr record = std::make_shared<RecordArray>(
+    Identities::none(),
+    util::Parameters(),
+    ContentPtrVec({ x }),
+    util::RecordLookupPtr(new util::RecordLookup({ "a" })));
+
+  // Every node reports its kind, and so does its Form.
+  if (x.get()->kind() != ContentKind::NumpyArray  ||
+      list.get()->kind() != ContentKind::ListOffsetArray64  ||
+      masked.get()->kind() != ContentKind::ByteMaskedArray  ||
+      indexed.get()->kind() != ContentKind::IndexedOptionArray64  ||
+      unmasked.get()->kind() != ContentKind::UnmaskedArray  ||
+      empty.get()->kind() != ContentKind::EmptyArray  ||
+      record.get()->kind() != ContentKind::RecordArray) {
+    return -1;
+  }
+  if (x.get()->form(true).get()->kind() != FormKind::NumpyForm  ||
+      list.get()->form(true).get()->kind() != FormKind::ListOffsetForm  ||
+      indexed.get()->form(true).get()->kind() !=
+        FormKind::IndexedOptionForm  ||
+      record.get()->form(true).get()->kind() != FormKind::RecordForm) {
+    return -1;
+  }
+
+  // Slice items, too.
+  Slice where;
+  where.append(std::make_shared<SliceRange>(0, 1, 1));
+  where.append(std::make_shared<SliceAt>(1));
+  where.become_sealed();
+  if (where.head().get()->kind() != SliceKind::range  ||
+      where.tail().head().get()->kind() != SliceKind::at) {
+    return -1;
+  }
+  if (list.get()->getitem(where).get()->tojson(false, 1) != "[2]") {
+    return -1;
+  }
+  Slice field;
+  field.append(std::make_shared<SliceField>("a"));
+  field.become_sealed();
+  if (field.head().get()->kind() != SliceKind::field  ||
+      record.get()->getitem(field).get()->tojson(false, 1) != "[1,2,3]") {
+    return -1;
+  }
+
+  // Merging with an option-type node on either side goes through the
+  // option-type's reverse_merge.
+  if (x.get()->merge(masked).get()->tojson(false, 1) != "[1,2,3,4,null]"  ||
+      masked.get()->merge(x).get()->tojson(false, 1) != "[4,null,1,2,3]"  ||
+      x.get()->merge(indexed).get()->tojson(false, 1) != "[1,2,3,5,null]"  ||
+      x.get()->merge(unmasked).get()->tojson(false, 1) != "[1,2,3,4,5]"  ||
+      x.get()->merge(empty).get()->tojson(false, 1) != "[1,2,3]") {
+    return -1;
+  }
+  if (!x.get()->mergeable(masked, false)  ||
+      !list.get()->mergeable(empty, false)  ||
+      list.get()->mergeable(masked, false)) {
+    return -1;
+  }
+
+  // A union absorbs whatever is merged with it.
+  ContentPtr both = x.get()->merge_as_union(list);
+  if (both.get()->kind() != ContentKind::UnionArray8_64  ||
+      both.get()->tojson(false, 1) != "[1,2,3,[1,2],[3]]") {
+    return -1;
+  }
+  ContentPtr more = y.get()->merge(both);
+  if (more.get()->kind() != ContentKind::UnionArray8_64  ||
+      more.get()->tojson(false, 1) != "[4,5,1,2,3,[1,2],[3]]") {
+    return -1;
+  }
+
+  // Nodes that cannot wrap others have no reverse_merge.
+  try {
+    x.get()->reverse_merge(y);
+    return -1;
+  }
+  catch (std::runtime_error&) { }
+
+  return 0;
+}
@@ -0,0 +1,203 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+bool
+roundtrip(const std::string& source) {
+  ContentPtr array = FromJsonString(source.c_str(),
+                                    ArrayBuilderOptions(8, 1.5));
+  return array.get()->tojson(false, 1) == source;
+}
+
+int main(int, char**) {
+  // Everything the JSON reader can build is written back the same way.
+  if (!roundtrip("[[1,2,3],[],[4,5]]")  ||
+      !roundtrip("[[[1],[2,3]],[],[[]],[[4,5]]]")  ||
+      !roundtrip("[1.5,2.5,-3.5]")  ||
+      !roundtrip("[true,false,true]")  ||
+      !roundtrip("[\"one\",\"\",\"three\"]")  ||
+      !roundtrip("[[\"a\",\"bc\"],[],[\"def\"]]")  ||
+      !roundtrip("[1,null,3,null]")  ||
+      !roundtrip("[[1,2],null,[3]]")  ||
+      !roundtrip("[1,[2,3],\"four\",null]")  ||
+      !roundtrip("[{\"x\":1,\"y\":[1]},{\"x\":2,\"y\":[]},"
+                 "{\"x\":3,\"y\":[3,3,3]}]")  ||
+      !roundtrip("[{\"x\":1,\"y\":{\"z\":\"a\"}},null,"
+                 "{\"x\":3,\"y\":{\"z\":\"bc\"}}]")) {
+    return -1;
+  }
+
+  ContentPtr x = numbers({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+
+  // Lists whose starts and stops are not in order, over an IndexedArray.
+  Index64 starts(3);
+  Index64 stops(3);
+  starts.setitem_at_nowrap(0, 4);
+  stops.setitem_at_nowrap(0, 7);
+  starts.setitem_at_nowrap(1, 0);
+  stops.setitem_at_nowrap(1, 2);
+  starts.setitem_at_nowrap(2, 5);
+  stops.setitem_at_nowrap(2, 5);
+  Index64 index(8);
+  int64_t indexvalues[8] = { 9, 8, 2, 3, 4, 0, 1, 2 };
+  for (int64_t i = 0;  i < 8;  i++) {
+    index.setitem_at_nowrap(i, indexvalues[i]);
+  }
+  ContentPtr indexed = std::make_shared<IndexedArray64>(Identities::none(),
+                                                        util::Parameters(),
+                                                        index,
+                                                        x);
+  ContentPtr list = std::make_shared<ListArray64>(Identities::none(),
+                                                  util::Parameters(),
+                                                  starts,
+                                                  stops,
+                                                  indexed);
+  if (list.get()->tojson(false, 1) != "[[4,0,1],[9,8],[]]") {
+    return -1;
+  }
+
+  // Masks with runs of valid and missing values.
+  Index8 bytemask(6);
+  int8_t bytes[6] = { 1, 1, 0, 1, 0, 0 };
+  for (int64_t i = 0;  i < 6;  i++) {
+    bytemask.setitem_at_nowrap(i, bytes[i]);
+  }
+  ContentPtr bytemasked = std::make_shared<ByteMaskedArray>(
+    Identities::none(), util::Parameters(), bytemask, x, true);
+  if (bytemasked.get()->tojson(false, 1) != "[0,1,null,3,null,null]") {
+    return -1;
+  }
+  IndexU8 bitmask(2);
+  bitmask.setitem_at_nowrap(0, 0x8f);   // 10001111
+  bitmask.setitem_at_nowrap(1, 0x01);
+  ContentPtr lsb = std::make_shared<BitMaskedArray>(
+    Identities::none(), util::Parameters(), bitmask, x, true, 10, true);
+  ContentPtr msb = std::make_shared<BitMaskedArray>(
+    Identities::none(), util::Parameters(), bitmask, x, false, 10, false);
+  if (lsb.get()->tojson(false, 1) !=
+        "[0,1,2,3,null,null,null,7,8,null]"  ||
+      msb.get()->tojson(false, 1) !=
+        "[null,1,2,3,null,null,null,null,8,9]") {
+    return -1;
+  }
+
+  // Regular lists of strided and multidimensional data.
+  ContentPtr regular = std::make_shared<RegularArray>(Identities::none(),
+                                                      util::Parameters(),
+                                                      x,
+                                                      3);
+  if (regular.get()->tojson(false, 1) != "[[0,1,2],[3,4,5],[6,7,8]]") {
+    return -1;
+  }
+  std::shared_ptr<int32_t> ptr = util::allocate<int32_t>(6);
+  for (int32_t i = 0;  i < 6;  i++) {
+    ptr.get()[i] = i;
+  }
+  ContentPtr matrix = std::make_shared<NumpyArray>(
+    Identities::none(),
+    util::Parameters(),
+    ptr,
+    std::vector<ssize_t>({ 3, 2 }),
+    std::vector<ssize_t>({ 8, 4 }),
+    0,
+    4,
+    "i");
+  ContentPtr column = std::make_shared<NumpyArray>(
+    Identities::none(),
+    util::Parameters(),
+    ptr,
+    std::vector<ssize_t>({ 3 }),
+    std::vector<ssize_t>({ 8 }),
+    4,
+    4,
+    "i");
+  ContentPtr regularmatrix = std::make_shared<RegularArray>(
+    Identities::none(), util::Parameters(), matrix, 1);
+  if (regularmatrix.get()->tojson(false, 1) != "[[[0,1]],[[2,3]],[[4,5]]]"  ||
+      column.get()->tojson(false, 1) != "[1,3,5]") {
+    return -1;
+  }
+
+  // Strings whose characters are not contiguous.
+  std::shared_ptr<uint8_t> chars = util::allocate<uint8_t>(8);
+  std::memcpy(chars.get(), "aXbXcXdX", 8);
+  util::Parameters charparams;
+  charparams["__array__"] = "\"char\"";
+  ContentPtr everyother = std::make_shared<NumpyArray>(
+    Identities::none(),
+    charparams,
+    chars,
+    std::vector<ssize_t>({ 4 }),
+    std::vector<ssize_t>({ 2 }),
+    0,
+    1,
+    "B");
+  Index64 stringoffsets(3);
+  stringoffsets.setitem_at_nowrap(0, 0);
+  stringoffsets.setitem_at_nowrap(1, 1);
+  stringoffsets.setitem_at_nowrap(2, 4);
+  util::Parameters stringparams;
+  stringparams["__array__"] = "\"string\"";
+  ContentPtr strings = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                           stringparams,
+                                                           stringoffsets,
+                                                           everyother);
+  if (strings.get()->tojson(false, 1) != "[\"a\",\"bcd\"]") {
+    return -1;
+  }
+
+  // The file writer takes the same path.
+  std::FILE* file = std::tmpfile();
+  if (file == nullptr) {
+    return -1;
+  }
+  list.get()->tojson(file, false, 1, 16);
+  std::fflush(file);
+  std::rewind(file);
+  char buffer[64];
+  size_t size = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+  buffer[size] = '\0';
+  std::fclose(file);
+  if (std::string(buffer) != "[[[4,0,1],[9,8],[]]]") {
+    return -1;
+  }
+
+  // Errors in the offsets are still reported.
+  Index64 badstops(3);
+  badstops.setitem_at_nowrap(0, 7);
+  badstops.setitem_at_nowrap(1, 2);
+  badstops.setitem_at_nowrap(2, 50);
+  starts.setitem_at_nowrap(2, 0);
+  ContentPtr bad = std::make_shared<ListArray64>(Identities::none(),
+                                                 util::Parameters(),
+                                                 starts,
+                                                 badstops,
+                                                 x);
+  try {
+    bad.get()->tojson(false, 1);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  return 0;
+}
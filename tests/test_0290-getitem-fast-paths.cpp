@@ -0,0 +1,121 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+using namespace awkward;
+
+// The same slice followed by an ellipsis takes the general path.
+const std::string
+general(const ContentPtr& array, const SliceItemPtr& item) {
+  Slice where;
+  where.append(item);
+  where.append(SliceEllipsis());
+  where.become_sealed();
+  return array.get()->getitem(where).get()->tojson(false, 1);
+}
+
+const std::string
+fast(const ContentPtr& array, const SliceItemPtr& item) {
+  Slice where;
+  where.append(item);
+  where.become_sealed();
+  return array.get()->getitem(where).get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  ContentPtr array = FromJsonString(
+    "[{\"x\": 1, \"y\": [1]}, {\"x\": 2, \"y\": []}, "
+    "{\"x\": 3, \"y\": [3, 3, 3]}, {\"x\": 4, \"y\": [4, 4]}]",
+    ArrayBuilderOptions(8, 1.5));
+  ContentPtr lists = FromJsonString("[[1, 2, 3], [], [4, 5], [6]]",
+                                    ArrayBuilderOptions(8, 1.5));
+
+  Index64 index(3);
+  index.setitem_at_nowrap(0, 3);
+  index.setitem_at_nowrap(1, -4);
+  index.setitem_at_nowrap(2, 2);
+  SliceItemPtr items[6] = {
+    std::make_shared<SliceAt>(2),
+    std::make_shared<SliceAt>(-1),
+    std::make_shared<SliceRange>(1, Slice::none(), Slice::none()),
+    std::make_shared<SliceRange>(-3, -1, 1),
+    std::make_shared<SliceArray64>(index,
+                                   std::vector<int64_t>({ 3 }),
+                                   std::vector<int64_t>({ 1 }),
+                                   false),
+    std::make_shared<SliceField>("y")
+  };
+  for (int i = 0;  i < 6;  i++) {
+    if (fast(array, items[i]) != general(array, items[i])) {
+      return -1;
+    }
+    if (i < 5  &&  fast(lists, items[i]) != general(lists, items[i])) {
+      return -1;
+    }
+  }
+  if (fast(lists, items[4]) != "[[6],[1,2,3],[4,5]]"  ||
+      fast(array, items[5]) != "[[1],[],[3,3,3],[4,4]]") {
+    return -1;
+  }
+
+  // An integer array picks by carry, which a RecordArray defers.
+  ContentPtr picked = array.get()->getitem(Slice({ items[4] }, true));
+  RecordArray* raw = dynamic_cast<RecordArray*>(picked.get());
+  if (raw == nullptr  ||  !raw->has_lazycarry()) {
+    return -1;
+  }
+
+  // Out-of-bounds items still fail.
+  Index64 bad(1);
+  bad.setitem_at_nowrap(0, 4);
+  SliceItemPtr baditems[3] = {
+    std::make_shared<SliceAt>(4),
+    std::make_shared<SliceArray64>(bad,
+                                   std::vector<int64_t>({ 1 }),
+                                   std::vector<int64_t>({ 1 }),
+                                   false),
+    std::make_shared<SliceField>("z")
+  };
+  for (int i = 0;  i < 3;  i++) {
+    try {
+      fast(array, baditems[i]);
+      return -1;
+    }
+    catch (std::invalid_argument&) { }
+  }
+
+  // Tails are views that share the items.
+  Slice where;
+  where.append(SliceAt(0));
+  where.append(SliceRange(0, 1, 1));
+  where.append(SliceField("x"));
+  Slice copy = where;
+  copy.append(SliceEllipsis());
+  if (where.length() != 3  ||  copy.length() != 4) {
+    return -1;
+  }
+  where.become_sealed();
+  Slice tail = where.tail();
+  Slice tailtail = tail.tail();
+  if (tail.length() != 2  ||  tail.head().get()->kind() != SliceKind::range  ||
+      tailtail.length() != 1  ||  tailtail.tostring() != "[\"x\"]"  ||
+      tailtail.tail().length() != 0  ||  tailtail.tail().head() != nullptr  ||
+      tailtail.tail().tail().length() != 0) {
+    return -1;
+  }
+  if (tail.items().size() != 2  ||  tail.dimlength() != 1  ||
+      tail.prepended(std::make_shared<SliceAt>(1)).tostring() !=
+        "[1, 0:1, \"x\"]") {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,35 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/NumpyArray.h"
+
+using namespace awkward;
+
+int main(int, char**) {
+  Index64 index(5);
+  for (int64_t i = 0;  i < 5;  i++) {
+    index.setitem_at_nowrap(i, i);
+  }
+  NumpyArray array(index);
+
+  // A contiguous array is copied, not shared, when its arrays are copied.
+  ContentPtr copy = array.deep_copy(true, true, true);
+  NumpyArray* raw = static_cast<NumpyArray*>(copy.get());
+  if (raw->ptr().get() == array.ptr().get()  ||
+      copy.get()->tojson(false, 1) != "[0,1,2,3,4]") {
+    return -1;
+  }
+  index.setitem_at_nowrap(0, 100);
+  if (copy.get()->tojson(false, 1) != "[0,1,2,3,4]") {
+    return -1;
+  }
+
+  // And shared when they are not.
+  ContentPtr shared = array.deep_copy(false, true, true);
+  if (static_cast<NumpyArray*>(shared.get())->ptr().get() !=
+      array.ptr().get()) {
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,35 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_unmergeable_after_empty():
+    assert awkward1.to_list(awkward1.concatenate([[], [1, 2, 3], [{"x": 1}]])) == [1, 2, 3, {"x": 1}]
+    assert awkward1.to_list(awkward1.concatenate([[], [0, 1, 2], [{"x": 0}, {"x": 1}], [3]])) == [0, 1, 2, {"x": 0}, {"x": 1}, 3]
+
+def test_many_arrays():
+    arrays = [awkward1.Array(numpy.array([i, i % 7])) for i in range(300)]
+    expected = sum([[i, i % 7] for i in range(300)], [])
+    assert awkward1.to_list(awkward1.concatenate(arrays)) == expected
+
+    lists = [awkward1.Array([[i], [], list(range(i % 5))]) for i in range(100)]
+    expected = sum([[[i], [], list(range(i % 5))] for i in range(100)], [])
+    assert awkward1.to_list(awkward1.concatenate(lists)) == expected
+
+def test_options_and_unions():
+    assert awkward1.to_list(awkward1.concatenate([[1, 2], [3, None], [None, 5]])) == [1, 2, 3, None, None, 5]
+    assert awkward1.to_list(awkward1.concatenate([[1, [2, 3]], [4], [[5], 6.5], [{"x": 7}]])) == [1, [2, 3], 4, [5], 6.5, {"x": 7}]
+
+def test_mergebool():
+    assert awkward1.to_list(awkward1.concatenate([[True], [2]], mergebool=True)) == [1, 2]
+    assert awkward1.to_list(awkward1.concatenate([[True], [2]], mergebool=False)) == [True, 2]
+
+def test_partitioned():
+    array = awkward1.partition.IrregularlyPartitionedArray([awkward1.from_iter([], highlevel=False), awkward1.from_iter([1, 2, 3], highlevel=False), awkward1.from_iter([{"x": 1}], highlevel=False)])
+    assert awkward1.to_list(array.toContent()) == [1, 2, 3, {"x": 1}]
@@ -0,0 +1,182 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+// The same inputs, merged one at a time.
+const std::string
+pairwise(const ContentPtrVec& arrays) {
+  ContentPtr out = arrays[0];
+  for (size_t i = 1;  i < arrays.size();  i++) {
+    out = out.get()->merge(arrays[i]);
+  }
+  return out.get()->tojson(false, 1);
+}
+
+ContentPtr
+merged_many(const ContentPtrVec& arrays, bool mergebool) {
+  ContentPtrVec others(arrays.begin() + 1, arrays.end());
+  return arrays[0].get()->merge_many(others, mergebool);
+}
+
+const std::string
+many(const ContentPtrVec& arrays) {
+  return merged_many(arrays, true).get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  // Numbers are promoted to a common dtype and filled once.
+  ContentPtrVec numbers({ numpy<int32_t>({ 1, -2 }, "i"),
+                          numpy<uint8_t>({ 3 }, "B"),
+                          fromjson("[]"),
+                          numpy<bool>({ true }, "?"),
+                          numpy<float>({ 4.5f }, "f") });
+  if (many(numbers) != pairwise(numbers)  ||
+      many(numbers) != "[1.0,-2.0,3.0,1.0,4.5]") {
+    return -1;
+  }
+  ContentPtr merged = merged_many(
+    ContentPtrVec(numbers.begin(), numbers.begin() + 4), true);
+  if (static_cast<NumpyArray*>(merged.get())->dtype() !=
+        util::dtype::int64) {
+    return -1;
+  }
+
+  // Hundreds of chunks, as from reading many files.
+  ContentPtrVec chunks;
+  for (int64_t i = 0;  i < 600;  i++) {
+    chunks.push_back(numpy<int64_t>({ i, i % 7 }, "q"));
+  }
+  if (many(chunks) != pairwise(chunks)) {
+    return -1;
+  }
+
+  // Large enough for the fill kernels to use several threads, if enabled.
+  ContentPtrVec large;
+  for (int64_t i = 0;  i < 8;  i++) {
+    large.push_back(numpy<int64_t>(std::vector<int64_t>(100000, i), "q"));
+  }
+  merged = merged_many(large, true);
+  if (merged.get()->length() != 800000) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < 8;  i++) {
+    if (merged.get()->getitem_range(i*100000 + 99999, i*100000 + 100001)
+          .get()->tojson(false, 1) !=
+        (i == 7 ? "[7]" : "[" + std::to_string(i) + "," +
+                          std::to_string(i + 1) + "]")) {
+      return -1;
+    }
+  }
+
+  // Lists of any kind have their starts and stops shifted past the
+  // contents before them.
+  ContentPtr regular = std::make_shared<RegularArray>(
+    Identities::none(), util::Parameters(), numpy<int64_t>({ 7, 8 }, "q"), 1);
+  ContentPtr sliced =
+    fromjson("[[0], [1, 2, 3], [4, 5]]").get()->getitem_range_nowrap(1, 3);
+  Index32 starts(2);
+  Index32 stops(2);
+  starts.setitem_at_nowrap(0, 3);
+  stops.setitem_at_nowrap(0, 5);
+  starts.setitem_at_nowrap(1, 0);
+  stops.setitem_at_nowrap(1, 3);
+  ContentPtr listarray = std::make_shared<ListArray32>(
+    Identities::none(),
+    util::Parameters(),
+    starts,
+    stops,
+    numpy<double>({ 1, 2, 3, 4, 5 }, "d"));
+  ContentPtrVec lists({ fromjson("[[1, 2], []]"),
+                        listarray,
+                        sliced,
+                        regular,
+                        fromjson("[]"),
+                        fromjson("[[9.5]]") });
+  if (many(lists) != pairwise(lists)  ||
+      many(lists) != "[[1.0,2.0],[],[4.0,5.0],[1.0,2.0,3.0],[1.0,2.0,3.0],"
+                     "[4.0,5.0],[7.0],[8.0],[9.5]]") {
+    return -1;
+  }
+  // The first can be any of them.
+  std::swap(lists[0], lists[1]);
+  if (many(lists) != pairwise(lists)) {
+    return -1;
+  }
+
+  // Records are merged field by field, in any field order.
+  ContentPtrVec records({ fromjson("[{\"x\": 1, \"y\": [1]}]"),
+                          fromjson("[{\"y\": [], \"x\": 2}, "
+                                   "{\"y\": [3, 3], \"x\": 3}]"),
+                          fromjson("[{\"x\": 4, \"y\": [4]}]") });
+  if (many(records) != pairwise(records)) {
+    return -1;
+  }
+
+  // Option-type and indexed inputs have their indexes shifted past the
+  // contents before them.
+  ContentPtrVec options({ fromjson("[1, 2]"),
+                          fromjson("[3, null]"),
+                          fromjson("[4]"),
+                          fromjson("[null, 5]") });
+  merged = merged_many(options, true);
+  if (merged.get()->kind() != ContentKind::IndexedOptionArray64  ||
+      merged.get()->tojson(false, 1) != pairwise(options)  ||
+      merged.get()->tojson(false, 1) != "[1,2,3,null,4,null,5]") {
+    return -1;
+  }
+
+  // Arrays that can't be merged become a union of those that can, no
+  // matter which comes first.
+  ContentPtrVec unmergeable({ fromjson("[]"),
+                              fromjson("[0, 1, 2]"),
+                              fromjson("[{\"x\": 0}, {\"x\": 1}]"),
+                              fromjson("[3]") });
+  merged = merged_many(unmergeable, true);
+  if (merged.get()->kind() != ContentKind::UnionArray8_64  ||
+      static_cast<UnionArray8_64*>(merged.get())->numcontents() != 2  ||
+      merged.get()->tojson(false, 1) !=
+        "[0,1,2,{\"x\":0},{\"x\":1},3]") {
+    return -1;
+  }
+
+  // Unions are merged with each other and with anything else in one pass,
+  // their contents grouped by whether they can be merged.
+  ContentPtrVec unions({ fromjson("[1, [2, 3]]"),
+                         fromjson("[4]"),
+                         fromjson("[[5], 6.5]"),
+                         fromjson("[{\"x\": 7}]") });
+  merged = merged_many(unions, true);
+  if (merged.get()->kind() != ContentKind::UnionArray8_64  ||
+      static_cast<UnionArray8_64*>(merged.get())->numcontents() != 3  ||
+      merged.get()->tojson(false, 1) !=
+        "[1.0,[2,3],4.0,[5],6.5,{\"x\":7}]") {
+    return -1;
+  }
+
+  // Booleans are kept apart from numbers unless mergebool.
+  ContentPtrVec booleans({ numpy<bool>({ true }, "?"),
+                           numpy<int64_t>({ 2 }, "q") });
+  if (merged_many(booleans, false).get()->kind() !=
+        ContentKind::UnionArray8_64  ||
+      merged_many(booleans, false).get()->tojson(false, 1) != "[true,2]"  ||
+      merged_many(booleans, true).get()->tojson(false, 1) != "[1,2]") {
+    return -1;
+  }
+
+  return 0;
+}
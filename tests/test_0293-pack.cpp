@@ -0,0 +1,144 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+ContentPtr
+take(const ContentPtr& array, const std::vector<int64_t>& values) {
+  Index64 index((int64_t)values.size());
+  for (size_t i = 0;  i < values.size();  i++) {
+    index.setitem_at_nowrap((int64_t)i, values[i]);
+  }
+  Slice where;
+  where.append(SliceArray64(index,
+                            std::vector<int64_t>({ (int64_t)values.size() }),
+                            std::vector<int64_t>({ 1 }),
+                            false));
+  where.become_sealed();
+  return array.get()->getitem(where);
+}
+
+// The packed array has the same values and no more bytes.
+bool
+same(const ContentPtr& array, const ContentPtr& packed) {
+  return packed.get()->tojson(false, 1) == array.get()->tojson(false, 1)  &&
+         packed.get()->nbytes() <= array.get()->nbytes();
+}
+
+int64_t
+content_length(const ContentPtr& list) {
+  ListOffsetArray64* raw = dynamic_cast<ListOffsetArray64*>(list.get());
+  if (raw == nullptr  ||  raw->offsets().getitem_at_nowrap(0) != 0) {
+    return -1;
+  }
+  return raw->content().get()->length();
+}
+
+int main(int, char**) {
+  ContentPtr lists = fromjson(
+    "[[0, 1, 2], [3], [], [4, 5, 6, 7], [8, 9]]");
+
+  // A range of lists keeps only its part of the content.
+  ContentPtr sliced = lists.get()->getitem_range_nowrap(3, 5);
+  ContentPtr packed = sliced.get()->pack();
+  if (!same(sliced, packed)  ||  content_length(packed) != 6  ||
+      packed.get()->nbytes() >= sliced.get()->nbytes()) {
+    return -1;
+  }
+
+  // Lists picked out of order are carried into order.
+  ContentPtr picked = take(lists, { 4, 0, 4 });
+  packed = picked.get()->pack();
+  if (!same(picked, packed)  ||  content_length(packed) != 7) {
+    return -1;
+  }
+
+  // Option types keep only their valid items.
+  ContentPtr options = fromjson("[1, null, 3, null, 5, 6]");
+  ContentPtr tail = options.get()->getitem_range_nowrap(2, 5);
+  packed = tail.get()->pack();
+  IndexedOptionArray64* rawoption =
+    dynamic_cast<IndexedOptionArray64*>(packed.get());
+  if (!same(tail, packed)  ||  rawoption == nullptr  ||
+      rawoption->content().get()->length() != 2  ||
+      rawoption->index().getitem_at_nowrap(2) != 1) {
+    return -1;
+  }
+  Index8 mask(3);
+  mask.setitem_at_nowrap(0, 1);
+  mask.setitem_at_nowrap(1, 0);
+  mask.setitem_at_nowrap(2, 1);
+  ContentPtr bytemasked = std::make_shared<ByteMaskedArray>(
+    Identities::none(), util::Parameters(), mask, lists, true);
+  packed = bytemasked.get()->pack();
+  if (!same(bytemasked, packed)  ||
+      dynamic_cast<ByteMaskedArray*>(packed.get())->content().get()
+        ->length() != 3) {
+    return -1;
+  }
+
+  // Records resolve their lazy carry and trim their fields.
+  ContentPtr records = fromjson(
+    "[{\"x\": 1, \"y\": [1]}, {\"x\": 2, \"y\": [2, 2]}, "
+    "{\"x\": 3, \"y\": [3, 3, 3]}]");
+  picked = take(records, { 2, 2 });
+  packed = picked.get()->pack();
+  RecordArray* rawrecord = dynamic_cast<RecordArray*>(packed.get());
+  if (!same(picked, packed)  ||  rawrecord == nullptr  ||
+      rawrecord->has_lazycarry()  ||
+      content_length(rawrecord->field("y")) != 6) {
+    return -1;
+  }
+  ContentPtr record = records.get()->getitem_at_nowrap(1);
+  if (record.get()->pack().get()->tojson(false, 1) !=
+        record.get()->tojson(false, 1)) {
+    return -1;
+  }
+
+  // Unions keep only each content's own items.
+  ContentPtr unions = fromjson("[1, \"a\", [2], 3, \"bc\", [4, 5]]");
+  sliced = unions.get()->getitem_range_nowrap(3, 5);
+  packed = sliced.get()->pack();
+  UnionArray8_64* rawunion = dynamic_cast<UnionArray8_64*>(packed.get());
+  if (!same(sliced, packed)  ||  rawunion == nullptr  ||
+      rawunion->content(0).get()->length() != 1  ||
+      rawunion->content(1).get()->length() != 1  ||
+      rawunion->content(2).get()->length() != 0) {
+    return -1;
+  }
+
+  // Regular lists and numbers are trimmed and copied.
+  ContentPtr numbers = fromjson("[0, 1, 2, 3, 4, 5, 6, 7]");
+  ContentPtr regular = std::make_shared<RegularArray>(
+    Identities::none(), util::Parameters(), numbers, 3);
+  packed = regular.get()->pack();
+  if (!same(regular, packed)  ||
+      dynamic_cast<RegularArray*>(packed.get())->content().get()
+        ->length() != 6) {
+    return -1;
+  }
+  sliced = numbers.get()->getitem_range_nowrap(6, 8);
+  packed = sliced.get()->pack();
+  if (!same(sliced, packed)  ||  packed.get()->nbytes() != 16) {
+    return -1;
+  }
+
+  return 0;
+}
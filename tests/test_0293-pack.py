@@ -0,0 +1,50 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_lists():
+    layout = awkward1.from_iter([[0, 1, 2], [3], [], [4, 5, 6, 7], [8, 9]], highlevel=False)
+    sliced = layout[3:]
+    packed = sliced.pack()
+    assert awkward1.to_list(packed) == [[4, 5, 6, 7], [8, 9]]
+    assert numpy.asarray(packed.offsets).tolist() == [0, 4, 6]
+    assert len(packed.content) == 6
+    assert packed.nbytes < sliced.nbytes
+
+    picked = layout[[4, 0, 4]]
+    packed = picked.pack()
+    assert awkward1.to_list(packed) == [[8, 9], [0, 1, 2], [8, 9]]
+    assert isinstance(packed, awkward1.layout.ListOffsetArray64)
+    assert len(packed.content) == 7
+
+def test_options():
+    layout = awkward1.from_iter([1, None, 3, None, 5, 6], highlevel=False)
+    packed = layout[2:5].pack()
+    assert awkward1.to_list(packed) == [3, None, 5]
+    assert isinstance(packed, awkward1.layout.IndexedOptionArray64)
+    assert len(packed.content) == 2
+
+def test_records():
+    layout = awkward1.from_iter([{"x": 1, "y": [1]}, {"x": 2, "y": [2, 2]}, {"x": 3, "y": [3, 3, 3]}], highlevel=False)
+    packed = layout[[2, 2]].pack()
+    assert awkward1.to_list(packed) == [{"x": 3, "y": [3, 3, 3]}, {"x": 3, "y": [3, 3, 3]}]
+    assert len(packed.field("y").content) == 6
+
+def test_unions():
+    layout = awkward1.from_iter([1, "a", [2], 3, "bc", [4, 5]], highlevel=False)
+    packed = layout[3:5].pack()
+    assert awkward1.to_list(packed) == [3, "bc"]
+    assert [len(x) for x in packed.contents] == [1, 1, 0]
+
+def test_numbers():
+    layout = awkward1.layout.NumpyArray(numpy.arange(8, dtype=numpy.int64))
+    packed = layout[6:].pack()
+    assert awkward1.to_list(packed) == [6, 7]
+    assert packed.nbytes == 16
@@ -0,0 +1,161 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Reducer.h"
+#include "awkward/Slice.h"
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+const std::string
+json(const ContentPtr& array) {
+  return array.get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  // 21 elements over three bytes, so that every path crosses a byte
+  // boundary and ends in a partial byte.
+  IndexU8 bitmask(3);
+  bitmask.setitem_at_nowrap(0, 0x8f);
+  bitmask.setitem_at_nowrap(1, 0x31);
+  bitmask.setitem_at_nowrap(2, 0xda);
+  ContentPtr x = numbers(21);
+  ContentPtr lists = FromJsonString(
+    "[[0],[1,1],[],[3],[4,4,4],[5],[],[7],[8,8],[9],[10],"
+    "[11,11],[],[13],[14],[15],[16],[17,17],[],[19],[20]]",
+    ArrayBuilderOptions(8, 1.5));
+
+  for (int order = 0;  order < 2;  order++) {
+    for (int valid = 0;  valid < 2;  valid++) {
+      for (int kind = 0;  kind < 2;  kind++) {
+        ContentPtr content = (kind == 0 ? x : lists);
+        std::shared_ptr<BitMaskedArray> bits =
+          std::make_shared<BitMaskedArray>(Identities::none(),
+                                           util::Parameters(),
+                                           bitmask,
+                                           content,
+                                           valid == 1,
+                                           21,
+                                           order == 1);
+        std::shared_ptr<ByteMaskedArray> bytes =
+          bits.get()->toByteMaskedArray();
+
+        // Projection, in either bit order and for either valid_when.
+        if (json(bits.get()->project()) != json(bytes.get()->project())) {
+          return -1;
+        }
+
+        // Unaligned ranges stay BitMaskedArrays.
+        for (int64_t start = 0;  start < 21;  start += 3) {
+          for (int64_t stop = start;  stop <= 21;  stop += 5) {
+            ContentPtr range = bits.get()->getitem_range_nowrap(start, stop);
+            if (range.get()->kind() != ContentKind::BitMaskedArray  ||
+                range.get()->length() != stop - start  ||
+                json(range) !=
+                  json(bytes.get()->getitem_range_nowrap(start, stop))) {
+              return -1;
+            }
+          }
+        }
+
+        // So do carries.
+        Index64 carry(6);
+        int64_t carryvalues[6] = { 20, 0, 4, 4, 13, 9 };
+        for (int64_t i = 0;  i < 6;  i++) {
+          carry.setitem_at_nowrap(i, carryvalues[i]);
+        }
+        ContentPtr carried = bits.get()->carry(carry);
+        if (carried.get()->kind() != ContentKind::BitMaskedArray  ||
+            json(carried) != json(bytes.get()->carry(carry))) {
+          return -1;
+        }
+
+        // Slices through the option type.
+        Slice where;
+        where.append(SliceRange(2, 19, 2));
+        if (kind == 1) {
+          where.append(SliceRange(0, 1, 1));
+        }
+        where.become_sealed();
+        if (json(bits.get()->getitem(where)) !=
+            json(bytes.get()->getitem(where))) {
+          return -1;
+        }
+
+        // Reductions skip the missing values.
+        if (kind == 1) {
+          if (json(bits.get()->num(1, 0)) != json(bytes.get()->num(1, 0))  ||
+              json(bits.get()->localindex(1, 0)) !=
+                json(bytes.get()->localindex(1, 0))  ||
+              json(bits.get()->reduce(ReducerSum(), -1, false, false)) !=
+                json(bytes.get()->reduce(ReducerSum(), -1, false, false))) {
+            return -1;
+          }
+        }
+        else {
+          Index64 offsets(3);
+          offsets.setitem_at_nowrap(0, 0);
+          offsets.setitem_at_nowrap(1, 10);
+          offsets.setitem_at_nowrap(2, 21);
+          ContentPtr bitlists = std::make_shared<ListOffsetArray64>(
+            Identities::none(), util::Parameters(), offsets, bits);
+          ContentPtr bytelists = std::make_shared<ListOffsetArray64>(
+            Identities::none(), util::Parameters(), offsets, bytes);
+          if (json(bitlists.get()->reduce(ReducerSum(), -1, false, false)) !=
+              json(bytelists.get()->reduce(ReducerSum(), -1, false, false))) {
+            return -1;
+          }
+        }
+      }
+    }
+  }
+
+  // Counting works on whole words.
+  IndexU8 longmask(19);
+  for (int64_t i = 0;  i < 19;  i++) {
+    longmask.setitem_at_nowrap(i, (uint8_t)(i * 37 + 11));
+  }
+  std::shared_ptr<BitMaskedArray> longbits =
+    std::make_shared<BitMaskedArray>(Identities::none(),
+                                     util::Parameters(),
+                                     longmask,
+                                     numbers(150),
+                                     true,
+                                     150,
+                                     true);
+  if (json(longbits.get()->project()) !=
+      json(longbits.get()->toByteMaskedArray().get()->project())) {
+    return -1;
+  }
+
+  // Out-of-range carries are reported.
+  std::shared_ptr<BitMaskedArray> bits =
+    std::make_shared<BitMaskedArray>(Identities::none(),
+                                     util::Parameters(),
+                                     bitmask,
+                                     x,
+                                     true,
+                                     21,
+                                     true);
+  Index64 bad(1);
+  bad.setitem_at_nowrap(0, 21);
+  try {
+    bits.get()->carry(bad);
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/virtual/ArrayCache.h"
+#include "awkward/virtual/ArrayGenerator.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+int main(int, char**) {
+  // Ten 8-byte integers are 80 bytes, so three of them fit in 250.
+  std::vector<std::string> evicted;
+  LRUArrayCache cache(250,
+                      [&evicted](const std::string& key,
+                                 const ContentPtr& value) -> void {
+                        if (value.get()->length() != 10) {
+                          throw std::runtime_error("wrong value evicted");
+                        }
+                        evicted.push_back(key);
+                      });
+  cache.set("a", numbers(10));
+  cache.set("b", numbers(10));
+  cache.set("c", numbers(10));
+  if (cache.length() != 3  ||  cache.nbytes() != 240  ||
+      !evicted.empty()) {
+    return -1;
+  }
+
+  // Getting "a" makes "b" the least recently used.
+  if (cache.get("a").get() == nullptr  ||  cache.get("z").get() != nullptr) {
+    return -1;
+  }
+  cache.set("d", numbers(10));
+  if (evicted != std::vector<std::string>({ "b" })  ||
+      cache.has("b")  ||  !cache.has("a")  ||
+      cache.keys() != std::vector<std::string>({ "d", "a", "c" })) {
+    return -1;
+  }
+
+  // Overwriting replaces the bytes rather than adding to them.
+  cache.set("d", numbers(10));
+  if (cache.length() != 3  ||  cache.nbytes() != 240  ||
+      evicted.size() != 1) {
+    return -1;
+  }
+
+  // An array larger than the whole budget is never retained.
+  try {
+    cache.set("big", numbers(100));
+    return -1;
+  }
+  catch (std::runtime_error&) { }
+  if (cache.has("big")  ||  cache.nbytes() != 240) {
+    return -1;
+  }
+
+  // Erasing and clearing do not count as evictions.
+  if (!cache.erase("a")  ||  cache.erase("a")  ||  cache.nbytes() != 160) {
+    return -1;
+  }
+  cache.clear();
+  if (cache.length() != 0  ||  cache.nbytes() != 0  ||
+      evicted.size() != 1) {
+    return -1;
+  }
+
+  // A VirtualArray looks up its array in the cache.
+  std::shared_ptr<LRUArrayCache> shared =
+    std::make_shared<LRUArrayCache>(1000);
+  ContentPtr content = numbers(20);
+  Slice where;
+  where.append(SliceRange(5, 15, 1));
+  where.become_sealed();
+  ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
+    content.get()->form(true), 10, content, where);
+  VirtualArray virtualarray(Identities::none(),
+                            util::Parameters(),
+                            generator,
+                            shared,
+                            "x");
+  if (virtualarray.peek_array().get() != nullptr) {
+    return -1;
+  }
+  ContentPtr first = virtualarray.array();
+  if (!shared.get()->has("x")  ||
+      virtualarray.array().get() != first.get()  ||
+      first.get()->tojson(false, 1) != "[5,6,7,8,9,10,11,12,13,14]") {
+    return -1;
+  }
+
+  // Many threads share one cache.
+  std::shared_ptr<LRUArrayCache> threaded =
+    std::make_shared<LRUArrayCache>(800);
+  std::atomic<int64_t> numevicted{0};
+  threaded.get()->set_on_evict(
+    [&numevicted](const std::string&, const ContentPtr&) -> void {
+      numevicted++;
+    });
+  std::vector<std::thread> threads;
+  for (int64_t t = 0;  t < 4;  t++) {
+    threads.push_back(std::thread([threaded, t]() -> void {
+      for (int64_t i = 0;  i < 200;  i++) {
+        std::string key = std::to_string((t * 7 + i) % 30);
+        if (threaded.get()->get(key).get() == nullptr) {
+          threaded.get()->set(key, numbers(10));
+        }
+      }
+    }));
+  }
+  for (auto& x : threads) {
+    x.join();
+  }
+  if (threaded.get()->nbytes() > 800  ||
+      threaded.get()->nbytes() != 80*threaded.get()->length()  ||
+      numevicted == 0) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def numbers(length):
+    return awkward1.layout.NumpyArray(numpy.arange(length, dtype=numpy.int64))
+
+def test_eviction():
+    evicted = []
+    def on_evict(key, value):
+        assert len(value) == 10
+        evicted.append(key)
+
+    # Ten 8-byte integers are 80 bytes, so three of them fit in 250.
+    cache = awkward1.layout.LRUArrayCache(250, on_evict=on_evict)
+    cache["a"] = numbers(10)
+    cache["b"] = numbers(10)
+    cache["c"] = numbers(10)
+    assert len(cache) == 3
+    assert cache.nbytes == 240
+    assert cache.maxbytes == 250
+    assert evicted == []
+
+    assert awkward1.to_list(cache["a"]) == list(range(10))
+    with pytest.raises(KeyError):
+        cache["z"]
+    cache["d"] = numbers(10)
+    assert evicted == ["b"]
+    assert "b" not in cache
+    assert "a" in cache
+    assert cache.keys() == ["d", "a", "c"]
+    assert list(cache) == ["d", "a", "c"]
+
+    cache["d"] = numbers(10)
+    assert cache.nbytes == 240
+    assert evicted == ["b"]
+
+    with pytest.raises(RuntimeError):
+        cache["big"] = numbers(100)
+    assert "big" not in cache
+
+    del cache["a"]
+    with pytest.raises(KeyError):
+        del cache["a"]
+    assert cache.nbytes == 160
+    cache.clear()
+    assert len(cache) == 0
+    assert evicted == ["b"]
+
+def test_set_on_evict():
+    evicted = []
+    cache = awkward1.layout.LRUArrayCache(100)
+    cache["a"] = numbers(10)
+    cache.set_on_evict(lambda key, value: evicted.append(key))
+    cache["b"] = numbers(10)
+    assert evicted == ["a"]
+    cache.set_on_evict(None)
+    cache["c"] = numbers(10)
+    assert evicted == ["a"]
+
+def test_virtualarray():
+    cache = awkward1.layout.LRUArrayCache(1000)
+    generator = awkward1.layout.ArrayGenerator(lambda: numbers(10), form=numbers(10).form, length=10)
+    virtualarray = awkward1.layout.VirtualArray(generator, cache, cache_key="x")
+    assert virtualarray.peek_array is None
+    assert virtualarray.cache is not None
+    assert awkward1.to_list(virtualarray.array) == list(range(10))
+    assert "x" in cache
+    assert awkward1.to_list(virtualarray.peek_array) == list(range(10))
@@ -0,0 +1,187 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/virtual/ArrayCache.h"
+#include "awkward/virtual/ArrayGenerator.h"
+
+using namespace awkward;
+
+// A slow generator that counts how many times it runs.
+class CountingGenerator: public ArrayGenerator {
+public:
+  CountingGenerator(std::atomic<int64_t>& count, bool fail)
+      : ArrayGenerator(FormPtr(nullptr), 5)
+      , count_(count)
+      , fail_(fail) { }
+
+  const ContentPtr
+  generate() const override {
+    count_++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    if (fail_) {
+      throw std::runtime_error("generator failed");
+    }
+    Index64 index(5);
+    for (int64_t i = 0;  i < 5;  i++) {
+      index.setitem_at_nowrap(i, i);
+    }
+    return std::make_shared<NumpyArray>(index);
+  }
+
+  const std::string
+  tostring_part(const std::string& indent,
+                const std::string& pre,
+                const std::string& post) const override {
+    return indent + pre + "<CountingGenerator/>" + post;
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  shallow_copy() const override {
+    return std::make_shared<CountingGenerator>(count_, fail_);
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_form(const FormPtr& form) const override {
+    return shallow_copy();
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_length(int64_t length) const override {
+    return shallow_copy();
+  }
+
+private:
+  std::atomic<int64_t>& count_;
+  bool fail_;
+};
+
+// Calls array() from several threads at once; returns the number of
+// threads that got an exception.
+int64_t
+race(const std::vector<std::shared_ptr<VirtualArray>>& arrays) {
+  std::atomic<int64_t> numfailed{0};
+  std::vector<std::thread> threads;
+  for (auto& x : arrays) {
+    threads.push_back(std::thread([x, &numfailed]() -> void {
+      try {
+        if (x.get()->array().get()->length() != 5) {
+          throw std::runtime_error("wrong array");
+        }
+      }
+      catch (std::runtime_error&) {
+        numfailed++;
+      }
+    }));
+  }
+  for (auto& x : threads) {
+    x.join();
+  }
+  return numfailed;
+}
+
+int main(int, char**) {
+  // Concurrent requests for the same key wait on one generation.
+  std::atomic<int64_t> count{0};
+  std::shared_ptr<LRUArrayCache> cache = std::make_shared<LRUArrayCache>(1000);
+  std::vector<std::shared_ptr<VirtualArray>> same;
+  for (int64_t i = 0;  i < 8;  i++) {
+    same.push_back(std::make_shared<VirtualArray>(
+      Identities::none(),
+      util::Parameters(),
+      std::make_shared<CountingGenerator>(count, false),
+      cache,
+      "same"));
+  }
+  if (race(same) != 0  ||  count != 1) {
+    return -1;
+  }
+  // Hits don't generate.
+  if (race(same) != 0  ||  count != 1) {
+    return -1;
+  }
+
+  // Without a cache, too, as long as they overlap.
+  count = 0;
+  std::vector<std::shared_ptr<VirtualArray>> uncached(
+    4,
+    std::make_shared<VirtualArray>(
+      Identities::none(),
+      util::Parameters(),
+      std::make_shared<CountingGenerator>(count, false),
+      ArrayCachePtr(nullptr)));
+  if (race(uncached) != 0  ||  count != 1) {
+    return -1;
+  }
+
+  // Different keys don't wait on each other.
+  count = 0;
+  std::vector<std::shared_ptr<VirtualArray>> different;
+  for (int64_t i = 0;  i < 4;  i++) {
+    different.push_back(std::make_shared<VirtualArray>(
+      Identities::none(),
+      util::Parameters(),
+      std::make_shared<CountingGenerator>(count, false),
+      cache,
+      std::string("different") + std::to_string(i)));
+  }
+  if (race(different) != 0  ||  count != 4) {
+    return -1;
+  }
+
+  // Every waiter gets the leader's exception, and nothing is cached.
+  count = 0;
+  std::vector<std::shared_ptr<VirtualArray>> failing(
+    4,
+    std::make_shared<VirtualArray>(
+      Identities::none(),
+      util::Parameters(),
+      std::make_shared<CountingGenerator>(count, true),
+      cache,
+      "failing"));
+  if (race(failing) != 4  ||  count != 1  ||  cache.get()->has("failing")) {
+    return -1;
+  }
+
+  // Prefetching fills the cache in the background.
+  count = 0;
+  std::vector<std::shared_ptr<VirtualArray>> prefetched;
+  for (int64_t i = 0;  i < 3;  i++) {
+    prefetched.push_back(std::make_shared<VirtualArray>(
+      Identities::none(),
+      util::Parameters(),
+      std::make_shared<CountingGenerator>(count, false),
+      cache,
+      std::string("prefetched") + std::to_string(i)));
+  }
+  VirtualArray::prefetch(prefetched);
+  // Asking for one while it is being prefetched waits for the prefetch.
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  if (prefetched[0].get()->array().get()->length() != 5) {
+    return -1;
+  }
+  for (int64_t i = 0;  i < 100;  i++) {
+    if (cache.get()->has("prefetched1")  &&
+        cache.get()->has("prefetched2")) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  if (!cache.get()->has("prefetched1")  ||
+      !cache.get()->has("prefetched2")  ||
+      prefetched[2].get()->array().get()->length() != 5  ||
+      count != 3) {
+    return -1;
+  }
+
+  return 0;
+}
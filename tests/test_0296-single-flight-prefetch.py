@@ -0,0 +1,50 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import threading
+import time
+
+import pytest
+import numpy
+
+import awkward1
+
+def counting(counts, i):
+    def generate():
+        counts[i] += 1
+        time.sleep(0.05)
+        return awkward1.layout.NumpyArray(numpy.arange(5, dtype=numpy.int64))
+    return awkward1.layout.ArrayGenerator(generate, length=5)
+
+def test_prefetch():
+    counts = [0, 0, 0]
+    cache = awkward1.layout.LRUArrayCache(1000)
+    arrays = [awkward1.layout.VirtualArray(counting(counts, 0), cache),
+              awkward1.layout.VirtualArray(counting(counts, 1), cache)]
+    uncached = awkward1.layout.VirtualArray(counting(counts, 2))
+
+    awkward1.layout.VirtualArray.prefetch(arrays + [uncached])
+    assert counts[2] == 0
+    for x in arrays:
+        assert awkward1.to_list(x.array) == [0, 1, 2, 3, 4]
+    assert counts == [1, 1, 0]
+
+    with pytest.raises(ValueError):
+        awkward1.layout.VirtualArray.prefetch([awkward1.layout.NumpyArray(numpy.arange(5))])
+
+def test_single_flight():
+    counts = [0]
+    cache = awkward1.layout.LRUArrayCache(1000)
+    array = awkward1.layout.VirtualArray(counting(counts, 0), cache)
+    results = []
+    def run():
+        results.append(awkward1.to_list(array.array))
+    threads = [threading.Thread(target=run) for i in range(4)]
+    for x in threads:
+        x.start()
+    for x in threads:
+        x.join()
+    assert results == [[0, 1, 2, 3, 4]] * 4
+    assert counts == [1]
@@ -0,0 +1,186 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/virtual/ArrayCache.h"
+#include "awkward/virtual/ArrayGenerator.h"
+
+using namespace awkward;
+
+ContentPtr
+numbers(int64_t start, int64_t stop, int64_t scale) {
+  Index64 index(stop - start);
+  for (int64_t i = start;  i < stop;  i++) {
+    index.setitem_at_nowrap(i - start, i * scale);
+  }
+  return std::make_shared<NumpyArray>(index);
+}
+
+// Records {"x": i, "y": 10*i, "z": 100*i} that count how they were made.
+class ColumnGenerator: public ArrayGenerator {
+public:
+  ColumnGenerator(int64_t* counts, bool pushdown)
+      : ArrayGenerator(FormPtr(nullptr), 10)
+      , counts_(counts)
+      , pushdown_(pushdown) { }
+
+  const ContentPtr
+  make(const std::vector<std::string>& keys,
+       int64_t start,
+       int64_t stop) const {
+    ContentPtrVec contents;
+    for (auto& key : keys) {
+      int64_t scale = (key == "x" ? 1 : (key == "y" ? 10 : 100));
+      contents.push_back(numbers(start, stop, scale));
+    }
+    return std::make_shared<RecordArray>(
+      Identities::none(),
+      util::Parameters(),
+      contents,
+      util::RecordLookupPtr(new util::RecordLookup(keys)),
+      stop - start);
+  }
+
+  const ContentPtr
+  generate() const override {
+    counts_[0]++;
+    return make({ "x", "y", "z" }, 0, 10);
+  }
+
+  const ContentPtr
+  generate_fields(const std::vector<std::string>& keys) const override {
+    if (!pushdown_) {
+      return ContentPtr(nullptr);
+    }
+    counts_[1]++;
+    return make(keys, 0, 10);
+  }
+
+  const ContentPtr
+  generate_range(int64_t start, int64_t stop) const override {
+    if (!pushdown_) {
+      return ContentPtr(nullptr);
+    }
+    counts_[2]++;
+    return make({ "x", "y", "z" }, start, stop);
+  }
+
+  const std::string
+  tostring_part(const std::string& indent,
+                const std::string& pre,
+                const std::string& post) const override {
+    return indent + pre + "<ColumnGenerator/>" + post;
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  shallow_copy() const override {
+    return std::make_shared<ColumnGenerator>(counts_, pushdown_);
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_form(const FormPtr& form) const override {
+    return shallow_copy();
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_length(int64_t length) const override {
+    return shallow_copy();
+  }
+
+private:
+  int64_t* counts_;
+  bool pushdown_;
+};
+
+// Materializes the same selections from lazy and from eager arrays.
+bool
+same(const ContentPtr& lazy, const ContentPtr& eager) {
+  return lazy.get()->tojson(false, 1) == eager.get()->tojson(false, 1);
+}
+
+int main(int, char**) {
+  int64_t counts[3] = { 0, 0, 0 };
+  ContentPtr lazy = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<ColumnGenerator>(counts, true),
+    ArrayCachePtr(nullptr));
+  ColumnGenerator eagergenerator(counts, false);
+  ContentPtr eager = eagergenerator.generate();
+  counts[0] = 0;
+
+  // Fields, ranges, and their compositions go to the source.
+  if (!same(lazy.get()->getitem_field("y"), eager.get()->getitem_field("y"))
+      ||  counts[1] != 1) {
+    return -1;
+  }
+  std::vector<std::string> keys({ "z", "x" });
+  if (!same(lazy.get()->getitem_fields(keys),
+            eager.get()->getitem_fields(keys))  ||  counts[1] != 2) {
+    return -1;
+  }
+  if (!same(lazy.get()->getitem_range_nowrap(2, 7),
+            eager.get()->getitem_range_nowrap(2, 7))  ||  counts[2] != 1) {
+    return -1;
+  }
+  if (!same(lazy.get()->getitem_range_nowrap(2, 7).get()
+              ->getitem_range_nowrap(1, 3),
+            eager.get()->getitem_range_nowrap(3, 5))  ||  counts[2] != 2) {
+    return -1;
+  }
+  if (!same(lazy.get()->getitem_field("x").get()->getitem_range_nowrap(4, 6),
+            eager.get()->getitem_field("x").get()->getitem_range_nowrap(4, 6))
+      ||  counts[2] != 3) {
+    return -1;
+  }
+  if (!same(lazy.get()->getitem_range_nowrap(4, 9).get()->getitem_field("z"),
+            eager.get()->getitem_range_nowrap(4, 9).get()->getitem_field("z"))
+      ||  counts[1] != 3) {
+    return -1;
+  }
+  if (counts[0] != 0) {
+    return -1;
+  }
+
+  // Generators without the hooks fall back to generating everything.
+  int64_t fallbackcounts[3] = { 0, 0, 0 };
+  ContentPtr fallback = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<ColumnGenerator>(fallbackcounts, false),
+    ArrayCachePtr(nullptr));
+  if (!same(fallback.get()->getitem_field("y"),
+            eager.get()->getitem_field("y"))  ||
+      !same(fallback.get()->getitem_range_nowrap(2, 7).get()
+              ->getitem_field("x"),
+            eager.get()->getitem_range_nowrap(2, 7).get()
+              ->getitem_field("x"))  ||
+      fallbackcounts[0] != 2) {
+    return -1;
+  }
+
+  // Arrays that are already in the cache are sliced directly.
+  int64_t cachedcounts[3] = { 0, 0, 0 };
+  ContentPtr cached = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<ColumnGenerator>(cachedcounts, true),
+    std::make_shared<LRUArrayCache>(100000));
+  dynamic_cast<VirtualArray*>(cached.get())->array();
+  if (!same(cached.get()->getitem_field("y"),
+            eager.get()->getitem_field("y"))  ||
+      !same(cached.get()->getitem_range_nowrap(1, 2),
+            eager.get()->getitem_range_nowrap(1, 2))  ||
+      cachedcounts[0] != 1  ||  cachedcounts[1] != 0  ||
+      cachedcounts[2] != 0) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def make(keys, start, stop):
+    scale = {"x": 1, "y": 10, "z": 100}
+    return awkward1.layout.RecordArray(
+        [awkward1.layout.NumpyArray(numpy.arange(start, stop, dtype=numpy.int64) * scale[key]) for key in keys],
+        keys,
+        stop - start)
+
+def test_pushdown():
+    counts = {"all": 0, "fields": 0, "range": 0}
+    def generate():
+        counts["all"] += 1
+        return make(["x", "y", "z"], 0, 10)
+    def generate_fields(keys):
+        counts["fields"] += 1
+        return make(keys, 0, 10)
+    def generate_range(start, stop):
+        counts["range"] += 1
+        return make(["x", "y", "z"], start, stop)
+
+    generator = awkward1.layout.ArrayGenerator(generate,
+                                               length=10,
+                                               generate_fields=generate_fields,
+                                               generate_range=generate_range)
+    assert generator.generate_fields is generate_fields
+    assert generator.generate_range is generate_range
+    lazy = awkward1.layout.VirtualArray(generator)
+    eager = make(["x", "y", "z"], 0, 10)
+
+    assert awkward1.to_list(lazy["y"].array) == awkward1.to_list(eager["y"])
+    assert counts == {"all": 0, "fields": 1, "range": 0}
+    assert awkward1.to_list(lazy[["z", "x"]].array) == awkward1.to_list(eager[["z", "x"]])
+    assert counts == {"all": 0, "fields": 2, "range": 0}
+    assert awkward1.to_list(lazy[2:7].array) == awkward1.to_list(eager[2:7])
+    assert counts == {"all": 0, "fields": 2, "range": 1}
+    assert awkward1.to_list(lazy[2:7][1:3].array) == awkward1.to_list(eager[3:5])
+    assert counts == {"all": 0, "fields": 2, "range": 2}
+
+def test_declined():
+    counts = {"all": 0}
+    def generate():
+        counts["all"] += 1
+        return make(["x", "y", "z"], 0, 10)
+
+    # Hooks that return None fall back to generating everything.
+    generator = awkward1.layout.ArrayGenerator(generate,
+                                               length=10,
+                                               generate_fields=lambda keys: None,
+                                               generate_range=lambda start, stop: None)
+    lazy = awkward1.layout.VirtualArray(generator)
+    assert generator.generate_fields is not None
+    assert awkward1.to_list(lazy["x"].array) == list(range(10))
+    assert awkward1.to_list(lazy[8:].array) == awkward1.to_list(make(["x", "y", "z"], 8, 10))
+    assert counts["all"] == 2
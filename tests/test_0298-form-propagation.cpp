@@ -0,0 +1,175 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+#include "awkward/virtual/ArrayGenerator.h"
+
+using namespace awkward;
+
+// Returns a fixed array with a known Form and counts how often it runs.
+class KnownGenerator: public ArrayGenerator {
+public:
+  KnownGenerator(const ContentPtr& array, int64_t* count)
+      : ArrayGenerator(array.get()->form(true), array.get()->length())
+      , array_(array)
+      , count_(count) { }
+
+  const ContentPtr
+  generate() const override {
+    (*count_)++;
+    return array_;
+  }
+
+  const std::string
+  tostring_part(const std::string& indent,
+                const std::string& pre,
+                const std::string& post) const override {
+    return indent + pre + "<KnownGenerator/>" + post;
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  shallow_copy() const override {
+    return std::make_shared<KnownGenerator>(array_, count_);
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_form(const FormPtr& form) const override {
+    return shallow_copy();
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  with_length(int64_t length) const override {
+    return shallow_copy();
+  }
+
+private:
+  const ContentPtr array_;
+  int64_t* count_;
+};
+
+// The derived Form is exactly the Form of the sliced array.
+bool
+derives(const ContentPtr& array) {
+  std::vector<std::string> keys({ "y", "x" });
+  return array.get()->form(true).get()->getitem_field("x").get()->equal(
+           array.get()->getitem_field("x").get()->form(true),
+           true, true, false)  &&
+         array.get()->form(true).get()->getitem_fields(keys).get()->equal(
+           array.get()->getitem_fields(keys).get()->form(true),
+           true, true, false);
+}
+
+int main(int, char**) {
+  ContentPtr eager = FromJsonString(
+    "[[{\"x\": 1, \"y\": 1.1}], [], [{\"x\": 2, \"y\": 2.2}, "
+    "{\"x\": 3, \"y\": 3.3}], [{\"x\": 4, \"y\": 4.4}]]",
+    ArrayBuilderOptions(8, 1.5));
+
+  // Through lists, options, and unions.
+  Index64 index(3);
+  index.setitem_at_nowrap(0, 2);
+  index.setitem_at_nowrap(1, -1);
+  index.setitem_at_nowrap(2, 0);
+  ContentPtr option = std::make_shared<IndexedOptionArray64>(
+    Identities::none(), util::Parameters(), index, eager);
+  Index8 tags(3);
+  tags.setitem_at_nowrap(0, 0);
+  tags.setitem_at_nowrap(1, 1);
+  tags.setitem_at_nowrap(2, 0);
+  ContentPtr reordered = eager.get()->getitem_fields({ "y", "x" });
+  Index64 unionindex(3);
+  unionindex.setitem_at_nowrap(0, 0);
+  unionindex.setitem_at_nowrap(1, 1);
+  unionindex.setitem_at_nowrap(2, 3);
+  ContentPtr united = std::make_shared<UnionArray8_64>(
+    Identities::none(), util::Parameters(), tags, unionindex,
+    ContentPtrVec({ eager, option }));
+  if (!derives(eager)  ||  !derives(option)  ||  !derives(reordered)  ||
+      !derives(united)) {
+    return -1;
+  }
+
+  // Arrays without fields can't be sliced by field, Form or not.
+  try {
+    eager.get()->form(true).get()->getitem_field("x").get()
+      ->getitem_field("x");
+    return -1;
+  }
+  catch (std::invalid_argument&) { }
+
+  // Structure queries on lazy fields don't generate anything.
+  int64_t count = 0;
+  std::shared_ptr<VirtualArray> lazy = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<KnownGenerator>(eager, &count),
+    ArrayCachePtr(nullptr));
+  ContentPtr x = lazy.get()->getitem_field("x");
+  ContentPtr yx = lazy.get()->getitem_fields({ "y", "x" });
+  Slice where;
+  where.append(SliceRange(1, 3, 1));
+  where.become_sealed();
+  ContentPtr range = lazy.get()->getitem(where);
+  if (x.get()->purelist_depth() != 2  ||
+      x.get()->type(util::TypeStrs()).get()->tostring() != "var * int64"  ||
+      yx.get()->keys() != std::vector<std::string>({ "y", "x" })  ||
+      range.get()->keys() != std::vector<std::string>({ "x", "y" })  ||
+      yx.get()->getitem_field("y").get()->purelist_depth() != 2  ||
+      count != 0) {
+    return -1;
+  }
+
+  // And the generated arrays conform to the derived Forms.
+  if (x.get()->tojson(false, 1) != "[[1],[],[2,3],[4]]"  ||
+      yx.get()->tojson(false, 1) !=
+        eager.get()->getitem_fields({ "y", "x" }).get()->tojson(false, 1)  ||
+      range.get()->tojson(false, 1) !=
+        eager.get()->getitem_range_nowrap(1, 3).get()->tojson(false, 1)  ||
+      count != 3) {
+    return -1;
+  }
+
+  // A lazy field of a lazy field, even if the inner one is materialized
+  // before the outer one is generated.
+  int64_t innercount = 0;
+  std::shared_ptr<VirtualArray> inner = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<KnownGenerator>(eager.get()->getitem_field("x"),
+                                     &innercount),
+    ArrayCachePtr(nullptr));
+  ContentPtr outerrecord = std::make_shared<RecordArray>(
+    Identities::none(),
+    util::Parameters(),
+    ContentPtrVec({ inner }),
+    util::RecordLookupPtr(new util::RecordLookup({ "inner" })),
+    4);
+  int64_t outercount = 0;
+  std::shared_ptr<VirtualArray> outer = std::make_shared<VirtualArray>(
+    Identities::none(),
+    util::Parameters(),
+    std::make_shared<KnownGenerator>(outerrecord, &outercount),
+    ArrayCachePtr(nullptr));
+  ContentPtr nested = outer.get()->getitem_field("inner");
+  if (nested.get()->purelist_depth() != 2  ||
+      outercount != 0  ||  innercount != 0) {
+    return -1;
+  }
+  inner.get()->array();
+  if (nested.get()->tojson(false, 1) != "[[1],[],[2,3],[4]]") {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,198 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+  #include <direct.h>
+#else
+  #include <unistd.h>
+#endif
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Slice.h"
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/VirtualArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/io/json.h"
+#include "awkward/virtual/ArrayGenerator.h"
+#include "awkward/virtual/SpillingArrayCache.h"
+
+#include "helpers.h"
+
+using namespace awkward;
+
+// A new, empty directory for the spilled files.
+std::string
+scratch_directory() {
+#ifdef _MSC_VER
+  std::string out(std::tmpnam(nullptr));
+  if (_mkdir(out.c_str()) != 0) {
+    return std::string();
+  }
+  return out;
+#else
+  const char* tmpdir = std::getenv("TMPDIR");
+  std::string out = std::string(tmpdir == nullptr ? "/tmp" : tmpdir)
+                    + std::string("/test0299-XXXXXX");
+  if (mkdtemp(&out[0]) == nullptr) {
+    return std::string();
+  }
+  return out;
+#endif
+}
+
+std::string directory;
+
+// Spills an array straight to disk and reads it back.
+bool
+roundtrips(const ContentPtr& array) {
+  SpillingArrayCache cache(0, directory, 1000000);
+  cache.set("x", array);
+  if (cache.in_memory("x")  ||  !cache.on_disk("x")) {
+    return false;
+  }
+  ContentPtr out = cache.get("x");
+  return out.get() != nullptr  &&
+         out.get()->tojson(false, 1) == array.get()->tojson(false, 1)  &&
+         out.get()->form(true).get()->equal(
+           array.get()->pack().get()->form(true), true, true, false);
+}
+
+bool
+run() {
+  // Ten 8-byte integers are 80 bytes, so three of them fit in 250.
+  SpillingArrayCache cache(250, directory, 100000);
+  cache.set("a", numbers(10));
+  cache.set("b", numbers(10));
+  cache.set("c", numbers(10));
+  cache.set("d", numbers(10));
+  if (cache.in_memory("a")  ||  !cache.on_disk("a")  ||
+      cache.nbytes() != 240  ||  cache.diskbytes() != 80) {
+    return false;
+  }
+
+  // A hit on disk comes back into memory, pushing out another array.
+  ContentPtr a = cache.get("a");
+  if (a.get() == nullptr  ||
+      a.get()->tojson(false, 1) != numbers(10).get()->tojson(false, 1)  ||
+      !cache.in_memory("a")  ||  !cache.on_disk("a")  ||
+      cache.in_memory("b")  ||  !cache.on_disk("b")  ||
+      cache.diskbytes() != 160) {
+    return false;
+  }
+  cache.set("e", numbers(10));
+  cache.set("f", numbers(10));
+  cache.set("g", numbers(10));
+  if (cache.in_memory("a")  ||
+      cache.get("a").get()->tojson(false, 1) != a.get()->tojson(false, 1)) {
+    return false;
+  }
+
+  // Overwriting or erasing a key drops its file.
+  cache.set("b", numbers(5));
+  if (cache.on_disk("b")  ||  cache.get("b").get()->length() != 5) {
+    return false;
+  }
+  if (!cache.erase("c")  ||  cache.has("c")  ||  cache.erase("c")) {
+    return false;
+  }
+  cache.clear();
+  if (cache.nbytes() != 0  ||  cache.diskbytes() != 0  ||  cache.has("a")) {
+    return false;
+  }
+
+  // Nested, optional, variable-length, and union types all survive.
+  IndexU8 bitmask(2);
+  bitmask.setitem_at_nowrap(0, 0x6d);
+  bitmask.setitem_at_nowrap(1, 0x01);
+  ContentPtr bits = std::make_shared<BitMaskedArray>(Identities::none(),
+                                                     util::Parameters(),
+                                                     bitmask,
+                                                     numbers(9),
+                                                     true,
+                                                     9,
+                                                     true);
+  ContentPtr records = FromJsonString(
+    "[{\"x\": [1, 2], \"y\": \"one\", \"z\": null}, "
+    "{\"x\": [], \"y\": \"two\", \"z\": 2.2}, "
+    "{\"x\": [3], \"y\": \"three\", \"z\": 3.3}]",
+    ArrayBuilderOptions(8, 1.5));
+  ContentPtr mixed = FromJsonString(
+    "[1, [2, 3], {\"x\": 4}, [], 5, {\"x\": 6}]",
+    ArrayBuilderOptions(8, 1.5));
+  if (!roundtrips(bits)  ||  !roundtrips(records)  ||  !roundtrips(mixed)  ||
+      !roundtrips(records.get()->getitem_range_nowrap(1, 3))  ||
+      !roundtrips(mixed.get()->getitem_range_nowrap(2, 5))) {
+    return false;
+  }
+
+  // Arrays that can't be spilled are dropped.
+  SpillingArrayCache small(0, directory, 100);
+  ContentPtr identified = numbers(10);
+  identified.get()->setidentities();
+  small.set("identified", identified);
+  if (small.has("identified")) {
+    return false;
+  }
+
+  // The disk tier has a budget, too.
+  small.set("x", numbers(10));
+  small.set("y", numbers(10));
+  if (small.has("x")  ||  !small.on_disk("y")  ||  small.diskbytes() != 80) {
+    return false;
+  }
+
+  // A VirtualArray finds its spilled array without generating it again.
+  std::shared_ptr<SpillingArrayCache> shared =
+    std::make_shared<SpillingArrayCache>(100, directory, 100000);
+  ContentPtr content = numbers(20);
+  Slice where;
+  where.append(SliceRange(5, 15, 1));
+  where.become_sealed();
+  ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
+    content.get()->form(true), 10, content, where);
+  VirtualArray virtualarray(Identities::none(),
+                            util::Parameters(),
+                            generator,
+                            shared,
+                            "v");
+  virtualarray.array();
+  shared.get()->set("other", numbers(10));
+  if (shared.get()->in_memory("v")  ||
+      virtualarray.peek_array().get() == nullptr  ||
+      virtualarray.array().get()->tojson(false, 1) !=
+        "[5,6,7,8,9,10,11,12,13,14]") {
+    return false;
+  }
+
+  // Arrays that fail to be written, for whatever reason, are dropped, too.
+  SpillingArrayCache unwritable(0, directory + "/missing", 100000);
+  unwritable.set("x", numbers(10));
+  if (unwritable.has("x")) {
+    return false;
+  }
+
+  return true;
+}
+
+int main(int, char**) {
+  directory = scratch_directory();
+  if (directory.empty()) {
+    return -1;
+  }
+  bool success = run();
+  // The caches are gone by now, and with them their files.
+#ifdef _MSC_VER
+  if (_rmdir(directory.c_str()) != 0) {
+#else
+  if (rmdir(directory.c_str()) != 0) {
+#endif
+    return -1;
+  }
+  return success ? 0 : -1;
+}
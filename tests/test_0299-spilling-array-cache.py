@@ -0,0 +1,68 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import os
+
+import pytest
+import numpy
+
+import awkward1
+
+def numbers(length):
+    return awkward1.layout.NumpyArray(numpy.arange(length, dtype=numpy.int64))
+
+def test_spilling(tmpdir):
+    # Ten 8-byte integers are 80 bytes, so three of them fit in 250.
+    cache = awkward1.layout.SpillingArrayCache(250, str(tmpdir), 100000)
+    assert cache.directory == str(tmpdir)
+    for key in ["a", "b", "c", "d"]:
+        cache[key] = numbers(10)
+    assert not cache.in_memory("a")
+    assert cache.on_disk("a")
+    assert cache.nbytes == 240
+    assert cache.diskbytes == 80
+    assert len(os.listdir(str(tmpdir))) == 1
+
+    assert awkward1.to_list(cache["a"]) == list(range(10))
+    assert cache.in_memory("a")
+    assert not cache.in_memory("b")
+    assert cache.on_disk("b")
+
+    cache["b"] = numbers(5)
+    assert not cache.on_disk("b")
+    assert awkward1.to_list(cache["b"]) == list(range(5))
+
+    del cache["c"]
+    assert "c" not in cache
+    with pytest.raises(KeyError):
+        del cache["c"]
+
+    cache.clear()
+    assert cache.nbytes == 0
+    assert cache.diskbytes == 0
+    assert os.listdir(str(tmpdir)) == []
+
+def test_roundtrip(tmpdir):
+    cache = awkward1.layout.SpillingArrayCache(0, str(tmpdir), 1000000)
+    for data in [
+        [{"x": [1, 2], "y": "one", "z": None}, {"x": [], "y": "two", "z": 2.2}],
+        [1, [2, 3], {"x": 4}, [], 5, {"x": 6}],
+        [[1.1, None, 3.3], None, [4.4]],
+    ]:
+        layout = awkward1.from_iter(data, highlevel=False)
+        cache["x"] = layout
+        assert not cache.in_memory("x")
+        assert cache.on_disk("x")
+        assert awkward1.to_list(cache["x"]) == data
+
+def test_virtualarray(tmpdir):
+    cache = awkward1.layout.SpillingArrayCache(100, str(tmpdir), 100000)
+    generator = awkward1.layout.ArrayGenerator(lambda: numbers(10), form=numbers(10).form, length=10)
+    virtualarray = awkward1.layout.VirtualArray(generator, cache, cache_key="v")
+    virtualarray.array
+    cache["other"] = numbers(10)
+    assert not cache.in_memory("v")
+    assert cache.on_disk("v")
+    assert awkward1.to_list(virtualarray.array) == list(range(10))